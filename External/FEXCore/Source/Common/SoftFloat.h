@@ -73,6 +73,10 @@ struct X80SoftFloat {
 
     return Result;
 #else
+    X80SoftFloat Result;
+    if (FastAddSub(lhs, rhs, false, &Result)) {
+      return Result;
+    }
     return extF80_add(lhs, rhs);
 #endif
   }
@@ -94,6 +98,10 @@ struct X80SoftFloat {
 
     return Result;
 #else
+    X80SoftFloat Result;
+    if (FastAddSub(lhs, rhs, true, &Result)) {
+      return Result;
+    }
     return extF80_sub(lhs, rhs);
 #endif
   }
@@ -115,6 +123,10 @@ struct X80SoftFloat {
 
     return Result;
 #else
+    X80SoftFloat Result;
+    if (FastMul(lhs, rhs, &Result)) {
+      return Result;
+    }
     return extF80_mul(lhs, rhs);
 #endif
   }
@@ -136,6 +148,10 @@ struct X80SoftFloat {
 
     return Result;
 #else
+    X80SoftFloat Result;
+    if (FastDiv(lhs, rhs, &Result)) {
+      return Result;
+    }
     return extF80_div(lhs, rhs);
 #endif
   }
@@ -237,9 +253,24 @@ struct X80SoftFloat {
   }
 
   static void FCMP(X80SoftFloat const &lhs, X80SoftFloat const &rhs, bool *eq, bool *lt, bool *nan) {
-    *eq = extF80_eq(lhs, rhs);
-    *lt = extF80_lt(lhs, rhs);
-    *nan = IsNan(lhs) || IsNan(rhs);
+    // Same ordering as extF80_eq/extF80_lt without the call, exception flags aren't used
+    const bool Unordered = IsSoftFloatNaN(lhs) || IsSoftFloatNaN(rhs);
+    const bool BothZero = !lhs.Significand && !rhs.Significand && !lhs.Exponent && !rhs.Exponent;
+    const bool Identical = lhs.Sign == rhs.Sign && lhs.Exponent == rhs.Exponent && lhs.Significand == rhs.Significand;
+
+    *eq = !Unordered && (Identical || BothZero);
+    if (Unordered || Identical) {
+      *lt = false;
+    }
+    else if (lhs.Sign != rhs.Sign) {
+      *lt = lhs.Sign && !BothZero;
+    }
+    else {
+      const bool MagnitudeLess = lhs.Exponent != rhs.Exponent ? lhs.Exponent < rhs.Exponent : lhs.Significand < rhs.Significand;
+      *lt = lhs.Sign ^ MagnitudeLess;
+    }
+    // Unordered with the same NaN definition as the eq/lt results, this includes the default NaN
+    *nan = Unordered;
   }
 
   static X80SoftFloat FSCALE(X80SoftFloat const &lhs, X80SoftFloat const &rhs) {
@@ -560,6 +591,157 @@ private:
   static constexpr uint64_t IntegerBit = (1ULL << 63);
   static constexpr uint64_t Bottom62Significand = ((1ULL << 62) - 1);
   static constexpr uint32_t ExponentBias = 16383;
+  static constexpr uint32_t MaxNormalExponent = 0x7FFE;
+
+  // SoftFloat's definition of NaN, any fraction bit set with a maximum exponent
+  static bool IsSoftFloatNaN(X80SoftFloat const &lhs) {
+    return lhs.Exponent == 0x7FFF && (lhs.Significand & ~IntegerBit);
+  }
+
+  static bool IsNormal(X80SoftFloat const &lhs) {
+    return lhs.Exponent != 0 && lhs.Exponent != 0x7FFF && (lhs.Significand & IntegerBit);
+  }
+
+  // Fast paths for the common x87 case of normal operands with a normal result.
+  // These work directly on the 64-bit significands and only support what the default FCW selects,
+  // round to nearest even with 64-bit precision. Anything else returns false and goes through SoftFloat.
+  // Results are bit identical to SoftFloat's.
+  static bool CanUseFastPath(X80SoftFloat const &lhs, X80SoftFloat const &rhs) {
+    return softfloat_roundingMode == softfloat_round_near_even &&
+      extF80_roundingPrecision == 80 &&
+      IsNormal(lhs) && IsNormal(rhs);
+  }
+
+  // Rounds the significand using the bits below it, Extra is non-zero for any inexact result
+  static bool RoundPack(unsigned Sign, int32_t Exponent, uint64_t Significand, uint64_t Extra, X80SoftFloat *Result) {
+    constexpr uint64_t Half = 1ULL << 63;
+    if (Extra > Half || (Extra == Half && (Significand & 1))) {
+      ++Significand;
+      if (Significand == 0) {
+        Significand = IntegerBit;
+        ++Exponent;
+      }
+    }
+
+    // Overflow and denormal results need the SoftFloat handling
+    if (Exponent < 1 || Exponent > static_cast<int32_t>(MaxNormalExponent)) {
+      return false;
+    }
+
+    *Result = X80SoftFloat(Sign, Exponent, Significand);
+    return true;
+  }
+
+  static unsigned __int128 ShiftRightJam(unsigned __int128 Value, uint32_t Shift) {
+    if (Shift == 0) {
+      return Value;
+    }
+    if (Shift >= 128) {
+      return Value != 0;
+    }
+    return (Value >> Shift) | ((Value << (128 - Shift)) != 0);
+  }
+
+  static bool FastAddSub(X80SoftFloat const &lhs, X80SoftFloat const &rhs, bool Subtract, X80SoftFloat *Result) {
+    if (!CanUseFastPath(lhs, rhs)) {
+      return false;
+    }
+
+    // Order by magnitude so the smaller operand is the one that gets shifted
+    const unsigned RHSSign = rhs.Sign ^ Subtract;
+    const bool Swap = lhs.Exponent < rhs.Exponent ||
+      (lhs.Exponent == rhs.Exponent && lhs.Significand < rhs.Significand);
+    X80SoftFloat const &Large = Swap ? rhs : lhs;
+    X80SoftFloat const &Small = Swap ? lhs : rhs;
+    const unsigned LargeSign = Swap ? RHSSign : lhs.Sign;
+    const unsigned SmallSign = Swap ? lhs.Sign : RHSSign;
+
+    // Integer bit sits at bit 126, leaving a carry bit above and 63 guard bits below
+    const unsigned __int128 LargeSig = static_cast<unsigned __int128>(Large.Significand) << 63;
+    const unsigned __int128 SmallSig = ShiftRightJam(static_cast<unsigned __int128>(Small.Significand) << 63, Large.Exponent - Small.Exponent);
+
+    unsigned __int128 Sum;
+    if (LargeSign == SmallSign) {
+      Sum = LargeSig + SmallSig;
+    }
+    else {
+      Sum = LargeSig - SmallSig;
+      if (Sum == 0) {
+        // Exact cancellation is +0 when rounding to nearest
+        *Result = X80SoftFloat(0, 0, 0);
+        return true;
+      }
+    }
+
+    const uint64_t High = Sum >> 64;
+    const uint32_t LeadingZeros = High ? __builtin_clzll(High) : 64 + __builtin_clzll(static_cast<uint64_t>(Sum));
+    const int32_t Exponent = static_cast<int32_t>(Large.Exponent) + 1 - LeadingZeros;
+    Sum <<= LeadingZeros;
+
+    return RoundPack(LargeSign, Exponent, Sum >> 64, static_cast<uint64_t>(Sum), Result);
+  }
+
+  static bool FastMul(X80SoftFloat const &lhs, X80SoftFloat const &rhs, X80SoftFloat *Result) {
+    if (!CanUseFastPath(lhs, rhs)) {
+      return false;
+    }
+
+    // Product of two normalized significands is in [2^126, 2^128)
+    unsigned __int128 Product = static_cast<unsigned __int128>(lhs.Significand) * rhs.Significand;
+    int32_t Exponent = static_cast<int32_t>(lhs.Exponent) + rhs.Exponent - ExponentBias;
+    if (Product >> 127) {
+      ++Exponent;
+    }
+    else {
+      Product <<= 1;
+    }
+
+    return RoundPack(lhs.Sign ^ rhs.Sign, Exponent, Product >> 64, static_cast<uint64_t>(Product), Result);
+  }
+
+  static bool FastDiv(X80SoftFloat const &lhs, X80SoftFloat const &rhs, X80SoftFloat *Result) {
+    if (!CanUseFastPath(lhs, rhs)) {
+      return false;
+    }
+
+    // Shift the dividend so the quotient lands in [2^63, 2^64)
+    int32_t Exponent = static_cast<int32_t>(lhs.Exponent) - rhs.Exponent + ExponentBias;
+    uint32_t Shift = 63;
+    if (lhs.Significand < rhs.Significand) {
+      --Exponent;
+      Shift = 64;
+    }
+
+    const unsigned __int128 Dividend = static_cast<unsigned __int128>(lhs.Significand) << Shift;
+    const uint64_t Divisor = rhs.Significand;
+    uint64_t Quotient, Remainder;
+#ifdef _M_X86_64
+    // Quotient is known to fit in 64 bits so a single divq is enough
+    asm ("divq %[Divisor]"
+      : "=a" (Quotient), "=d" (Remainder)
+      : [Divisor] "r" (Divisor), "a" (static_cast<uint64_t>(Dividend)), "d" (static_cast<uint64_t>(Dividend >> 64)));
+#else
+    Quotient = Dividend / Divisor;
+    Remainder = Dividend - static_cast<unsigned __int128>(Quotient) * Divisor;
+#endif
+
+    // Only the remainder's relation to half the divisor matters for rounding
+    uint64_t Extra = 0;
+    if (Remainder) {
+      const unsigned __int128 Twice = static_cast<unsigned __int128>(Remainder) << 1;
+      if (Twice > Divisor) {
+        Extra = IntegerBit | 1;
+      }
+      else if (Twice == Divisor) {
+        Extra = IntegerBit;
+      }
+      else {
+        Extra = 1;
+      }
+    }
+
+    return RoundPack(lhs.Sign ^ rhs.Sign, Exponent, Quotient, Extra, Result);
+  }
 };
 
 static_assert(sizeof(X80SoftFloat) == 10, "tword must be 10bytes in size");
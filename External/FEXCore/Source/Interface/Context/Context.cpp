@@ -226,11 +226,11 @@ namespace Debug {
     return CTX->FindHostCodeForRIP(RIP, Code);
   }
 
-  // XXX:
-  // bool FindIRForRIP(FEXCore::Context::Context *CTX, uint64_t RIP, FEXCore::IR::IntrusiveIRList **ir) {
-  //   return CTX->FindIRForRIP(RIP, ir);
-  // }
+  bool FindIRForRIP(FEXCore::Context::Context *CTX, uint64_t RIP, std::vector<uint8_t> *Storage, FEXCore::IR::IRListView **IR) {
+    return CTX->FindIRForRIP(RIP, Storage, IR);
+  }
 
+  // XXX:
   // void SetIRForRIP(FEXCore::Context::Context *CTX, uint64_t RIP, FEXCore::IR::IntrusiveIRList *const ir) {
   //   CTX->SetIRForRIP(RIP, ir);
   // }
@@ -3,8 +3,10 @@
 #include "Common/JitSymbols.h"
 #include "FEXHeaderUtils/ScopedSignalMask.h"
 #include "Interface/Core/CPUID.h"
+#include "Interface/Core/LookupCache.h"
 #include "Interface/Core/X86HelperGen.h"
 #include "Interface/Core/ObjectCache/ObjectCacheService.h"
+#include "Interface/Core/UnalignedAccessFeedback.h"
 #include "Interface/Core/Dispatcher/Dispatcher.h"
 #include "Interface/IR/AOTIR.h"
 #include <FEXCore/Config/Config.h>
@@ -20,6 +22,7 @@
 
 
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <functional>
 #include <istream>
@@ -103,6 +106,8 @@ namespace FEXCore::Context {
       FEX_CONFIG_OPT(SMCChecks, SMCCHECKS);
       FEX_CONFIG_OPT(Core, CORE);
       FEX_CONFIG_OPT(MaxInstPerBlock, MAXINST);
+      FEX_CONFIG_OPT(TierUpThreshold, TIERUPTHRESHOLD);
+      FEX_CONFIG_OPT(SafepointPolling, SAFEPOINTPOLLING);
       FEX_CONFIG_OPT(RootFSPath, ROOTFS);
       FEX_CONFIG_OPT(ThunkHostLibsPath, THUNKHOSTLIBS);
       FEX_CONFIG_OPT(ThunkHostLibsPath32, THUNKHOSTLIBS32);
@@ -113,11 +118,14 @@ namespace FEXCore::Context {
       FEX_CONFIG_OPT(LibraryJITNaming, LIBRARYJITNAMING);
       FEX_CONFIG_OPT(BlockJITNaming, BLOCKJITNAMING);
       FEX_CONFIG_OPT(GDBSymbols, GDBSYMBOLS);
+      FEX_CONFIG_OPT(IndirectBranchStats, INDIRECTBRANCHSTATS);
+      FEX_CONFIG_OPT(GuestProfiler, GUESTPROFILER);
       FEX_CONFIG_OPT(ParanoidTSO, PARANOIDTSO);
       FEX_CONFIG_OPT(CacheObjectCodeCompilation, CACHEOBJECTCODECOMPILATION);
       FEX_CONFIG_OPT(x87ReducedPrecision, X87REDUCEDPRECISION);
       FEX_CONFIG_OPT(x86dec_SynchronizeRIPOnAllBlocks, X86DEC_SYNCHRONIZERIPONALLBLOCKS);
       FEX_CONFIG_OPT(EnableAVX, ENABLEAVX);
+      FEX_CONFIG_OPT(SoftwareCrypto, SOFTWARECRYPTO);
     } Config;
 
     FEXCore::HostFeatures HostFeatures;
@@ -177,7 +185,9 @@ namespace FEXCore::Context {
     void RegisterFrontendHostSignalHandler(int Signal, HostSignalDelegatorFunction Func, bool Required);
 
     static void ThreadRemoveCodeEntry(FEXCore::Core::InternalThreadState *Thread, uint64_t GuestRIP);
-    static void ThreadAddBlockLink(FEXCore::Core::InternalThreadState *Thread, uint64_t GuestDestination, uintptr_t HostLink, const std::function<void()> &delinker);
+    static void ThreadAddBlockLink(FEXCore::Core::InternalThreadState *Thread, uint64_t GuestDestination, uintptr_t HostLink, LookupCache::BlockLinkKind Kind, uint64_t Value);
+    // Fills an indirect branch inline cache entry for the RIP stored in the frame
+    static uint64_t ThreadIndirectBranchLink(FEXCore::Core::CpuStateFrame *Frame, uint64_t *record);
 
     template<auto Fn>
     static uint64_t ThreadExitFunctionLink(FEXCore::Core::CpuStateFrame *Frame, uint64_t *record) {
@@ -209,6 +219,7 @@ namespace FEXCore::Context {
     FEXCore::Core::RuntimeStats *GetRuntimeStatsForThread(uint64_t Thread);
     bool GetDebugDataForRIP(uint64_t RIP, FEXCore::Core::DebugData *Data);
     bool FindHostCodeForRIP(uint64_t RIP, uint8_t **Code);
+    bool FindIRForRIP(uint64_t RIP, std::vector<uint8_t> *Storage, FEXCore::IR::IRListView **IR);
 
     struct GenerateIRResult {
       FEXCore::IR::IRListView* IRList;
@@ -301,6 +312,9 @@ namespace FEXCore::Context {
 
     FEXCore::JITSymbols Symbols;
 
+    // Guest RIPs of TSO accesses that have needed an unaligned access backpatch
+    FEXCore::UnalignedAccessFeedback UnalignedAccesses;
+
     // Public for threading
     void ExecutionThread(FEXCore::Core::InternalThreadState *Thread);
 
@@ -335,6 +349,8 @@ namespace FEXCore::Context {
 
   protected:
     void ClearCodeCache(FEXCore::Core::InternalThreadState *Thread);
+    // Evicts only the oldest region of the code buffer, falls back to ClearCodeCache when the backend can't
+    void ClearCodeRegion(FEXCore::Core::InternalThreadState *Thread);
 
   private:
     /**
@@ -359,8 +375,22 @@ namespace FEXCore::Context {
 
     void NotifyPause();
 
+    /**
+     * @brief Sets SafepointRequest on each thread and waits for them to take it
+     *
+     * Threads that haven't taken their request within SAFEPOINT_TIMEOUT get SIGNAL_FOR_PAUSE instead.
+     * SignalReason must already be set on each thread.
+     */
+    void RequestSafepoint(std::vector<FEXCore::Core::InternalThreadState*> const &Targets);
+    constexpr static auto SAFEPOINT_TIMEOUT = std::chrono::milliseconds(10);
+
     void AddBlockMapping(FEXCore::Core::InternalThreadState *Thread, uint64_t Address, void *Ptr);
 
+    /**
+     * @brief Moves the thread's backpatched unaligned access RIPs in to UnalignedAccesses and the AOTIR cache
+     */
+    void MergeUnalignedAccesses(FEXCore::Core::InternalThreadState *Thread);
+
     // Entry Cache
     std::mutex ExitMutex;
     std::unique_ptr<GdbServer> DebugServer;
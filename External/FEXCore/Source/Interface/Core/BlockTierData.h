@@ -0,0 +1,188 @@
+#pragma once
+
+#include <tsl/robin_map.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <deque>
+#include <set>
+#include <vector>
+
+namespace FEXCore {
+/**
+ * @brief Per-thread profiles for the profile guided compile tier
+ *
+ * Blocks compiled in the profiling tier count their entries, the direct exits they take and
+ * the targets of their indirect branches.
+ * Once a block's entry count reaches the threshold the block removes itself from the LookupCache
+ * and the dispatcher recompiles it as a hot region, formed from the edges and targets that were observed.
+ *
+ * Profiles are only touched by the owning thread, both from JIT code and from the compiler.
+ */
+class BlockTierData final {
+public:
+  struct TierStats {
+    uint64_t ColdBlocksCompiled;
+    uint64_t HotBlocksCompiled;
+    uint64_t ColdCompileTimeNS;
+    uint64_t HotCompileTimeNS;
+  };
+
+  // A direct exit from a block, Target of zero is an unused slot
+  struct EdgeProfile {
+    uint64_t Target;
+    uint32_t Count;
+  };
+
+  // Repeats counts the exits that went to the same target as the exit before
+  struct IndirectProfile {
+    uint64_t LastTarget;
+    uint32_t Repeats;
+    uint32_t Exits;
+  };
+
+  // Conditional branches have two exits, a few more covers block ending instructions on the way
+  constexpr static size_t MaxProfiledEdges = 4;
+  constexpr static size_t MaxProfiledIndirect = 2;
+
+  struct BlockProfile {
+    uint32_t Entries;
+    std::array<EdgeProfile, MaxProfiledEdges> Edges;
+    // Guest RIP of the indirect branch instructions in this block, zero is unused
+    std::array<uint64_t, MaxProfiledIndirect> IndirectRIPs;
+  };
+
+  // What a hot region was formed from
+  // Targets are the block entries to decode, IndirectTargets maps an indirect branch's RIP to its predicted target
+  struct HotRegionInfo {
+    std::set<uint64_t> Targets;
+    tsl::robin_map<uint64_t, uint64_t> IndirectTargets;
+  };
+
+  // An edge needs at least 1/HotEdgeFraction of its block's entries to join the region
+  constexpr static uint32_t HotEdgeFraction = 8;
+  // Indirect branches are only predicted once they have been seen a few times and nearly always repeat
+  constexpr static uint32_t MinIndirectExits = 8;
+  constexpr static size_t MaxRegionBlocks = 32;
+
+  // Returns the profile for a block entry, creating it if it doesn't exist
+  // The returned pointer stays valid for the lifetime of this object
+  BlockProfile *GetProfile(uint64_t GuestRIP) {
+    auto it = ProfileForRIP.find(GuestRIP);
+    if (it != ProfileForRIP.end()) {
+      return it->second;
+    }
+
+    BlockProfile *Profile = &Profiles.emplace_back();
+    ProfileForRIP.emplace(GuestRIP, Profile);
+    return Profile;
+  }
+
+  // Returns the counter for the edge to Target, nullptr if every slot is taken by other targets
+  static uint32_t *GetEdgeCounter(BlockProfile *Profile, uint64_t Target) {
+    for (auto &Edge : Profile->Edges) {
+      if (Edge.Target == 0) {
+        Edge.Target = Target;
+      }
+
+      if (Edge.Target == Target) {
+        return &Edge.Count;
+      }
+    }
+
+    return nullptr;
+  }
+
+  // Returns the profile for the indirect branch at InstRIP inside the block at GuestRIP
+  // nullptr if the block already tracks as many indirect branches as it can
+  IndirectProfile *GetIndirectProfile(uint64_t GuestRIP, uint64_t InstRIP) {
+    auto Block = GetProfile(GuestRIP);
+    auto Slot = std::find_if(Block->IndirectRIPs.begin(), Block->IndirectRIPs.end(), [InstRIP](uint64_t RIP) {
+      return RIP == 0 || RIP == InstRIP;
+    });
+
+    if (Slot == Block->IndirectRIPs.end()) {
+      return nullptr;
+    }
+
+    *Slot = InstRIP;
+
+    auto it = IndirectForRIP.find(InstRIP);
+    if (it != IndirectForRIP.end()) {
+      return it->second;
+    }
+
+    IndirectProfile *Profile = &IndirectProfiles.emplace_back();
+    IndirectForRIP.emplace(InstRIP, Profile);
+    return Profile;
+  }
+
+  bool IsHot(uint64_t GuestRIP, uint32_t Threshold) const {
+    auto it = ProfileForRIP.find(GuestRIP);
+    return it != ProfileForRIP.end() && it->second->Entries >= Threshold;
+  }
+
+  // Walks the profiled edges out from Entry, following the ones taken often enough
+  void FormRegion(uint64_t Entry, HotRegionInfo *Region) const {
+    Region->Targets.clear();
+    Region->IndirectTargets.clear();
+
+    std::vector<uint64_t> Worklist {Entry};
+
+    while (!Worklist.empty() && Region->Targets.size() < MaxRegionBlocks) {
+      const uint64_t RIP = Worklist.back();
+      Worklist.pop_back();
+
+      if (!Region->Targets.insert(RIP).second) {
+        continue;
+      }
+
+      auto it = ProfileForRIP.find(RIP);
+      if (it == ProfileForRIP.end()) {
+        continue;
+      }
+
+      auto Profile = it->second;
+      for (auto &Edge : Profile->Edges) {
+        if (Edge.Count != 0 &&
+            static_cast<uint64_t>(Edge.Count) * HotEdgeFraction >= Profile->Entries) {
+          Worklist.emplace_back(Edge.Target);
+        }
+      }
+
+      for (auto InstRIP : Profile->IndirectRIPs) {
+        auto Indirect = IndirectForRIP.find(InstRIP);
+        if (InstRIP == 0 || Indirect == IndirectForRIP.end()) {
+          continue;
+        }
+
+        auto IndirectProfile = Indirect->second;
+        if (IndirectProfile->Exits >= MinIndirectExits &&
+            static_cast<uint64_t>(IndirectProfile->Repeats) * HotEdgeFraction >= static_cast<uint64_t>(IndirectProfile->Exits) * (HotEdgeFraction - 1)) {
+          Region->IndirectTargets[InstRIP] = IndirectProfile->LastTarget;
+          Worklist.emplace_back(IndirectProfile->LastTarget);
+        }
+      }
+    }
+  }
+
+  // Sum of block entries executed by profiling tier code
+  uint64_t GetProfiledEntries() const {
+    uint64_t Total{};
+    for (auto &Profile : Profiles) {
+      Total += Profile.Entries;
+    }
+    return Total;
+  }
+
+  TierStats Stats{};
+
+private:
+  // std::deque never moves existing elements on emplace_back, JIT code holds raw pointers to these
+  std::deque<BlockProfile> Profiles;
+  std::deque<IndirectProfile> IndirectProfiles;
+  tsl::robin_map<uint64_t, BlockProfile*> ProfileForRIP;
+  tsl::robin_map<uint64_t, IndirectProfile*> IndirectForRIP;
+};
+}
@@ -5,8 +5,8 @@
 namespace FEXCore {
 namespace CPU {
 
-CPUBackend::CPUBackend(FEXCore::Core::InternalThreadState *ThreadState, size_t InitialCodeSize, size_t MaxCodeSize)
-    : ThreadState(ThreadState), InitialCodeSize(InitialCodeSize), MaxCodeSize(MaxCodeSize) {}
+CPUBackend::CPUBackend(FEXCore::Core::InternalThreadState *ThreadState, size_t InitialCodeSize, size_t MaxCodeSize, bool UseCodeRegions)
+    : ThreadState(ThreadState), InitialCodeSize(InitialCodeSize), MaxCodeSize(MaxCodeSize), UseCodeRegions(UseCodeRegions) {}
 
 CPUBackend::~CPUBackend() {
   for (auto CodeBuffer : CodeBuffers) {
@@ -50,9 +50,46 @@ auto CPUBackend::GetEmptyCodeBuffer() -> CodeBuffer * {
     EmplaceNewCodeBuffer(NewCodeBuffer);
   }
 
+  // Only split once the buffer can't grow anymore, and not while extra buffers from signal handlers exist
+  if (UseCodeRegions && CodeBuffers.size() == 1 && CurrentCodeBuffer->Size == MaxCodeSize) {
+    CodeRegionSize = CurrentCodeBuffer->Size / CODE_REGION_COUNT;
+  } else {
+    CodeRegionSize = 0;
+  }
+
+  CanEvictCodeRegions = CodeRegionSize != 0;
+
+  CurrentCodeRegionIndex = 0;
+  CurrentCodeRegion = CodeBuffer {CurrentCodeBuffer->Ptr, CodeRegionSize ? CodeRegionSize : CurrentCodeBuffer->Size};
+
   return CurrentCodeBuffer;
 }
 
+bool CPUBackend::NextCodeRegion() {
+  // Code in any region might be on the stack below a signal handler
+  if (!CanEvictCodeRegions || ThreadState->CurrentFrame->SignalHandlerRefCounter != 0) {
+    return false;
+  }
+
+  CurrentCodeRegionIndex = (CurrentCodeRegionIndex + 1) % CODE_REGION_COUNT;
+  CurrentCodeRegion = CodeBuffer {CurrentCodeBuffer->Ptr + CurrentCodeRegionIndex * CodeRegionSize, CodeRegionSize};
+
+  return true;
+}
+
+size_t CPUBackend::GetCodeRegionIndex(uintptr_t Address) const {
+  if (!CodeRegionSize) {
+    return 0;
+  }
+
+  const auto Start = reinterpret_cast<uintptr_t>(CurrentCodeBuffer->Ptr);
+  if (Address < Start || Address >= Start + CurrentCodeBuffer->Size) {
+    return 0;
+  }
+
+  return (Address - Start) / CodeRegionSize;
+}
+
 auto CPUBackend::AllocateNewCodeBuffer(size_t Size) -> CodeBuffer {
   CodeBuffer Buffer;
   Buffer.Size = Size;
@@ -421,7 +421,7 @@ FEXCore::CPUID::FunctionResults CPUIDEmu::Function_01h(uint32_t Leaf) {
 
   Res.ecx =
     (1 <<  0) | // SSE3
-    (CTX->HostFeatures.SupportsPMULL_128Bit <<  1) | // PCLMULQDQ
+    ((CTX->HostFeatures.SupportsPMULL_128Bit || CTX->HostFeatures.EmulatePMULL_128Bit) <<  1) | // PCLMULQDQ
     (1 <<  2) | // DS area supports 64bit layout
     (1 <<  3) | // MWait
     (0 <<  4) | // DS-CPL
@@ -445,7 +445,7 @@ FEXCore::CPUID::FunctionResults CPUIDEmu::Function_01h(uint32_t Leaf) {
     (1 << 22) | // MOVBE
     (1 << 23) | // POPCNT
     (0 << 24) | // APIC TSC-Deadline
-    (CTX->HostFeatures.SupportsAES << 25) | // AES
+    ((CTX->HostFeatures.SupportsAES || CTX->HostFeatures.EmulateAES) << 25) | // AES
     (0 << 26) | // XSAVE
     (0 << 27) | // OSXSAVE
     (SUPPORTS_AVX << 28) | // AVX
@@ -1248,7 +1248,7 @@ void CPUIDEmu::Init(FEXCore::Context::Context *ctx) {
 
   // 0x1A: Hybrid Information Sub-leaf
 #ifndef CPUID_AMD
-  RegisterFunction(0x1A, &CPUIDEmu::Function_1Ah);
+  RegisterFunction(0x1A, &CPUIDEmu::Function_1Ah, true);
 #endif
   // Hypervisor CPUID information leaf
   RegisterFunction(0x4000'0000, &CPUIDEmu::Function_4000_0000h);
@@ -1259,11 +1259,11 @@ void CPUIDEmu::Init(FEXCore::Context::Context *ctx) {
   // Processor vendor
   RegisterFunction(0x8000'0001, &CPUIDEmu::Function_8000_0001h);
   // Processor brand string
-  RegisterFunction(0x8000'0002, &CPUIDEmu::Function_8000_0002h);
+  RegisterFunction(0x8000'0002, &CPUIDEmu::Function_8000_0002h, true);
   // Processor brand string continued
-  RegisterFunction(0x8000'0003, &CPUIDEmu::Function_8000_0003h);
+  RegisterFunction(0x8000'0003, &CPUIDEmu::Function_8000_0003h, true);
   // Processor brand string continued
-  RegisterFunction(0x8000'0004, &CPUIDEmu::Function_8000_0004h);
+  RegisterFunction(0x8000'0004, &CPUIDEmu::Function_8000_0004h, true);
   // 0x8000'0005: L1 Cache and TLB identifiers
 #ifdef CPUID_AMD
   RegisterFunction(0x8000'0005, &CPUIDEmu::Function_8000_0005h);
@@ -1295,6 +1295,27 @@ void CPUIDEmu::Init(FEXCore::Context::Context *ctx) {
 
   // Setup some state tracking
   SetupHostHybridFlag();
+
+  CalculateFunctionTable();
+}
+
+void CPUIDEmu::CalculateFunctionTable() {
+  for (auto &Entry : FunctionTable) {
+    if (Entry.PerCPU) {
+      continue;
+    }
+
+    for (uint32_t Leaf = 0; Leaf < CACHED_LEAVES; ++Leaf) {
+      Entry.Leaves[Leaf] = (this->*Entry.Handler)(Leaf);
+    }
+
+    // Functions only ever test for specific subleaves, so any subleaf past the cached ones gets the same result
+    Entry.Leaves[CACHED_LEAVES] = (this->*Entry.Handler)(~0U);
+
+    Entry.LeafInvariant = std::all_of(std::begin(Entry.Leaves), std::end(Entry.Leaves), [&Entry](auto const &Result) {
+      return memcmp(&Result, &Entry.Leaves[0], sizeof(Result)) == 0;
+    });
+  }
 }
 }
 
@@ -1,12 +1,15 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <cstdint>
-#include <unordered_map>
+#include <optional>
 #include <utility>
 #include <vector>
 
 #include <FEXCore/Core/CPUID.h>
 #include <FEXCore/Config/Config.h>
+#include <FEXCore/Utils/LogManager.h>
 
 namespace FEXCore {
 namespace Context {
@@ -31,13 +34,40 @@ public:
   void Init(FEXCore::Context::Context *ctx);
 
   FEXCore::CPUID::FunctionResults RunFunction(uint32_t Function, uint32_t Leaf) {
-    const auto Handler = FunctionHandlers.find(Function);
-
-    if (Handler == FunctionHandlers.end()) {
+    const auto Index = GetTableIndex(Function);
+    if (Index == INVALID_TABLE_INDEX) {
       return Function_Reserved(Leaf);
     }
 
-    return (this->*Handler->second)(Leaf);
+    const auto &Entry = FunctionTable[Index];
+    if (Entry.PerCPU) {
+      return (this->*Entry.Handler)(Leaf);
+    }
+
+    return Entry.Leaves[std::min(Leaf, CACHED_LEAVES)];
+  }
+
+  /**
+   * @brief Fetches a CPUID result for folding in to JIT code
+   *
+   * @param Leaf The leaf if it is known at compile time
+   *
+   * @return false if the result varies per CPU, or if Leaf isn't known and the result depends on it
+   */
+  bool GetConstantResult(uint32_t Function, std::optional<uint32_t> Leaf, FEXCore::CPUID::FunctionResults *Results) const {
+    const auto Index = GetTableIndex(Function);
+    if (Index == INVALID_TABLE_INDEX) {
+      *Results = {};
+      return true;
+    }
+
+    const auto &Entry = FunctionTable[Index];
+    if (Entry.PerCPU || (!Leaf && !Entry.LeafInvariant)) {
+      return false;
+    }
+
+    *Results = Entry.Leaves[std::min(Leaf.value_or(0), CACHED_LEAVES)];
+    return true;
   }
 
   FEXCore::CPUID::FunctionResults RunFunctionName(uint32_t Function, uint32_t Leaf, uint32_t CPU) {
@@ -55,11 +85,43 @@ private:
   FEX_CONFIG_OPT(Cores, THREADS);
 
   using FunctionHandler = FEXCore::CPUID::FunctionResults (CPUIDEmu::*)(uint32_t Leaf);
-  void RegisterFunction(uint32_t Function, FunctionHandler Handler) {
-    FunctionHandlers.insert_or_assign(Function, Handler);
+  void RegisterFunction(uint32_t Function, FunctionHandler Handler, bool PerCPU = false) {
+    const auto Index = GetTableIndex(Function);
+    LOGMAN_THROW_AA_FMT(Index != INVALID_TABLE_INDEX, "CPUID function 0x{:x} is outside of the function table", Function);
+    FunctionTable[Index].Handler = Handler;
+    FunctionTable[Index].PerCPU = PerCPU;
+  }
+
+  // Each function range (0000_00xxh, 4000_00xxh, 8000_00xxh) gets this many table slots
+  // Everything past the end of a range is reserved
+  constexpr static uint32_t FUNCTIONS_PER_RANGE = 0x20;
+  constexpr static uint32_t NUM_RANGES = 3;
+  constexpr static uint32_t INVALID_TABLE_INDEX = ~0U;
+
+  // Subleaves which get their own table slot, any higher subleaf shares the last slot
+  // No function distinguishes more than this many subleaves
+  constexpr static uint32_t CACHED_LEAVES = 4;
+
+  static uint32_t GetTableIndex(uint32_t Function) {
+    const uint32_t Range = Function >> 30;
+    const uint32_t Offset = Function & 0x3FFF'FFFF;
+    if (Range >= NUM_RANGES || Offset >= FUNCTIONS_PER_RANGE) {
+      return INVALID_TABLE_INDEX;
+    }
+    return Range * FUNCTIONS_PER_RANGE + Offset;
   }
 
-  std::unordered_map<uint32_t, FunctionHandler> FunctionHandlers;
+  struct FunctionTableEntry {
+    FunctionHandler Handler{&CPUIDEmu::Function_Reserved};
+    // Results are precomputed at init unless they depend on the CPU the guest is running on
+    bool PerCPU{};
+    bool LeafInvariant{};
+    FEXCore::CPUID::FunctionResults Leaves[CACHED_LEAVES + 1]{};
+  };
+
+  std::array<FunctionTableEntry, FUNCTIONS_PER_RANGE * NUM_RANGES> FunctionTable{};
+  void CalculateFunctionTable();
+
   struct CPUData {
     const char *ProductName{};
 #ifdef _M_ARM_64
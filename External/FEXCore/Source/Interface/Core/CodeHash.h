@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+namespace FEXCore::CodeHash {
+/**
+ * @brief Hash of a guest code range for SMCChecks=full
+ *
+ * The frontend hashes each block's guest bytes at compile time and the backends emit the same steps inline at block entry.
+ * The code is consumed as 8 byte chunks followed by one 4, 2 and 1 byte chunk for whatever remains.
+ *
+ * Each step is a bijection of both the running hash and the chunk, so a change contained in one chunk always changes the result.
+ */
+constexpr uint64_t SEED = 0x9E37'79B9'7F4A'7C15ULL;
+constexpr uint64_t MULTIPLIER = 0xFF51'AFD7'ED55'8CCDULL;
+
+constexpr uint64_t Step(uint64_t Hash, uint64_t Chunk) {
+  return (Hash ^ Chunk) * MULTIPLIER;
+}
+
+inline uint64_t Hash(uint8_t const *Code, uint32_t Length) {
+  uint64_t Result = SEED;
+
+  for (uint32_t ChunkSize = 8; ChunkSize > 0; ChunkSize >>= 1) {
+    while (Length >= ChunkSize) {
+      uint64_t Chunk{};
+      memcpy(&Chunk, Code, ChunkSize);
+      Result = Step(Result, Chunk);
+      Code += ChunkSize;
+      Length -= ChunkSize;
+    }
+  }
+
+  return Result;
+}
+}
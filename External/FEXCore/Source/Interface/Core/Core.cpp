@@ -9,10 +9,14 @@ $end_info$
 
 #include <cstdint>
 #include "Interface/Context/Context.h"
+#include "Interface/Core/BlockTierData.h"
+#include "Interface/Core/CodeHash.h"
+#include "Interface/Core/DebugMetadataStore.h"
 #include "Interface/Core/LookupCache.h"
 #include "Interface/Core/Core.h"
 #include "Interface/Core/CPUID.h"
 #include "Interface/Core/Frontend.h"
+#include "Interface/Core/GuestProfiler.h"
 #include "Interface/Core/GdbServer.h"
 #include "Interface/Core/ObjectCache/ObjectCacheService.h"
 #include "Interface/Core/OpcodeDispatcher.h"
@@ -70,6 +74,7 @@ $end_info$
 #include <sys/mman.h>
 #include <sys/stat.h>
 #include <sys/syscall.h>
+#include <thread>
 #include <type_traits>
 #include <unistd.h>
 #include <unordered_map>
@@ -159,6 +164,12 @@ namespace FEXCore::Context {
       HostFeatures.SupportsAVX = false;
     }
 
+    if (Config.SoftwareCrypto) {
+      HostFeatures.EmulateAES = !HostFeatures.SupportsAES;
+      HostFeatures.EmulateCRC = !HostFeatures.SupportsCRC;
+      HostFeatures.EmulatePMULL_128Bit = !HostFeatures.SupportsPMULL_128Bit;
+    }
+
     if (Config.BlockJITNaming() ||
         Config.GlobalJITNaming() ||
         Config.LibraryJITNaming()) {
@@ -201,9 +212,8 @@ namespace FEXCore::Context {
       xmm[2] = 0xDEADCAFEULL;
       xmm[3] = 0xBAD2CAD3ULL;
     }
-    memset(NewThreadState.flags, 0, Core::CPUState::NUM_EFLAG_BITS);
-    NewThreadState.flags[1] = 1;
-    NewThreadState.flags[9] = 1;
+    // Reserved bit 1 and IF
+    NewThreadState.SetEFLAGS(0x202);
     NewThreadState.FCW = 0x37F;
     NewThreadState.FTW = 0xFFFF;
     return NewThreadState;
@@ -238,6 +248,8 @@ namespace FEXCore::Context {
     }
 
     DispatcherConfig.StaticRegisterAllocation = Config.StaticRegisterAllocation && BackendFeatures.SupportsStaticRegisterAllocation;
+    DispatcherConfig.CountExits = Config.GuestProfiler();
+    DispatcherConfig.SafepointPolling = Config.SafepointPolling;
 
 #if JIT_ARM64
     Dispatcher = FEXCore::CPU::Dispatcher::CreateArm64(this, DispatcherConfig);
@@ -255,6 +267,14 @@ namespace FEXCore::Context {
 
     SignalDelegation->RegisterHostSignalHandler(SignalDelegator::SIGNAL_FOR_PAUSE, PauseHandler, true);
 
+    if (Config.GuestProfiler()) {
+      auto ProfilerHandler = [](FEXCore::Core::InternalThreadState *Thread, int Signal, void *info, void *ucontext) -> bool {
+        return Thread->Profiler && Thread->Profiler->HandleSample(static_cast<siginfo_t*>(info), ucontext);
+      };
+
+      SignalDelegation->RegisterHostSignalHandler(SignalDelegator::SIGNAL_FOR_PROFILER, ProfilerHandler, true);
+    }
+
     auto GuestSignalHandler = [](FEXCore::Core::InternalThreadState *Thread, int Signal, void *info, void *ucontext, GuestSigAction *GuestAction, stack_t *GuestStack) -> bool {
       return Thread->CTX->Dispatcher->HandleGuestSignal(Thread, Signal, info, ucontext, GuestAction, GuestStack);
     };
@@ -344,10 +364,44 @@ namespace FEXCore::Context {
 
     // Tell all the threads that they should pause
     std::lock_guard<std::mutex> lk(ThreadCreationMutex);
+    std::vector<FEXCore::Core::InternalThreadState*> SafepointThreads;
     for (auto &Thread : Threads) {
       Thread->SignalReason.store(FEXCore::Core::SignalEvent::Pause);
       if (Thread->RunningEvents.Running.load()) {
         // Only attempt to stop this thread if it is running
+        if (Config.SafepointPolling) {
+          SafepointThreads.emplace_back(Thread);
+        }
+        else {
+          FHU::Syscalls::tgkill(Thread->ThreadManager.PID, Thread->ThreadManager.TID, SignalDelegator::SIGNAL_FOR_PAUSE);
+        }
+      }
+    }
+
+    RequestSafepoint(SafepointThreads);
+  }
+
+  void Context::RequestSafepoint(std::vector<FEXCore::Core::InternalThreadState*> const &Targets) {
+    const pid_t tid = FHU::Syscalls::gettid();
+
+    for (auto Thread : Targets) {
+      Thread->CurrentFrame->SafepointRequest.store(1);
+    }
+
+    // Threads that are sleeping, blocked in a syscall or calling this won't reach a safepoint
+    // Whichever thread takes the request first handles it, so only signal the threads whose request is still pending
+    const auto Deadline = std::chrono::steady_clock::now() + SAFEPOINT_TIMEOUT;
+    for (auto Thread : Targets) {
+      auto Frame = Thread->CurrentFrame;
+      if (Thread->ThreadManager.TID != tid) {
+        while (Frame->SafepointRequest.load() &&
+               !Thread->RunningEvents.ThreadSleeping.load() &&
+               std::chrono::steady_clock::now() < Deadline) {
+          std::this_thread::yield();
+        }
+      }
+
+      if (Frame->SafepointRequest.exchange(0)) {
         FHU::Syscalls::tgkill(Thread->ThreadManager.PID, Thread->ThreadManager.TID, SignalDelegator::SIGNAL_FOR_PAUSE);
       }
     }
@@ -417,6 +471,7 @@ namespace FEXCore::Context {
     // Tell all the threads that they should stop
     {
       std::lock_guard<std::mutex> lk(ThreadCreationMutex);
+      std::vector<FEXCore::Core::InternalThreadState*> SafepointThreads;
       for (auto &Thread : Threads) {
         if (IgnoreCurrentThread &&
             Thread->ThreadManager.TID == tid) {
@@ -430,7 +485,15 @@ namespace FEXCore::Context {
           continue;
         }
         if (Thread->RunningEvents.Running.load()) {
-          StopThread(Thread);
+          if (Config.SafepointPolling) {
+            if (Thread->RunningEvents.Running.exchange(false)) {
+              Thread->SignalReason.store(FEXCore::Core::SignalEvent::Stop);
+              SafepointThreads.emplace_back(Thread);
+            }
+          }
+          else {
+            StopThread(Thread);
+          }
         }
 
         // If the thread is waiting to start but immediately killed then there can be a hang
@@ -440,6 +503,8 @@ namespace FEXCore::Context {
           Thread->StartRunning.NotifyAll();
         }
       }
+
+      RequestSafepoint(SafepointThreads);
     }
 
     // Stop the current thread now if we aren't ignoring it
@@ -544,6 +609,19 @@ namespace FEXCore::Context {
     Thread->LookupCache = std::make_unique<FEXCore::LookupCache>(this);
     Thread->FrontendDecoder = std::make_unique<FEXCore::Frontend::Decoder>(this);
     Thread->PassManager = std::make_unique<FEXCore::IR::PassManager>();
+    Thread->DebugStore = std::make_unique<FEXCore::DebugMetadataStore>();
+
+    // Entry counters are baked in to the JIT code as host pointers, which can't be shared through any of the caches
+    if (Config.TierUpThreshold &&
+        !Config.AOTIRCapture() &&
+        !Config.AOTIRGenerate() &&
+        Config.CacheObjectCodeCompilation() == FEXCore::Config::ConfigObjectCodeHandler::CONFIG_NONE) {
+      Thread->TierData = std::make_unique<FEXCore::BlockTierData>();
+    }
+
+    if (Config.GuestProfiler()) {
+      Thread->Profiler = std::make_unique<FEXCore::GuestProfiler>(this);
+    }
     Thread->PassManager->RegisterExitHandler([this]() {
         Stop(false /* Ignore current thread */);
     });
@@ -666,6 +744,10 @@ namespace FEXCore::Context {
     // We now only have one thread
     IdleWaitRefCount = 1;
 
+    if (LiveThread->Profiler) {
+      LiveThread->Profiler->RestartAfterFork();
+    }
+
     // Clean up dead stacks
     FEXCore::Threads::Thread::CleanupAfterFork();
   }
@@ -674,6 +756,17 @@ namespace FEXCore::Context {
     Thread->LookupCache->AddBlockMapping(Address, Ptr);
   }
 
+  void Context::MergeUnalignedAccesses(FEXCore::Core::InternalThreadState *Thread) {
+    auto &Pending = Thread->PendingUnalignedAccesses;
+
+    for (uint32_t i = 0; i < Pending.Count; ++i) {
+      UnalignedAccesses.Insert(Pending.RIPs[i]);
+      IRCaptureCache.RecordUnalignedAccess(Pending.RIPs[i]);
+    }
+
+    Pending.Count = 0;
+  }
+
   void Context::ClearCodeCache(FEXCore::Core::InternalThreadState *Thread) {
     FEXCORE_PROFILE_INSTANT("ClearCodeCache");
 
@@ -684,9 +777,42 @@ namespace FEXCore::Context {
     }
     std::lock_guard<std::recursive_mutex> lk(Thread->LookupCache->WriteLock);
 
+    if (Thread->Profiler) {
+      Thread->Profiler->ClearBlocks();
+    }
+
     Thread->LookupCache->ClearCache();
     Thread->CPUBackend->ClearCache();
-    Thread->DebugStore.clear();
+    Thread->DebugStore->Clear();
+  }
+
+  void Context::ClearCodeRegion(FEXCore::Core::InternalThreadState *Thread) {
+    if (!Thread->CPUBackend->NextCodeRegion()) {
+      ClearCodeCache(Thread);
+      return;
+    }
+
+    FEXCORE_PROFILE_INSTANT("ClearCodeRegion");
+
+    {
+      // Same as ClearCodeCache, serialization might still be reading code from this region
+      CodeSerialize::CodeObjectSerializeService::WaitForEmptyJobQueue(&Thread->ObjectCacheRefCounter);
+    }
+    std::lock_guard<std::recursive_mutex> lk(Thread->LookupCache->WriteLock);
+
+    const auto &Region = Thread->CPUBackend->GetCurrentCodeRegion();
+    const auto Start = reinterpret_cast<uintptr_t>(Region.Ptr);
+    const auto End = Start + Region.Size;
+
+    if (Thread->Profiler) {
+      Thread->Profiler->EraseBlocks(Start, End);
+    }
+
+    for (auto GuestRIP : Thread->LookupCache->EraseHostRange(Start, End)) {
+      Thread->DebugStore->Erase(GuestRIP);
+    }
+
+    Thread->CPUBackend->ResetCodeRegion();
   }
 
   static void IRDumper(FEXCore::Core::InternalThreadState *Thread, IR::IREmitter *IREmitter, uint64_t GuestRIP, IR::RegisterAllocationData* RA) {
@@ -722,7 +848,7 @@ namespace FEXCore::Context {
   static void ValidateIR(FEXCore::Context::Context *ctx, IR::IREmitter *IREmitter) {
     // Convert to text, Parse, Convert to text again and make sure the texts match
     std::stringstream out;
-    static auto compaction = IR::CreateIRCompaction(ctx->OpDispatcherAllocator);
+    static auto compaction = IR::CreateIRCompaction();
     compaction->Run(IREmitter);
     auto NewIR = IREmitter->ViewIR();
     Dump(&out, &NewIR, nullptr);
@@ -752,6 +878,17 @@ namespace FEXCore::Context {
     uint64_t TotalInstructions {0};
     uint64_t TotalInstructionsLength {0};
 
+    // Stage timing for FEXBench
+    auto CompileStats = Thread->CompileStats.get();
+    auto StageStart = CompileStats ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point{};
+    auto StageTime = [&StageStart]() -> uint64_t {
+      const auto Now = std::chrono::steady_clock::now();
+      const auto Time = std::chrono::duration_cast<std::chrono::nanoseconds>(Now - StageStart).count();
+      StageStart = Now;
+      return Time;
+    };
+
+    bool HotRegion {false};
 
     std::shared_lock lk(CustomIRMutex);
 
@@ -761,6 +898,10 @@ namespace FEXCore::Context {
       TotalInstructionsLength = 1;
       std::get<0>(Handler->second)(GuestRIP, Thread->OpDispatcher.get());
       lk.unlock();
+
+      if (CompileStats) {
+        CompileStats->DispatchNS += StageTime();
+      }
     } else {
       lk.unlock();
       uint8_t const *GuestCode{};
@@ -768,6 +909,26 @@ namespace FEXCore::Context {
 
       bool HadDispatchError {false};
 
+      // Blocks that have reached the tier-up threshold get recompiled as a hot multiblock region
+      // built from the edges and indirect targets their profile saw
+      // Everything else gets profiled
+      FEXCore::BlockTierData::BlockProfile *TierProfile {};
+      FEXCore::BlockTierData::HotRegionInfo Region {};
+      if (Thread->TierData) {
+        HotRegion = Thread->TierData->IsHot(GuestRIP, Config.TierUpThreshold);
+        if (HotRegion) {
+          Thread->TierData->FormRegion(GuestRIP, &Region);
+        }
+        else {
+          TierProfile = Thread->TierData->GetProfile(GuestRIP);
+        }
+      }
+
+      Thread->FrontendDecoder->SetHotRegion(HotRegion ? &Region : nullptr);
+      Thread->OpDispatcher->SetHotRegion(HotRegion ? &Region : nullptr);
+      Thread->OpDispatcher->SetTierProfile(Thread->TierData.get(), TierProfile);
+      Thread->OpDispatcher->SetMultiblock(Config.Multiblock || HotRegion);
+
       Thread->FrontendDecoder->DecodeInstructionsAtEntry(GuestCode, GuestRIP, [Thread](uint64_t BlockEntry, uint64_t Start, uint64_t Length) {
         if (Thread->LookupCache->AddBlockExecutableRange(BlockEntry, Start, Length)) {
           Thread->CTX->SyscallHandler->MarkGuestExecutableRange(Start, Length);
@@ -776,6 +937,10 @@ namespace FEXCore::Context {
 
       auto CodeBlocks = Thread->FrontendDecoder->GetDecodedBlocks();
 
+      if (CompileStats) {
+        CompileStats->DecodeNS += StageTime();
+      }
+
       Thread->OpDispatcher->BeginFunction(GuestRIP, CodeBlocks);
 
       const uint8_t GPRSize = GetGPRSize();
@@ -797,6 +962,62 @@ namespace FEXCore::Context {
           Thread->OpDispatcher->_StoreContext(GPRSize, IR::GPRClass, NewRIP, offsetof(FEXCore::Core::CPUState, rip));
         }
 
+        if (Config.SafepointPolling) {
+          // Every linked exit and backward branch lands on a block start, so polling here bounds how long a thread can run without seeing a request
+          Thread->OpDispatcher->_Safepoint(Block.Entry - GuestRIP);
+        }
+
+        if (Config.SMCChecks == FEXCore::Config::CONFIG_SMC_FULL) {
+          // Validate the whole block once on entry, like with mtrack a store that rewrites
+          // a later instruction of the running block is only seen on the next entry
+          uint32_t BlockCodeLength {};
+          for (size_t i = 0; i < Block.NumInstructions; ++i) {
+            BlockCodeLength += Block.DecodedInstructions[i].InstSize;
+          }
+
+          const auto BlockCode = reinterpret_cast<uint8_t const*>(Block.Entry);
+          auto CodeChanged = Thread->OpDispatcher->_ValidateCode(Block.Entry - GuestRIP, BlockCodeLength, CodeHash::Hash(BlockCode, BlockCodeLength));
+
+          auto InvalidateCodeCond = Thread->OpDispatcher->_CondJump(CodeChanged);
+
+          auto CurrentBlock = Thread->OpDispatcher->GetCurrentBlock();
+          auto CodeWasChangedBlock = Thread->OpDispatcher->CreateNewCodeBlockAtEnd();
+          Thread->OpDispatcher->SetTrueJumpTarget(InvalidateCodeCond, CodeWasChangedBlock);
+
+          Thread->OpDispatcher->SetCurrentCodeBlock(CodeWasChangedBlock);
+          Thread->OpDispatcher->_ThreadRemoveCodeEntry();
+          Thread->OpDispatcher->_ExitFunction(Thread->OpDispatcher->_EntrypointOffset(Block.Entry - GuestRIP, GPRSize));
+
+          auto NextOpBlock = Thread->OpDispatcher->CreateNewCodeBlockAfter(CurrentBlock);
+
+          Thread->OpDispatcher->SetFalseJumpTarget(InvalidateCodeCond, NextOpBlock);
+          Thread->OpDispatcher->SetCurrentCodeBlock(NextOpBlock);
+        }
+
+        if (TierProfile && Block.Entry == GuestRIP) {
+          // Count entries and bail out to the dispatcher for a recompile once the block is hot
+          auto CounterPtr = Thread->OpDispatcher->_Constant(reinterpret_cast<uint64_t>(&TierProfile->Entries));
+          auto Count = Thread->OpDispatcher->_LoadMem(IR::GPRClass, 4, CounterPtr, 4);
+          auto NewCount = Thread->OpDispatcher->_Add(Count, Thread->OpDispatcher->_Constant(1));
+          Thread->OpDispatcher->_StoreMem(IR::GPRClass, 4, CounterPtr, NewCount, 4);
+
+          auto TierUpCond = Thread->OpDispatcher->_CondJump(NewCount, Thread->OpDispatcher->_Constant(Config.TierUpThreshold),
+            Thread->OpDispatcher->Invalid(), Thread->OpDispatcher->Invalid(), {IR::COND_UGE}, 4);
+
+          auto CurrentBlock = Thread->OpDispatcher->GetCurrentBlock();
+          auto TierUpBlock = Thread->OpDispatcher->CreateNewCodeBlockAtEnd();
+          Thread->OpDispatcher->SetTrueJumpTarget(TierUpCond, TierUpBlock);
+
+          Thread->OpDispatcher->SetCurrentCodeBlock(TierUpBlock);
+          Thread->OpDispatcher->_ThreadRemoveCodeEntry();
+          Thread->OpDispatcher->_ExitFunction(Thread->OpDispatcher->_EntrypointOffset(0, GPRSize));
+
+          auto NextOpBlock = Thread->OpDispatcher->CreateNewCodeBlockAfter(CurrentBlock);
+
+          Thread->OpDispatcher->SetFalseJumpTarget(TierUpCond, NextOpBlock);
+          Thread->OpDispatcher->SetCurrentCodeBlock(NextOpBlock);
+        }
+
         uint64_t InstsInBlock = Block.NumInstructions;
 
         for (size_t i = 0; i < InstsInBlock; ++i) {
@@ -811,30 +1032,10 @@ namespace FEXCore::Context {
             Thread->OpDispatcher->_GuestOpcode(Block.Entry + BlockInstructionsLength - GuestRIP);
           }
 
-          if (Config.SMCChecks == FEXCore::Config::CONFIG_SMC_FULL) {
-            auto ExistingCodePtr = reinterpret_cast<uint64_t*>(Block.Entry + BlockInstructionsLength);
-
-            auto CodeChanged = Thread->OpDispatcher->_ValidateCode(ExistingCodePtr[0], ExistingCodePtr[1], (uintptr_t)ExistingCodePtr - GuestRIP, DecodedInfo->InstSize);
-
-            auto InvalidateCodeCond = Thread->OpDispatcher->_CondJump(CodeChanged);
-
-            auto CurrentBlock = Thread->OpDispatcher->GetCurrentBlock();
-            auto CodeWasChangedBlock = Thread->OpDispatcher->CreateNewCodeBlockAtEnd();
-            Thread->OpDispatcher->SetTrueJumpTarget(InvalidateCodeCond, CodeWasChangedBlock);
-
-            Thread->OpDispatcher->SetCurrentCodeBlock(CodeWasChangedBlock);
-            Thread->OpDispatcher->_ThreadRemoveCodeEntry();
-            Thread->OpDispatcher->_ExitFunction(Thread->OpDispatcher->_EntrypointOffset(Block.Entry + BlockInstructionsLength - GuestRIP, GPRSize));
-
-            auto NextOpBlock = Thread->OpDispatcher->CreateNewCodeBlockAfter(CurrentBlock);
-
-            Thread->OpDispatcher->SetFalseJumpTarget(InvalidateCodeCond, NextOpBlock);
-            Thread->OpDispatcher->SetCurrentCodeBlock(NextOpBlock);
-          }
-
           if (TableInfo && TableInfo->OpcodeDispatcher) {
             auto Fn = TableInfo->OpcodeDispatcher;
             Thread->OpDispatcher->HandledLock = false;
+            Thread->OpDispatcher->CurrentInstructionRIP = DecodedInfo->PC;
             Thread->OpDispatcher->ResetDecodeFailure();
             std::invoke(Fn, Thread->OpDispatcher, DecodedInfo);
             if (Thread->OpDispatcher->HadDecodeFailure()) {
@@ -862,6 +1063,9 @@ namespace FEXCore::Context {
           // If we had a dispatch error then leave early
           if (HadDispatchError && TotalInstructions == 0) {
             // Couldn't handle any instruction in op dispatcher
+            Thread->FrontendDecoder->SetHotRegion(nullptr);
+            Thread->OpDispatcher->SetHotRegion(nullptr);
+            Thread->OpDispatcher->SetTierProfile(nullptr, nullptr);
             Thread->OpDispatcher->ResetWorkingList();
             return { nullptr, nullptr, 0, 0, 0, 0 };
           }
@@ -883,7 +1087,16 @@ namespace FEXCore::Context {
 
       Thread->OpDispatcher->Finalize();
 
+      // The region only lives for this compile
+      Thread->FrontendDecoder->SetHotRegion(nullptr);
+      Thread->OpDispatcher->SetHotRegion(nullptr);
+      Thread->OpDispatcher->SetTierProfile(nullptr, nullptr);
+
       Thread->FrontendDecoder->DelayedDisownBuffer();
+
+      if (CompileStats) {
+        CompileStats->DispatchNS += StageTime();
+      }
     }
 
     IR::IREmitter *IREmitter = Thread->OpDispatcher.get();
@@ -900,8 +1113,13 @@ namespace FEXCore::Context {
       }
     }
 
+    // With tiering, code that hasn't proven hot yet gets the cheaper linear scan allocator
+    if (Thread->TierData && Thread->PassManager->HasPass("RA")) {
+      Thread->PassManager->GetPass<IR::RegisterAllocationPass>("RA")->SetLinearScan(!HotRegion);
+    }
+
     // Run the passmanager over the IR from the dispatcher
-    Thread->PassManager->Run(IREmitter);
+    Thread->PassManager->Run(IREmitter, CompileStats);
 
     // Debug
     {
@@ -976,7 +1194,7 @@ namespace FEXCore::Context {
 
     if (IRList == nullptr) {
       // Generate IR + Meta Info
-      auto [IRCopy, RACopy, TotalInstructions, TotalInstructionsLength, _StartAddr, _Length] = GenerateIR(Thread, GuestRIP, Config.GDBSymbols());
+      auto [IRCopy, RACopy, TotalInstructions, TotalInstructionsLength, _StartAddr, _Length] = GenerateIR(Thread, GuestRIP, Config.GDBSymbols() || Config.GuestProfiler());
 
       // Setup pointers to internal structures
       IRList = IRCopy;
@@ -987,6 +1205,10 @@ namespace FEXCore::Context {
 
       // Increment stats
       Thread->Stats.BlocksCompiled.fetch_add(1);
+      if (Thread->CompileStats) {
+        ++Thread->CompileStats->BlocksCompiled;
+        Thread->CompileStats->GuestInstructions += TotalInstructions;
+      }
 
       // These blocks aren't already in the cache
       GeneratedIR = true;
@@ -995,9 +1217,19 @@ namespace FEXCore::Context {
     if (IRList == nullptr) {
       return {};
     }
+
+    const auto BackendStart = Thread->CompileStats ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point{};
+
     // Attempt to get the CPU backend to compile this code
+    auto CompiledCode = Thread->CPUBackend->CompileCode(GuestRIP, IRList, DebugData, RAData.get(), GetGdbServerStatus());
+
+    if (Thread->CompileStats) {
+      Thread->CompileStats->BackendNS += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - BackendStart).count();
+      Thread->CompileStats->HostCodeBytes += DebugData ? DebugData->HostCodeSize : 0;
+    }
+
     return {
-      .CompiledCode = Thread->CPUBackend->CompileCode(GuestRIP, IRList, DebugData, RAData.get(), GetGdbServerStatus()),
+      .CompiledCode = CompiledCode,
       .IRData = IRList,
       .DebugData = DebugData,
       .RAData = std::move(RAData),
@@ -1031,6 +1263,11 @@ namespace FEXCore::Context {
       return HostCode;
     }
 
+    // Make sure anything this thread backpatched since its last compile is visible to the OpcodeDispatcher
+    if (Thread->PendingUnalignedAccesses.Count) {
+      MergeUnalignedAccesses(Thread);
+    }
+
     void *CodePtr {};
     FEXCore::IR::IRListView *IRList {};
     FEXCore::Core::DebugData *DebugData {};
@@ -1038,7 +1275,23 @@ namespace FEXCore::Context {
     bool GeneratedIR {};
     uint64_t StartAddr {}, Length {};
 
+    const bool HotRegion = Thread->TierData && Thread->TierData->IsHot(GuestRIP, Config.TierUpThreshold);
+    const auto CompileStart = std::chrono::steady_clock::now();
+
     auto [Code, IR, Data, RAData, Generated, _StartAddr, _Length] = CompileCode(Thread, GuestRIP);
+
+    if (Thread->TierData) {
+      const auto CompileTime = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - CompileStart).count();
+      auto &Stats = Thread->TierData->Stats;
+      if (HotRegion) {
+        ++Stats.HotBlocksCompiled;
+        Stats.HotCompileTimeNS += CompileTime;
+      }
+      else {
+        ++Stats.ColdBlocksCompiled;
+        Stats.ColdCompileTimeNS += CompileTime;
+      }
+    }
     CodePtr = Code;
     IRList = IR;
     DebugData = Data;
@@ -1050,6 +1303,10 @@ namespace FEXCore::Context {
       return 0;
     }
 
+    if (Thread->Profiler && DebugData) {
+      Thread->Profiler->AddBlock(GuestRIP, reinterpret_cast<uintptr_t>(CodePtr), DebugData);
+    }
+
     // The core managed to compile the code.
     if (Config.BlockJITNaming()) {
       auto FragmentBasePtr = reinterpret_cast<uint8_t *>(CodePtr);
@@ -1141,8 +1398,16 @@ namespace FEXCore::Context {
 
       Thread->RunningEvents.Running = true;
 
+      if (Thread->Profiler) {
+        Thread->Profiler->Start();
+      }
+
       Thread->CTX->Dispatcher->ExecuteDispatch(Thread->CurrentFrame);
 
+      if (Thread->Profiler) {
+        Thread->Profiler->Stop();
+      }
+
       Thread->RunningEvents.Running = false;
     }
 
@@ -1152,6 +1417,39 @@ namespace FEXCore::Context {
       CodeSerialize::CodeObjectSerializeService::WaitForEmptyJobQueue(&Thread->ObjectCacheRefCounter);
     }
 
+    if (Config.IndirectBranchStats()) {
+      auto Sites = Thread->LookupCache->IndirectBranchSites;
+      uint64_t TotalHits{}, TotalMisses{};
+      for (auto &Site : Sites) {
+        TotalHits += Site.Hits;
+        TotalMisses += Site.Misses;
+      }
+
+      LogMan::Msg::IFmt("Indirect branch caches: {} sites, {} hits, {} misses", Sites.size(), TotalHits, TotalMisses);
+
+      constexpr size_t MaxSitesToLog = 10;
+      const auto SitesToLog = std::min(Sites.size(), MaxSitesToLog);
+      std::partial_sort(Sites.begin(), Sites.begin() + SitesToLog, Sites.end(), [](auto &a, auto &b) {
+        return a.Misses > b.Misses;
+      });
+
+      for (size_t i = 0; i < SitesToLog; ++i) {
+        LogMan::Msg::IFmt("\tBlock 0x{:x}: {} hits, {} misses", Sites[i].BlockRIP, Sites[i].Hits, Sites[i].Misses);
+      }
+    }
+
+    if (Thread->TierData) {
+      auto &Stats = Thread->TierData->Stats;
+      LogMan::Msg::DFmt("Tier stats: {} cold blocks in {}us, {} hot regions in {}us, {} profiled block entries",
+        Stats.ColdBlocksCompiled, Stats.ColdCompileTimeNS / 1000,
+        Stats.HotBlocksCompiled, Stats.HotCompileTimeNS / 1000,
+        Thread->TierData->GetProfiledEntries());
+    }
+
+    if (Thread->Profiler) {
+      Thread->Profiler->WriteReport(Thread->CurrentFrame, Thread->ThreadManager.TID);
+    }
+
     // If it is the parent thread that died then just leave
     FEX_TODO("This doesn't make sense when the parent thread doesn't outlive its children");
 
@@ -1223,9 +1521,10 @@ namespace FEXCore::Context {
         // Only the lookup cache is cleared here, so that old code can keep running until next compilation
         std::lock_guard<std::recursive_mutex> lkLookupCache(Thread->LookupCache->WriteLock);
         Thread->LookupCache->ClearCache();
+        Thread->CPUBackend->DisableCodeRegionEviction();
 
         // DebugStore also needs to be cleared
-        Thread->DebugStore.clear();
+        Thread->DebugStore->Clear();
       }
     }
   }
@@ -1234,10 +1533,42 @@ namespace FEXCore::Context {
     CTX->MarkMemoryShared();
   }
 
-  void Context::ThreadAddBlockLink(FEXCore::Core::InternalThreadState *Thread, uint64_t GuestDestination, uintptr_t HostLink, const std::function<void()> &delinker) {
+  void Context::ThreadAddBlockLink(FEXCore::Core::InternalThreadState *Thread, uint64_t GuestDestination, uintptr_t HostLink, LookupCache::BlockLinkKind Kind, uint64_t Value) {
     std::shared_lock lk(Thread->CTX->CodeInvalidationMutex);
 
-    Thread->LookupCache->AddBlockLink(GuestDestination, HostLink, delinker);
+    Thread->LookupCache->AddBlockLink(GuestDestination, HostLink, Kind, Value);
+  }
+
+  uint64_t Context::ThreadIndirectBranchLink(FEXCore::Core::CpuStateFrame *Frame, uint64_t *record) {
+    auto Thread = Frame->Thread;
+    auto GuestRip = Frame->State.rip;
+    auto Cache = reinterpret_cast<LookupCache::IndirectBranchCacheRecord*>(record);
+
+    auto HostCode = Thread->LookupCache->FindBlock(GuestRip);
+
+    if (!HostCode) {
+      // RIP was already stored by the JIT
+      return Frame->Pointers.Common.DispatcherLoopTop;
+    }
+
+    --Cache->FillsRemaining;
+
+    // Take an empty entry if there is one, otherwise rotate through them
+    auto Begin = std::begin(Cache->Entries);
+    auto End = std::end(Cache->Entries);
+    auto Entry = std::find_if(Begin, End, [](auto &Entry) { return Entry.GuestCode == 0; });
+    if (Entry == End) {
+      Entry = &Cache->Entries[Cache->FillsRemaining % LookupCache::IndirectBranchCacheRecord::NUM_ENTRIES];
+    }
+
+    Entry->GuestCode = 0;
+    Entry->HostCode = HostCode;
+    Entry->GuestCode = GuestRip;
+
+    // Entry might have been refilled with a different target by the time the link is undone
+    ThreadAddBlockLink(Thread, GuestRip, reinterpret_cast<uintptr_t>(Entry), LookupCache::BlockLinkKind::IndirectBranchEntry, 0);
+
+    return HostCode;
   }
 
   void Context::ThreadRemoveCodeEntry(FEXCore::Core::InternalThreadState *Thread, uint64_t GuestRIP) {
@@ -1245,7 +1576,7 @@ namespace FEXCore::Context {
 
     std::lock_guard<std::recursive_mutex> lk(Thread->LookupCache->WriteLock);
 
-    Thread->DebugStore.erase(GuestRIP);
+    Thread->DebugStore->Erase(GuestRIP);
     Thread->LookupCache->Erase(GuestRIP);
   }
 
@@ -1299,13 +1630,13 @@ namespace FEXCore::Context {
 
   bool Context::GetDebugDataForRIP(uint64_t RIP, FEXCore::Core::DebugData *Data) {
     std::lock_guard<std::recursive_mutex> lk(ParentThread->LookupCache->WriteLock);
-    auto it = ParentThread->DebugStore.find(RIP);
-    if (it == ParentThread->DebugStore.end()) {
-      return false;
-    }
+    return ParentThread->DebugStore->GetDebugData(RIP, Data);
+  }
 
-    memcpy(Data, it->second.DebugData.get(), sizeof(FEXCore::Core::DebugData));
-    return true;
+  bool Context::FindIRForRIP(uint64_t RIP, std::vector<uint8_t> *Storage, FEXCore::IR::IRListView **IR) {
+    std::lock_guard<std::recursive_mutex> lk(ParentThread->LookupCache->WriteLock);
+    *IR = ParentThread->DebugStore->GetIR(RIP, *Storage);
+    return *IR != nullptr;
   }
 
   bool Context::FindHostCodeForRIP(uint64_t RIP, uint8_t **Code) {
@@ -1320,6 +1651,7 @@ namespace FEXCore::Context {
 
   uint64_t HandleSyscall(FEXCore::HLE::SyscallHandler *Handler, FEXCore::Core::CpuStateFrame *Frame, FEXCore::HLE::SyscallArguments *Args) {
     uint64_t Result{};
+    ++Frame->ExitCounters.Syscall;
     Result = Handler->HandleSyscall(Frame, Args);
     return Result;
   }
@@ -0,0 +1,234 @@
+#include "Interface/Core/DebugMetadataStore.h"
+
+#include <FEXCore/Debug/InternalThreadState.h>
+#include <FEXCore/IR/IntrusiveIRList.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace FEXCore {
+namespace {
+  void WriteULEB(std::vector<uint8_t> &Out, uint64_t Value) {
+    do {
+      uint8_t Byte = Value & 0x7F;
+      Value >>= 7;
+      if (Value) {
+        Byte |= 0x80;
+      }
+      Out.push_back(Byte);
+    } while (Value);
+  }
+
+  // Zigzag so small negative deltas stay small
+  void WriteSLEB(std::vector<uint8_t> &Out, int64_t Value) {
+    WriteULEB(Out, (static_cast<uint64_t>(Value) << 1) ^ static_cast<uint64_t>(Value >> 63));
+  }
+
+  uint64_t ReadULEB(uint8_t const *&Data) {
+    uint64_t Value{};
+    uint32_t Shift{};
+    uint8_t Byte;
+    do {
+      Byte = *Data++;
+      Value |= static_cast<uint64_t>(Byte & 0x7F) << Shift;
+      Shift += 7;
+    } while (Byte & 0x80);
+    return Value;
+  }
+
+  int64_t ReadSLEB(uint8_t const *&Data) {
+    uint64_t Value = ReadULEB(Data);
+    return static_cast<int64_t>((Value >> 1) ^ -(Value & 1));
+  }
+
+  // Serialized IR is mostly small values in wide fields, so only runs of zero bytes are compressed
+  // Each token byte is either a run of up to 128 zeros (top bit set) or up to 128 literal bytes that follow it
+  constexpr uint8_t ZERO_RUN = 0x80;
+  constexpr size_t MAX_RUN = 128;
+
+  void CompressZeroRuns(std::vector<uint8_t> &Out, uint8_t const *Data, size_t Size) {
+    size_t i = 0;
+    while (i < Size) {
+      size_t Zeros = 0;
+      while (i + Zeros < Size && Data[i + Zeros] == 0 && Zeros < MAX_RUN) {
+        ++Zeros;
+      }
+
+      // A single zero costs less as part of a literal run
+      if (Zeros > 1) {
+        Out.push_back(ZERO_RUN | (Zeros - 1));
+        i += Zeros;
+        continue;
+      }
+
+      size_t Literals = 0;
+      while (i + Literals < Size && Literals < MAX_RUN) {
+        if (Data[i + Literals] == 0 && i + Literals + 1 < Size && Data[i + Literals + 1] == 0) {
+          break;
+        }
+        ++Literals;
+      }
+
+      Out.push_back(Literals - 1);
+      Out.insert(Out.end(), Data + i, Data + i + Literals);
+      i += Literals;
+    }
+  }
+
+  void DecompressZeroRuns(uint8_t *Out, size_t OutSize, uint8_t const *Data) {
+    size_t i = 0;
+    while (i < OutSize) {
+      const uint8_t Token = *Data++;
+      const size_t Run = std::min<size_t>((Token & ~ZERO_RUN) + 1, OutSize - i);
+      if (Token & ZERO_RUN) {
+        memset(&Out[i], 0, Run);
+      }
+      else {
+        memcpy(&Out[i], Data, Run);
+        Data += Run;
+      }
+      i += Run;
+    }
+  }
+
+  struct RecordHeader {
+    uint64_t StartAddr;
+    uint64_t Length;
+    uint64_t HostCodeSize;
+    uint64_t NumSubblocks;
+    uint64_t NumGuestOpcodes;
+    uint64_t IRSize;
+  };
+
+  // Reads the fixed fields and leaves Data pointing at the subblock table
+  RecordHeader ReadHeader(uint8_t const *&Data) {
+    RecordHeader Header{};
+    Header.StartAddr = ReadULEB(Data);
+    Header.Length = ReadULEB(Data);
+    Header.HostCodeSize = ReadULEB(Data);
+    Header.NumSubblocks = ReadULEB(Data);
+    Header.NumGuestOpcodes = ReadULEB(Data);
+    Header.IRSize = ReadULEB(Data);
+    return Header;
+  }
+}
+
+  uint8_t *DebugMetadataStore::Allocate(size_t Size) {
+    if (Chunks.empty() || Chunks.back().Size - Chunks.back().Used < Size) {
+      const size_t ChunkSize = std::max(CHUNK_SIZE, Size);
+      Chunks.push_back({std::make_unique<uint8_t[]>(ChunkSize), ChunkSize, 0});
+    }
+
+    auto &Current = Chunks.back();
+    uint8_t *Result = &Current.Data[Current.Used];
+    Current.Used += Size;
+    UsedSize += Size;
+    return Result;
+  }
+
+  void DebugMetadataStore::Insert(uint64_t GuestRIP, uint64_t StartAddr, uint64_t Length,
+                                  FEXCore::Core::DebugData const *DebugData, FEXCore::IR::IRListView const *IR) {
+    Scratch.clear();
+
+    const size_t IRSize = IR ? IR->GetInlineSize() : 0;
+
+    WriteULEB(Scratch, StartAddr);
+    WriteULEB(Scratch, Length);
+    WriteULEB(Scratch, DebugData ? DebugData->HostCodeSize : 0);
+    WriteULEB(Scratch, DebugData ? DebugData->Subblocks.size() : 0);
+    WriteULEB(Scratch, DebugData ? DebugData->GuestOpcodes.size() : 0);
+    WriteULEB(Scratch, IRSize);
+
+    if (DebugData) {
+      for (auto const &Subblock : DebugData->Subblocks) {
+        WriteULEB(Scratch, Subblock.HostCodeOffset);
+        WriteULEB(Scratch, Subblock.HostCodeSize);
+      }
+
+      // Both offsets mostly increase with each instruction, store the deltas
+      uint64_t PreviousGuest{};
+      int64_t PreviousHost{};
+      for (auto const &Opcode : DebugData->GuestOpcodes) {
+        WriteSLEB(Scratch, static_cast<int64_t>(Opcode.GuestEntryOffset - PreviousGuest));
+        WriteSLEB(Scratch, Opcode.HostEntryOffset - PreviousHost);
+        PreviousGuest = Opcode.GuestEntryOffset;
+        PreviousHost = Opcode.HostEntryOffset;
+      }
+    }
+
+    if (IR) {
+      SerializedIR.resize(IRSize);
+      IR->Serialize(SerializedIR.data());
+      CompressZeroRuns(Scratch, SerializedIR.data(), IRSize);
+    }
+
+    uint8_t *Record = Allocate(Scratch.size());
+    memcpy(Record, Scratch.data(), Scratch.size());
+    Index.insert_or_assign(GuestRIP, Record);
+  }
+
+  void DebugMetadataStore::Erase(uint64_t GuestRIP) {
+    Index.erase(GuestRIP);
+  }
+
+  void DebugMetadataStore::Clear() {
+    Index.clear();
+    Chunks.clear();
+    UsedSize = 0;
+  }
+
+  bool DebugMetadataStore::GetDebugData(uint64_t GuestRIP, FEXCore::Core::DebugData *Data) const {
+    auto it = Index.find(GuestRIP);
+    if (it == Index.end()) {
+      return false;
+    }
+
+    uint8_t const *Record = it->second;
+    const auto Header = ReadHeader(Record);
+
+    Data->HostCodeSize = Header.HostCodeSize;
+    Data->Relocations = nullptr;
+
+    Data->Subblocks.resize(Header.NumSubblocks);
+    for (auto &Subblock : Data->Subblocks) {
+      Subblock.HostCodeOffset = ReadULEB(Record);
+      Subblock.HostCodeSize = ReadULEB(Record);
+    }
+
+    uint64_t Guest{};
+    int64_t Host{};
+    Data->GuestOpcodes.resize(Header.NumGuestOpcodes);
+    for (auto &Opcode : Data->GuestOpcodes) {
+      Guest += ReadSLEB(Record);
+      Host += ReadSLEB(Record);
+      Opcode.GuestEntryOffset = Guest;
+      Opcode.HostEntryOffset = Host;
+    }
+
+    return true;
+  }
+
+  FEXCore::IR::IRListView *DebugMetadataStore::GetIR(uint64_t GuestRIP, std::vector<uint8_t> &Storage) const {
+    auto it = Index.find(GuestRIP);
+    if (it == Index.end()) {
+      return nullptr;
+    }
+
+    uint8_t const *Record = it->second;
+    const auto Header = ReadHeader(Record);
+    if (Header.IRSize == 0) {
+      return nullptr;
+    }
+
+    // Skip over the PC tables
+    for (uint64_t i = 0; i < Header.NumSubblocks * 2 + Header.NumGuestOpcodes * 2; ++i) {
+      ReadULEB(Record);
+    }
+
+    Storage.resize(Header.IRSize);
+    DecompressZeroRuns(Storage.data(), Header.IRSize, Record);
+
+    // Serialized IR is a shared IRListView with its data inline
+    return reinterpret_cast<FEXCore::IR::IRListView*>(Storage.data());
+  }
+}
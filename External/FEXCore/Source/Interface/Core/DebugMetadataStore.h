@@ -0,0 +1,70 @@
+#pragma once
+
+#include <tsl/robin_map.h>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace FEXCore::Core {
+  struct DebugData;
+}
+
+namespace FEXCore::IR {
+  class IRListView;
+}
+
+namespace FEXCore {
+/**
+ * @brief Per-thread debug metadata for compiled blocks, kept while the GDB server is active
+ *
+ * Records are appended in to large chunks instead of keeping an IRListView copy, RA data and DebugData allocation per block.
+ * Each record holds the block's guest range, its subblock and guest to host PC tables LEB128 delta encoded,
+ * and optionally the block's serialized IR with runs of zero bytes compressed out.
+ * Everything is decoded on demand.
+ *
+ * Erasing a block only drops it from the index, the space is reclaimed once the whole store is cleared with the code cache.
+ * Callers must hold the thread's LookupCache WriteLock.
+ */
+class DebugMetadataStore final {
+public:
+  void Insert(uint64_t GuestRIP, uint64_t StartAddr, uint64_t Length,
+              FEXCore::Core::DebugData const *DebugData, FEXCore::IR::IRListView const *IR);
+  void Erase(uint64_t GuestRIP);
+  void Clear();
+
+  bool Contains(uint64_t GuestRIP) const {
+    return Index.contains(GuestRIP);
+  }
+
+  // Fills in HostCodeSize, Subblocks and GuestOpcodes, Relocations is left as nullptr
+  bool GetDebugData(uint64_t GuestRIP, FEXCore::Core::DebugData *Data) const;
+
+  // Decompresses the block's IR in to Storage, returns nullptr if the block didn't keep its IR
+  FEXCore::IR::IRListView *GetIR(uint64_t GuestRIP, std::vector<uint8_t> &Storage) const;
+
+  // Bytes used by records, including erased ones
+  size_t GetUsedSize() const {
+    return UsedSize;
+  }
+
+private:
+  constexpr static size_t CHUNK_SIZE = 256 * 1024;
+
+  struct Chunk {
+    std::unique_ptr<uint8_t[]> Data;
+    size_t Size;
+    size_t Used;
+  };
+
+  uint8_t *Allocate(size_t Size);
+
+  std::vector<Chunk> Chunks;
+  tsl::robin_map<uint64_t, uint8_t const*> Index;
+  size_t UsedSize{};
+
+  // Reused between inserts so encoding doesn't allocate per block
+  std::vector<uint8_t> Scratch;
+  std::vector<uint8_t> SerializedIR;
+};
+}
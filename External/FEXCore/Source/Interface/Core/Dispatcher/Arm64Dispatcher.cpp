@@ -38,7 +38,7 @@ namespace FEXCore::CPU {
 using namespace vixl;
 using namespace vixl::aarch64;
 
-constexpr size_t MAX_DISPATCHER_CODE_SIZE = 4096;
+constexpr size_t MAX_DISPATCHER_CODE_SIZE = 8192;
 
 Arm64Dispatcher::Arm64Dispatcher(FEXCore::Context::Context *ctx, const DispatcherConfig &config)
   : FEXCore::CPU::Dispatcher(ctx, config), Arm64Emitter(ctx, MAX_DISPATCHER_CODE_SIZE)
@@ -70,6 +70,7 @@ Arm64Dispatcher::Arm64Dispatcher(FEXCore::Context::Context *ctx, const Dispatche
   Literal l_CTX {reinterpret_cast<uintptr_t>(CTX)};
   Literal l_Sleep {reinterpret_cast<uint64_t>(SleepThread)};
   Literal l_CompileBlock {GetCompileBlockPtr()};
+  Literal l_Safepoint {reinterpret_cast<uint64_t>(HandleSafepoint)};
 
   // Push all the register we need to save
   PushCalleeSavedRegisters();
@@ -97,10 +98,23 @@ Arm64Dispatcher::Arm64Dispatcher(FEXCore::Context::Context *ctx, const Dispatche
   aarch64::Label LoopTop{};
   aarch64::Label ExitSpillSRA{};
   aarch64::Label ThreadPauseHandler{};
+  aarch64::Label Safepoint{};
+  aarch64::Label Exit{};
 
   bind(&LoopTop);
   AbsoluteLoopTopAddress = GetLabelAddress<uint64_t>(&LoopTop);
 
+  if (config.CountExits) {
+    ldr(x0, STATE_PTR(CpuStateFrame, ExitCounters.DispatcherLookup));
+    add(x0, x0, 1);
+    str(x0, STATE_PTR(CpuStateFrame, ExitCounters.DispatcherLookup));
+  }
+
+  if (config.SafepointPolling) {
+    ldr(w0, STATE_PTR(CpuStateFrame, SafepointRequest));
+    cbnz(w0, &Safepoint);
+  }
+
   // Load in our RIP
   // Don't modify x2 since it contains our RIP once the block doesn't exist
   ldr(x2, STATE_PTR(CpuStateFrame, State.rip));
@@ -181,6 +195,7 @@ Arm64Dispatcher::Arm64Dispatcher(FEXCore::Context::Context *ctx, const Dispatche
     if (config.StaticRegisterAllocation)
       SpillStaticRegs();
 
+    bind(&Exit);
     ThreadStopHandlerAddress = GetCursorAddress<uint64_t>();
 
     PopCalleeSavedRegisters();
@@ -190,14 +205,45 @@ Arm64Dispatcher::Arm64Dispatcher(FEXCore::Context::Context *ctx, const Dispatche
     ret();
   }
 
+  if (config.SafepointPolling) {
+    // Another thread asked us to pause or stop
+    // Guest state is fully in the context at the loop top, so this can be handled with a regular call
+    bind(&Safepoint);
+
+    if (config.StaticRegisterAllocation)
+      SpillStaticRegs();
+
+    mov(x0, STATE);
+    ldr(x1, &l_Safepoint);
+#ifdef VIXL_SIMULATOR
+    GenerateIndirectRuntimeCall<bool, void *>(x1);
+#else
+    blr(x1);
+#endif
+
+    aarch64::Label Resume{};
+    tbz(w0, 0, &Resume);
+
+    // Stopping, get back to the stack location from when we entered the core and leave
+    ldr(x0, STATE_PTR(CpuStateFrame, ReturningStackLocation));
+    add(sp, x0, 0);
+    b(&Exit);
+
+    bind(&Resume);
+    if (config.StaticRegisterAllocation)
+      FillStaticRegs();
+
+    b(&LoopTop);
+  }
+
 #ifdef VIXL_SIMULATOR
   // VIXL simulator can't run syscalls.
   constexpr bool SignalSafeCompile = false;
 #else
   constexpr bool SignalSafeCompile = true;
 #endif
-  {
-    ExitFunctionLinkerAddress = GetCursorAddress<uint64_t>();
+  // Linkers call in to the C++ link handler with the record address in LR, then branch to the returned host code
+  auto EmitLinker = [&](size_t LinkHandlerOffset) {
     if (config.StaticRegisterAllocation)
       SpillStaticRegs();
 
@@ -223,7 +269,7 @@ Arm64Dispatcher::Arm64Dispatcher(FEXCore::Context::Context *ctx, const Dispatche
     mov(x0, STATE);
     mov(x1, lr);
 
-    ldr(x2, STATE_PTR(CpuStateFrame, Pointers.Common.ExitFunctionLink));
+    ldr(x2, MemOperand(STATE, LinkHandlerOffset));
 #ifdef VIXL_SIMULATOR
     GenerateIndirectRuntimeCall<uintptr_t, void *, void *>(x2);
 #else
@@ -251,7 +297,13 @@ Arm64Dispatcher::Arm64Dispatcher(FEXCore::Context::Context *ctx, const Dispatche
     if (config.StaticRegisterAllocation)
       FillStaticRegs();
     br(x0);
-  }
+  };
+
+  ExitFunctionLinkerAddress = GetCursorAddress<uint64_t>();
+  EmitLinker(offsetof(FEXCore::Core::CpuStateFrame, Pointers.Common.ExitFunctionLink));
+
+  IndirectBranchLinkerAddress = GetCursorAddress<uint64_t>();
+  EmitLinker(offsetof(FEXCore::Core::CpuStateFrame, Pointers.Common.IndirectBranchLink));
 
   // Need to create the block
   {
@@ -527,6 +579,7 @@ Arm64Dispatcher::Arm64Dispatcher(FEXCore::Context::Context *ctx, const Dispatche
   place(&l_CTX);
   place(&l_Sleep);
   place(&l_CompileBlock);
+  place(&l_Safepoint);
 
 
   FinalizeCode();
@@ -620,6 +673,10 @@ size_t Arm64Dispatcher::GenerateInterpreterTrampoline(uint8_t *CodeBuffer) {
   emit.ldr(x0, STATE_PTR(CpuStateFrame, Pointers.Common.DispatcherLoopTop));
   emit.br(x0);
 
+  // Padding is never executed, it only aligns the fragment that follows
+  while (emit.GetCursorAddress<uintptr_t>() & (InterpreterFragmentAlignment - 1)) {
+    emit.nop();
+  }
   emit.bind(&InlineIRData);
 
   emit.FinalizeCode();
@@ -659,6 +716,7 @@ void Arm64Dispatcher::InitThreadPointers(FEXCore::Core::InternalThreadState *Thr
     Common.DispatcherLoopTop = AbsoluteLoopTopAddress;
     Common.DispatcherLoopTopFillSRA = AbsoluteLoopTopAddressFillSRA;
     Common.ExitFunctionLinker = ExitFunctionLinkerAddress;
+    Common.IndirectBranchLinker = IndirectBranchLinkerAddress;
     Common.ThreadStopHandlerSpillSRA = ThreadStopHandlerAddressSpillSRA;
     Common.ThreadPauseHandlerSpillSRA = ThreadPauseHandlerAddressSpillSRA;
     Common.GuestSignal_SIGILL = GuestSignal_SIGILL;
@@ -40,6 +40,30 @@ void Dispatcher::SleepThread(FEXCore::Context::Context *ctx, FEXCore::Core::CpuS
   ctx->IdleWaitCV.notify_all();
 }
 
+bool Dispatcher::HandleSafepoint(FEXCore::Core::CpuStateFrame *Frame) {
+  auto Thread = Frame->Thread;
+
+  // The requester may have given up waiting and signalled us instead, in which case the signal handles it
+  if (!Frame->SafepointRequest.exchange(0)) {
+    return false;
+  }
+
+  const auto SignalReason = Thread->SignalReason.exchange(FEXCore::Core::SignalEvent::Nothing);
+
+  if (SignalReason == FEXCore::Core::SignalEvent::Pause) {
+    SleepThread(Thread->CTX, Frame);
+    return false;
+  }
+
+  if (SignalReason == FEXCore::Core::SignalEvent::Stop) {
+    // Our ref counting doesn't matter anymore
+    Frame->SignalHandlerRefCounter = 0;
+    return true;
+  }
+
+  return false;
+}
+
 ArchHelpers::Context::ContextBackup* Dispatcher::StoreThreadState(FEXCore::Core::InternalThreadState *Thread, int Signal, void *ucontext) {
   // We can end up getting a signal at any point in our host state
   // Jump to a handler that saves all state so we can safely return
@@ -133,10 +157,7 @@ void Dispatcher::RestoreThreadState(FEXCore::Core::InternalThreadState *Thread,
 
         Frame->State.rip = guest_uctx->uc_mcontext.gregs[FEXCore::x86_64::FEX_REG_RIP];
         // XXX: Full context setting
-        uint32_t eflags = guest_uctx->uc_mcontext.gregs[FEXCore::x86_64::FEX_REG_EFL];
-        for (size_t i = 0; i < Core::CPUState::NUM_EFLAG_BITS; ++i) {
-          Frame->State.flags[i] = (eflags & (1U << i)) ? 1 : 0;
-        }
+        Frame->State.SetEFLAGS(guest_uctx->uc_mcontext.gregs[FEXCore::x86_64::FEX_REG_EFL]);
 
         Frame->State.flags[1] = 1;
         Frame->State.flags[9] = 1;
@@ -203,10 +224,7 @@ void Dispatcher::RestoreThreadState(FEXCore::Core::InternalThreadState *Thread,
 
         // XXX: Full context setting
         // First 32-bytes of flags is EFLAGS broken out
-        uint32_t eflags = guest_uctx->uc_mcontext.gregs[FEXCore::x86::FEX_REG_EFL];
-        for (size_t i = 0; i < Core::CPUState::NUM_EFLAG_BITS; ++i) {
-          Frame->State.flags[i] = (eflags & (1U << i)) ? 1 : 0;
-        }
+        Frame->State.SetEFLAGS(guest_uctx->uc_mcontext.gregs[FEXCore::x86::FEX_REG_EFL]);
 
         Frame->State.flags[1] = 1;
         Frame->State.flags[9] = 1;
@@ -328,6 +346,7 @@ bool Dispatcher::HandleGuestSignal(FEXCore::Core::InternalThreadState *Thread, i
   auto ContextBackup = StoreThreadState(Thread, Signal, ucontext);
 
   auto Frame = Thread->CurrentFrame;
+  ++Frame->ExitCounters.Signal;
 
   // Ref count our faults
   // We use this to track if it is safe to clear cache
@@ -458,7 +477,7 @@ bool Dispatcher::HandleGuestSignal(FEXCore::Core::InternalThreadState *Thread, i
       SetXStateInfo(xstate, IsAVXEnabled);
 
       guest_uctx->uc_mcontext.gregs[FEXCore::x86_64::FEX_REG_RIP] = Frame->State.rip;
-      guest_uctx->uc_mcontext.gregs[FEXCore::x86_64::FEX_REG_EFL] = 0;
+      guest_uctx->uc_mcontext.gregs[FEXCore::x86_64::FEX_REG_EFL] = Frame->State.GetEFLAGS();
       guest_uctx->uc_mcontext.gregs[FEXCore::x86_64::FEX_REG_CSGSFS] = 0;
 
       // aarch64 and x86_64 siginfo_t matches. We can just copy this over
@@ -591,7 +610,7 @@ bool Dispatcher::HandleGuestSignal(FEXCore::Core::InternalThreadState *Thread, i
         guest_uctx->uc_mcontext.gregs[FEXCore::x86::FEX_REG_ERR] = ConvertSignalToError(ucontext, Signal, HostSigInfo);
       }
       guest_uctx->uc_mcontext.gregs[FEXCore::x86::FEX_REG_EIP] = Frame->State.rip;
-      guest_uctx->uc_mcontext.gregs[FEXCore::x86::FEX_REG_EFL] = 0;
+      guest_uctx->uc_mcontext.gregs[FEXCore::x86::FEX_REG_EFL] = Frame->State.GetEFLAGS();
       guest_uctx->uc_mcontext.gregs[FEXCore::x86::FEX_REG_UESP] = 0;
 
 #define COPY_REG(x) \
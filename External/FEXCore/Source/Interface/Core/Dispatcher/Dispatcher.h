@@ -27,6 +27,10 @@ namespace FEXCore::CPU {
 
 struct DispatcherConfig {
   bool StaticRegisterAllocation = false;
+  // Count every return to the dispatcher loop in CpuStateFrame::ExitCounters
+  bool CountExits = false;
+  // Check CpuStateFrame::SafepointRequest at the top of the dispatcher loop
+  bool SafepointPolling = false;
 };
 
 class Dispatcher {
@@ -43,6 +47,7 @@ public:
   uint64_t ThreadPauseHandlerAddress{};
   uint64_t ThreadPauseHandlerAddressSpillSRA{};
   uint64_t ExitFunctionLinkerAddress{};
+  uint64_t IndirectBranchLinkerAddress{};
   uint64_t SignalHandlerReturnAddress{};
   uint64_t GuestSignal_SIGILL{};
   uint64_t GuestSignal_SIGTRAP{};
@@ -69,6 +74,8 @@ public:
   // These are across all arches for now
   static constexpr size_t MaxGDBPauseCheckSize = 128;
   static constexpr size_t MaxInterpreterTrampolineSize = 128;
+  // The interpreter's threaded fragment directly follows its trampoline, which pads up to this alignment
+  static constexpr size_t InterpreterFragmentAlignment = 16;
 
   virtual size_t GenerateGDBPauseCheck(uint8_t *CodeBuffer, uint64_t GuestRIP) = 0;
   virtual size_t GenerateInterpreterTrampoline(uint8_t *CodeBuffer) = 0;
@@ -101,6 +108,15 @@ protected:
 
   static void SleepThread(FEXCore::Context::Context *ctx, FEXCore::Core::CpuStateFrame *Frame);
 
+  /**
+   * @brief Handles a pending safepoint request from the dispatcher loop
+   *
+   * Pauses return once the thread is woken up again.
+   *
+   * @return true if the thread needs to stop
+   */
+  static bool HandleSafepoint(FEXCore::Core::CpuStateFrame *Frame);
+
   static uint64_t GetCompileBlockPtr();
 
   using AsmDispatch = void(*)(FEXCore::Core::CpuStateFrame *Frame);
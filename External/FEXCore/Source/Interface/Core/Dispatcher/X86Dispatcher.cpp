@@ -90,10 +90,20 @@ X86Dispatcher::X86Dispatcher(FEXCore::Context::Context *ctx, const DispatcherCon
   Label NoBlock;
   Label ExitBlock;
   Label ThreadPauseHandler;
+  Label Safepoint;
 
   L(LoopTop);
   AbsoluteLoopTopAddressFillSRA = AbsoluteLoopTopAddress = getCurr<uint64_t>();
 
+  if (config.CountExits) {
+    inc(qword STATE_PTR(CpuStateFrame, ExitCounters.DispatcherLookup));
+  }
+
+  if (config.SafepointPolling) {
+    cmp(dword STATE_PTR(CpuStateFrame, SafepointRequest), 0);
+    jne(Safepoint, T_NEAR);
+  }
+
   {
     // Load our RIP
     mov(rdx, qword STATE_PTR(CPUState, rip));
@@ -169,6 +179,23 @@ X86Dispatcher::X86Dispatcher(FEXCore::Context::Context *ctx, const DispatcherCon
     ret();
   }
 
+  if (config.SafepointPolling) {
+    // Another thread asked us to pause or stop
+    // Guest state is fully in the context at the loop top, so this can be handled with a regular call
+    L(Safepoint);
+
+    mov(rdi, STATE);
+    mov(rax, reinterpret_cast<uint64_t>(HandleSafepoint));
+    call(rax);
+
+    test(al, al);
+    je(LoopTop, T_NEAR);
+
+    // Stopping, get back to the stack location from when we entered the core and leave
+    mov(rsp, qword STATE_PTR(CpuStateFrame, ReturningStackLocation));
+    jmp(ExitBlock, T_NEAR);
+  }
+
   constexpr bool SignalSafeCompile = true;
   // Block creation
   {
@@ -230,8 +257,8 @@ X86Dispatcher::X86Dispatcher(FEXCore::Context::Context *ctx, const DispatcherCon
     jmp(LoopTop);
   }
 
-  {
-    ExitFunctionLinkerAddress = getCurr<uint64_t>();
+  // Linkers call in to the C++ link handler with the record address in RAX, then jump to the returned host code
+  auto EmitLinker = [&](size_t LinkHandlerOffset) {
     if (SignalSafeCompile) {
       // When compiling code, mask all signals to reduce the chance of reentrant allocations
       // RDI: SETMASK
@@ -262,7 +289,7 @@ X86Dispatcher::X86Dispatcher(FEXCore::Context::Context *ctx, const DispatcherCon
     mov(rdi, STATE);
     mov(rsi, rax); // rax is set at the block end
 
-    call(qword STATE_PTR(CpuStateFrame, Pointers.Common.ExitFunctionLink));
+    call(qword [STATE + LinkHandlerOffset]);
 
     if (SignalSafeCompile) {
       // Now restore the signal mask
@@ -285,7 +312,13 @@ X86Dispatcher::X86Dispatcher(FEXCore::Context::Context *ctx, const DispatcherCon
     else {
       jmp(rax);
     }
-  }
+  };
+
+  ExitFunctionLinkerAddress = getCurr<uint64_t>();
+  EmitLinker(offsetof(FEXCore::Core::CpuStateFrame, Pointers.Common.ExitFunctionLink));
+
+  IndirectBranchLinkerAddress = getCurr<uint64_t>();
+  EmitLinker(offsetof(FEXCore::Core::CpuStateFrame, Pointers.Common.IndirectBranchLink));
 
   {
     // Pause handler
@@ -461,6 +494,8 @@ size_t X86Dispatcher::GenerateInterpreterTrampoline(uint8_t *CodeBuffer) {
 
   emit.jmp(qword STATE_PTR(CpuStateFrame, Pointers.Common.DispatcherLoopTop));
 
+  // Padding is never executed, it only aligns the fragment that follows
+  emit.align(InterpreterFragmentAlignment);
   emit.L(InlineIRData);
 
   emit.ready();
@@ -480,6 +515,7 @@ void X86Dispatcher::InitThreadPointers(FEXCore::Core::InternalThreadState *Threa
     Common.DispatcherLoopTop = AbsoluteLoopTopAddress;
     Common.DispatcherLoopTopFillSRA = AbsoluteLoopTopAddressFillSRA;
     Common.ExitFunctionLinker = ExitFunctionLinkerAddress;
+    Common.IndirectBranchLinker = IndirectBranchLinkerAddress;
     Common.ThreadStopHandlerSpillSRA = ThreadStopHandlerAddress;
     Common.ThreadPauseHandlerSpillSRA = ThreadPauseHandlerAddress;
     Common.GuestSignal_SIGILL = GuestSignal_SIGILL;
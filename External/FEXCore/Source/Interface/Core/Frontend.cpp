@@ -1063,7 +1063,7 @@ bool Decoder::DecodeInstruction(uint64_t PC) {
 }
 
 void Decoder::BranchTargetInMultiblockRange() {
-  if (!CTX->Config.Multiblock)
+  if (!CTX->Config.Multiblock && !HotRegion)
     return;
 
   // If the RIP setting is conditional AND within our symbol range then it can be considered for multiblock
@@ -1092,6 +1092,14 @@ void Decoder::BranchTargetInMultiblockRange() {
       if (ExternalBranches) {
         ExternalBranches->insert(DecodeInst->PC + DecodeInst->InstSize);
       }
+
+      if (HotRegion) {
+        // Hot regions pull the callee in to the region, the return still goes through the dispatcher
+        LOGMAN_THROW_A_FMT(DecodeInst->Src[0].IsLiteral(), "Had wrong operand type");
+        TargetRIP = DecodeInst->PC + DecodeInst->InstSize + DecodeInst->Src[0].Data.Literal.Value;
+        Conditional = false;
+        break;
+      }
       [[fallthrough]];
     case 0xC2: // RET imm
     case 0xC3: // RET
@@ -1106,7 +1114,7 @@ void Decoder::BranchTargetInMultiblockRange() {
   }
 
   // If the target RIP is within the symbol ranges then we are golden
-  if (TargetRIP >= SymbolMinAddress && TargetRIP < SymbolMaxAddress) {
+  if (TargetRIP >= SymbolMinAddress && TargetRIP < SymbolMaxAddress && IsHotTarget(TargetRIP)) {
     // Update our conditional branch ranges before we return
     if (Conditional) {
       MaxCondBranchForward = std::max(MaxCondBranchForward, TargetRIP);
@@ -1114,7 +1122,8 @@ void Decoder::BranchTargetInMultiblockRange() {
 
       // If we are conditional then a target can be the instruction past the conditional instruction
       uint64_t FallthroughRIP = DecodeInst->PC + DecodeInst->InstSize;
-      if (HasBlocks.find(FallthroughRIP) == HasBlocks.end() &&
+      if (IsHotTarget(FallthroughRIP) &&
+          HasBlocks.find(FallthroughRIP) == HasBlocks.end() &&
           BlocksToDecode.find(FallthroughRIP) == BlocksToDecode.end()) {
         BlocksToDecode.emplace(FallthroughRIP);
       }
@@ -1210,6 +1219,16 @@ void Decoder::DecodeInstructionsAtEntry(uint8_t const* _InstStream, uint64_t PC,
   // Entry is a jump target
   BlocksToDecode.emplace(PC);
 
+  if (HotRegion) {
+    // Every block the profile took in to the region is a jump target
+    // This also covers the fallthrough of a branch whose taken side stayed cold, and predicted indirect targets
+    for (auto Target : HotRegion->Targets) {
+      if (Target >= SymbolMinAddress && Target < SymbolMaxAddress) {
+        BlocksToDecode.emplace(Target);
+      }
+    }
+  }
+
   uint64_t CurrentCodePage = PC & FHU::FEX_PAGE_MASK;
 
   std::set<uint64_t> CodePages = { CurrentCodePage };
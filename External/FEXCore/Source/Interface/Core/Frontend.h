@@ -1,5 +1,7 @@
 #pragma once
 
+#include "Interface/Core/BlockTierData.h"
+
 #include <FEXCore/Debug/X86Tables.h>
 #include <FEXCore/HLE/SyscallHandler.h>
 #include <FEXCore/Utils/Telemetry.h>
@@ -38,6 +40,7 @@ public:
 
   void SetSectionMaxAddress(uint64_t v) { SectionMaxAddress = v; }
   void SetExternalBranches(std::set<uint64_t> *v) { ExternalBranches = v; }
+  void SetHotRegion(FEXCore::BlockTierData::HotRegionInfo const *v) { HotRegion = v; }
 
   void DelayedDisownBuffer() {
     PoolObject.DelayedDisownBuffer();
@@ -94,6 +97,13 @@ private:
   std::set<uint64_t> HasBlocks;
   std::set<uint64_t> *ExternalBranches {nullptr};
 
+  // Hot regions decode as multiblock over the blocks the profile saw, including direct call targets
+  FEXCore::BlockTierData::HotRegionInfo const *HotRegion {nullptr};
+
+  bool IsHotTarget(uint64_t RIP) const {
+    return !HotRegion || HotRegion->Targets.contains(RIP);
+  }
+
   // ModRM rm decoding
   using DecodeModRMPtr = void (FEXCore::Frontend::Decoder::*)(X86Tables::DecodedOperand *Operand, X86Tables::ModRMDecoded ModRM);
   void DecodeModRM_16(X86Tables::DecodedOperand *Operand, X86Tables::ModRMDecoded ModRM);
@@ -0,0 +1,312 @@
+#include "Interface/Context/Context.h"
+#include "Interface/Core/ArchHelpers/MContext.h"
+#include "Interface/Core/Dispatcher/Dispatcher.h"
+#include "Interface/Core/GuestProfiler.h"
+#include "Interface/IR/AOTIR.h"
+
+#include <FEXCore/Core/CoreState.h>
+#include <FEXCore/Core/SignalDelegator.h>
+#include <FEXCore/Debug/InternalThreadState.h>
+#include <FEXCore/HLE/SourcecodeResolver.h>
+#include <FEXCore/HLE/SyscallHandler.h>
+#include <FEXCore/Utils/LogManager.h>
+#include <FEXHeaderUtils/Syscalls.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <fcntl.h>
+#include <filesystem>
+#include <fmt/format.h>
+#include <string>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+#include <unordered_map>
+
+namespace FEXCore {
+  // ~512KB per thread, a minute of samples between resolves
+  constexpr size_t MAX_PENDING_SAMPLES = 65536;
+
+  GuestProfiler::GuestProfiler(FEXCore::Context::Context *CTX)
+    : CTX {CTX}
+    , Samples(MAX_PENDING_SAMPLES) {
+  }
+
+  GuestProfiler::~GuestProfiler() {
+    Stop();
+  }
+
+  void GuestProfiler::Start() {
+    if (TimerID != -1) {
+      return;
+    }
+
+    sigevent Event{};
+    Event.sigev_notify = SIGEV_THREAD_ID;
+    Event.sigev_signo = SignalDelegator::SIGNAL_FOR_PROFILER;
+    Event.sigev_value.sival_ptr = this;
+    Event._sigev_un._tid = FHU::Syscalls::gettid();
+
+    // Thread CPU time rather than wall time, a thread blocked in a syscall doesn't consume CPU time
+    // so the timer can't interrupt it with EINTR
+    int NewTimer{};
+    if (::syscall(SYS_timer_create, CLOCK_THREAD_CPUTIME_ID, &Event, &NewTimer) == -1) {
+      LogMan::Msg::EFmt("GuestProfiler: Couldn't create sampling timer: {}", errno);
+      return;
+    }
+
+    constexpr long Interval = 1'000'000'000 / SAMPLE_FREQUENCY;
+    itimerspec Spec {
+      .it_interval = {.tv_sec = 0, .tv_nsec = Interval},
+      .it_value = {.tv_sec = 0, .tv_nsec = Interval},
+    };
+
+    ::syscall(SYS_timer_settime, NewTimer, 0, &Spec, nullptr);
+    TimerID = NewTimer;
+  }
+
+  void GuestProfiler::Stop() {
+    if (TimerID == -1) {
+      return;
+    }
+
+    ::syscall(SYS_timer_delete, TimerID);
+    TimerID = -1;
+  }
+
+  void GuestProfiler::RestartAfterFork() {
+    // The kernel dropped the parent's timer, the ID may belong to something else now
+    TimerID = -1;
+
+    SampleCount.store(0, std::memory_order_relaxed);
+    DroppedSamples = 0;
+    GuestSamples.clear();
+    DispatcherSamples = 0;
+    HostSamples = 0;
+
+    Start();
+  }
+
+  bool GuestProfiler::HandleSample(siginfo_t *Info, void *ucontext) {
+    if (Info->si_code != SI_TIMER || Info->si_value.sival_ptr != this) {
+      return false;
+    }
+
+    // The handler can't nest with itself and ResolveSamples blocks the signal, so plain load and store is fine
+    const auto Count = SampleCount.load(std::memory_order_relaxed);
+    if (Count < Samples.size()) {
+      Samples[Count] = ArchHelpers::Context::GetPc(ucontext);
+      SampleCount.store(Count + 1, std::memory_order_relaxed);
+    }
+    else {
+      ++DroppedSamples;
+    }
+
+    return true;
+  }
+
+  void GuestProfiler::AddBlock(uint64_t GuestRIP, uintptr_t HostCode, FEXCore::Core::DebugData const *DebugData) {
+    if (!DebugData->HostCodeSize) {
+      return;
+    }
+
+    if (!Blocks.empty() && Blocks.back().HostStart > HostCode) {
+      BlocksSorted = false;
+    }
+
+    Blocks.emplace_back(BlockRange {
+      .HostStart = HostCode,
+      .HostEnd = HostCode + DebugData->HostCodeSize,
+      .GuestRIP = GuestRIP,
+      .FirstOpcode = static_cast<uint32_t>(Opcodes.size()),
+      .NumOpcodes = static_cast<uint32_t>(DebugData->GuestOpcodes.size()),
+    });
+
+    for (auto &Opcode : DebugData->GuestOpcodes) {
+      Opcodes.emplace_back(OpcodeOffset {
+        static_cast<uint32_t>(Opcode.HostEntryOffset),
+        static_cast<uint32_t>(Opcode.GuestEntryOffset),
+      });
+    }
+
+    // Compiling is the one regular point the thread comes back to, resolve before the buffer fills up
+    if (SampleCount.load(std::memory_order_relaxed) > Samples.size() / 2) {
+      ResolveSamples();
+    }
+  }
+
+  void GuestProfiler::ClearBlocks() {
+    ResolveSamples();
+    Blocks.clear();
+    Opcodes.clear();
+    BlocksSorted = true;
+  }
+
+  void GuestProfiler::EraseBlocks(uintptr_t Start, uintptr_t End) {
+    ResolveSamples();
+
+    // Opcodes of erased blocks stay behind until the next ClearBlocks, they are only reached through Blocks
+    std::erase_if(Blocks, [Start, End](BlockRange const &Block) {
+      return Block.HostStart >= Start && Block.HostStart < End;
+    });
+  }
+
+  void GuestProfiler::ResolveSamples() {
+    sigset_t ProfilerSignal{}, OldMask{};
+    sigemptyset(&ProfilerSignal);
+    sigaddset(&ProfilerSignal, SignalDelegator::SIGNAL_FOR_PROFILER);
+    pthread_sigmask(SIG_BLOCK, &ProfilerSignal, &OldMask);
+
+    if (!BlocksSorted) {
+      std::sort(Blocks.begin(), Blocks.end(), [](BlockRange const &a, BlockRange const &b) {
+        return a.HostStart < b.HostStart;
+      });
+      BlocksSorted = true;
+    }
+
+    const auto Count = SampleCount.load(std::memory_order_relaxed);
+    for (size_t i = 0; i < Count; ++i) {
+      const auto PC = Samples[i];
+
+      // Last block starting at or before the PC
+      auto Block = std::upper_bound(Blocks.begin(), Blocks.end(), PC, [](uintptr_t PC, BlockRange const &Block) {
+        return PC < Block.HostStart;
+      });
+
+      if (Block == Blocks.begin() || PC >= (--Block)->HostEnd) {
+        if (CTX->Dispatcher->IsAddressInDispatcher(PC)) {
+          ++DispatcherSamples;
+        }
+        else {
+          ++HostSamples;
+        }
+        continue;
+      }
+
+      // Code before the first guest instruction gets attributed to the block entry
+      uint64_t GuestRIP = Block->GuestRIP;
+      const auto HostOffset = PC - Block->HostStart;
+      auto OpcodesBegin = Opcodes.begin() + Block->FirstOpcode;
+      auto OpcodesEnd = OpcodesBegin + Block->NumOpcodes;
+      auto Opcode = std::upper_bound(OpcodesBegin, OpcodesEnd, HostOffset, [](uintptr_t Offset, OpcodeOffset const &Opcode) {
+        return Offset < Opcode.HostOffset;
+      });
+      if (Opcode != OpcodesBegin) {
+        GuestRIP += (--Opcode)->GuestOffset;
+      }
+
+      auto &Instruction = GuestSamples[GuestRIP];
+      Instruction.BlockRIP = Block->GuestRIP;
+      ++Instruction.Count;
+    }
+
+    SampleCount.store(0, std::memory_order_relaxed);
+    pthread_sigmask(SIG_SETMASK, &OldMask, nullptr);
+  }
+
+  void GuestProfiler::WriteReport(FEXCore::Core::CpuStateFrame const *Frame, uint32_t TID) {
+    ResolveSamples();
+
+    struct FunctionSamples {
+      uint64_t Count;
+      uint64_t HottestRIP;
+      uint64_t HottestCount;
+    };
+
+    // Functions are named by symbol when a SourcecodeMap is available (GDBSymbols)
+    // Otherwise by the file offset of the block entry, which can be symbolized offline
+    std::unordered_map<std::string, FunctionSamples> Functions;
+    uint64_t GuestTotal{};
+
+    for (auto &[RIP, Instruction] : GuestSamples) {
+      std::string Name;
+      if (CTX->SyscallHandler) {
+        auto Lookup = CTX->SyscallHandler->LookupAOTIRCacheEntry(RIP);
+        if (Lookup.Entry) {
+          const auto Filename = std::filesystem::path(Lookup.Entry->Filename).filename().string();
+          const FEXCore::HLE::SourcecodeSymbolMapping *Sym {};
+          if (Lookup.Entry->SourcecodeMap) {
+            Sym = Lookup.Entry->SourcecodeMap->FindSymbolMapping(RIP - Lookup.VAFileStart);
+          }
+
+          if (Sym) {
+            Name = fmt::format("{}!{}", Filename, Sym->Name);
+          }
+          else {
+            Name = fmt::format("{}+0x{:x}", Filename, Instruction.BlockRIP - Lookup.VAFileStart);
+          }
+        }
+      }
+
+      if (Name.empty()) {
+        Name = fmt::format("0x{:x}", Instruction.BlockRIP);
+      }
+
+      auto &Function = Functions[Name];
+      Function.Count += Instruction.Count;
+      if (Instruction.Count > Function.HottestCount) {
+        Function.HottestRIP = RIP;
+        Function.HottestCount = Instruction.Count;
+      }
+
+      GuestTotal += Instruction.Count;
+    }
+
+    std::vector<std::pair<std::string, FunctionSamples>> Sorted(Functions.begin(), Functions.end());
+    std::sort(Sorted.begin(), Sorted.end(), [](auto const &a, auto const &b) {
+      return a.second.Count > b.second.Count;
+    });
+
+    // Reports live in the user's data directory rather than a shared /tmp where the name could be raced
+    auto ProfileDirectory = Config::GetDataDirectory();
+    ProfileDirectory += "Profiles/";
+
+    std::error_code ec{};
+    if (!std::filesystem::exists(ProfileDirectory, ec) &&
+        !std::filesystem::create_directories(ProfileDirectory, ec)) {
+      LogMan::Msg::EFmt("GuestProfiler: Couldn't create {}", ProfileDirectory);
+      return;
+    }
+
+    const auto Filepath = fmt::format("{}fex-profile-{}-{}.txt", ProfileDirectory, ::getpid(), TID);
+    const int FD = open(Filepath.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_NOFOLLOW | O_CLOEXEC, 0644);
+    if (FD == -1) {
+      LogMan::Msg::EFmt("GuestProfiler: Couldn't write {}", Filepath);
+      return;
+    }
+
+    std::string Output;
+    const uint64_t Total = GuestTotal + DispatcherSamples + HostSamples;
+    auto Percent = [](uint64_t Count, uint64_t Total) {
+      return Total ? (100.0 * Count) / Total : 0.0;
+    };
+
+    auto &Exits = Frame->ExitCounters;
+    Output += fmt::format("Thread {}: {} samples at {}Hz, {} dropped\n", TID, Total, SAMPLE_FREQUENCY, DroppedSamples);
+    Output += fmt::format("  Guest code: {} ({:.2f}%)\n", GuestTotal, Percent(GuestTotal, Total));
+    Output += fmt::format("  Dispatcher: {} ({:.2f}%)\n", DispatcherSamples, Percent(DispatcherSamples, Total));
+    Output += fmt::format("  FEX outside of JIT code: {} ({:.2f}%)\n", HostSamples, Percent(HostSamples, Total));
+    Output += fmt::format("Block exits: {} dispatcher lookups, {} syscalls, {} fallback handler calls, {} signals\n\n",
+      Exits.DispatcherLookup, Exits.Syscall, Exits.Fallback, Exits.Signal);
+
+    Output += fmt::format("{:>10} {:>8}  {:<18}  {}\n", "Samples", "Percent", "Hottest RIP", "Function");
+    for (auto &[Name, Function] : Sorted) {
+      Output += fmt::format("{:>10} {:>7.2f}%  0x{:<16x}  {}\n", Function.Count, Percent(Function.Count, Total), Function.HottestRIP, Name);
+    }
+
+    size_t Written = 0;
+    while (Written < Output.size()) {
+      const ssize_t Result = write(FD, Output.data() + Written, Output.size() - Written);
+      if (Result == -1 && errno == EINTR) {
+        continue;
+      }
+      if (Result <= 0) {
+        break;
+      }
+      Written += Result;
+    }
+    close(FD);
+
+    LogMan::Msg::IFmt("GuestProfiler: Wrote {}", Filepath);
+  }
+}
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <tsl/robin_map.h>
+
+#include <atomic>
+#include <cstdint>
+#include <signal.h>
+#include <vector>
+
+namespace FEXCore::Context {
+  struct Context;
+}
+
+namespace FEXCore::Core {
+  struct CpuStateFrame;
+  struct DebugData;
+}
+
+namespace FEXCore {
+/**
+ * @brief Per-thread sampling profiler for guest code
+ *
+ * A timer on the thread's CPU time delivers SIGNAL_FOR_PROFILER and the host handler records the host PC.
+ * Samples are mapped back to guest instructions through each block's DebugData and a report grouped by
+ * guest function is written when the thread exits.
+ *
+ * Apart from HandleSample, which runs in the signal handler, everything is only called from the owning thread.
+ */
+class GuestProfiler final {
+public:
+  explicit GuestProfiler(FEXCore::Context::Context *CTX);
+  ~GuestProfiler();
+
+  // Starts sampling the calling thread
+  void Start();
+  void Stop();
+
+  // The timer isn't inherited across fork, drop the parent's samples and start again
+  void RestartAfterFork();
+
+  // Returns false if the signal didn't come from this profiler's timer
+  bool HandleSample(siginfo_t *Info, void *ucontext);
+
+  // Records the host code range of a compiled block
+  void AddBlock(uint64_t GuestRIP, uintptr_t HostCode, FEXCore::Core::DebugData const *DebugData);
+
+  // Must be called before the code cache is cleared since host addresses get reused
+  void ClearBlocks();
+
+  // Same as ClearBlocks, for the blocks starting in [Start, End) when only part of the code cache is evicted
+  void EraseBlocks(uintptr_t Start, uintptr_t End);
+
+  void WriteReport(FEXCore::Core::CpuStateFrame const *Frame, uint32_t TID);
+
+  static constexpr uint32_t SAMPLE_FREQUENCY = 1000;
+
+private:
+  struct BlockRange {
+    uintptr_t HostStart;
+    uintptr_t HostEnd;
+    uint64_t GuestRIP;
+    uint32_t FirstOpcode;
+    uint32_t NumOpcodes;
+  };
+
+  struct OpcodeOffset {
+    uint32_t HostOffset;
+    uint32_t GuestOffset;
+  };
+
+  struct InstructionSamples {
+    uint64_t BlockRIP;
+    uint64_t Count;
+  };
+
+  void ResolveSamples();
+
+  FEXCore::Context::Context *CTX;
+
+  // Timer ID from the kernel, -1 when not running
+  int TimerID {-1};
+
+  std::vector<BlockRange> Blocks;
+  std::vector<OpcodeOffset> Opcodes;
+  bool BlocksSorted {true};
+
+  // Fixed size so the signal handler never allocates
+  std::vector<uint64_t> Samples;
+  std::atomic<uint32_t> SampleCount{};
+  uint64_t DroppedSamples{};
+
+  // Resolved samples
+  tsl::robin_map<uint64_t, InstructionSamples> GuestSamples;
+  uint64_t DispatcherSamples{};
+  uint64_t HostSamples{};
+};
+}
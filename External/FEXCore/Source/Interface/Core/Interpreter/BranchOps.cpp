@@ -5,6 +5,7 @@ $end_info$
 */
 
 #include "Interface/Context/Context.h"
+#include "Interface/Core/CodeHash.h"
 #include "Interface/Core/Interpreter/InterpreterClass.h"
 #include "Interface/Core/Interpreter/InterpreterOps.h"
 #include "Interface/Core/Interpreter/InterpreterDefines.h"
@@ -133,18 +134,24 @@ DEF_OP(Thunk) {
 DEF_OP(ValidateCode) {
   auto Op = IROp->C<IR::IROp_ValidateCode>();
 
-  auto CodePtr = Data->CurrentEntry + Op->Offset;
-  if (memcmp((void*)CodePtr, &Op->CodeOriginalLow, Op->CodeLength) != 0) {
-    GD = 1;
-  } else {
-    GD = 0;
-  }
+  auto CodePtr = reinterpret_cast<uint8_t const*>(Data->CurrentEntry + Op->Offset);
+  GD = CodeHash::Hash(CodePtr, Op->CodeLength) != Op->CodeHash;
 }
 
 DEF_OP(ThreadRemoveCodeEntry) {
   Data->State->CTX->ThreadRemoveCodeEntryFromJit(Data->State->CurrentFrame, Data->CurrentEntry);
 }
 
+DEF_OP(Safepoint) {
+  auto Op = IROp->C<IR::IROp_Safepoint>();
+
+  // Leave the block and let the dispatcher handle the request
+  if (Data->State->CurrentFrame->SafepointRequest.load(std::memory_order_relaxed)) {
+    Data->State->CurrentFrame->State.rip = Data->CurrentEntry + Op->Offset;
+    Data->BlockResults.Quit = true;
+  }
+}
+
 DEF_OP(CPUID) {
   auto Op = IROp->C<IR::IROp_CPUID>();
   uint64_t *DstPtr = GetDest<uint64_t*>(Data->SSAData, Node);
@@ -0,0 +1,33 @@
+#pragma once
+#include <cstdint>
+
+namespace FEXCore::CPU::Crypto {
+  // Software implementations of the crypto IR ops.
+  // These back the interpreter and are the fallback handlers the JITs call on hosts without crypto extensions.
+  // AES and CLMUL never index memory or branch on their inputs, they are constant time.
+  __uint128_t AESImc(__uint128_t State);
+  __uint128_t AESEnc(__uint128_t State, __uint128_t Key);
+  __uint128_t AESEncLast(__uint128_t State, __uint128_t Key);
+  __uint128_t AESDec(__uint128_t State, __uint128_t Key);
+  __uint128_t AESDecLast(__uint128_t State, __uint128_t Key);
+
+  // Round constant is XORed in separately, see OpDispatchBuilder::AESKeyGenAssistImpl
+  __uint128_t AESKeyGenAssist(__uint128_t Src, uint8_t RCON);
+  __uint128_t AESKeyGenAssistNoRCON(__uint128_t Src);
+
+  // Full 128-bit carryless product of two 64-bit values
+  __uint128_t CLMul(uint64_t Src1, uint64_t Src2);
+
+  template<uint8_t Selector>
+  __uint128_t PCLMUL(__uint128_t Src1, __uint128_t Src2) {
+    const uint64_t Element1 = (Selector & 0x01) ? static_cast<uint64_t>(Src1 >> 64) : static_cast<uint64_t>(Src1);
+    const uint64_t Element2 = (Selector & 0x10) ? static_cast<uint64_t>(Src2 >> 64) : static_cast<uint64_t>(Src2);
+    return CLMul(Element1, Element2);
+  }
+
+  // CRC32C of the low 1, 2, 4 or 8 bytes of Data
+  uint32_t CRC32CB(uint32_t Accumulator, uint64_t Data);
+  uint32_t CRC32CH(uint32_t Accumulator, uint64_t Data);
+  uint32_t CRC32CW(uint32_t Accumulator, uint64_t Data);
+  uint32_t CRC32CX(uint32_t Accumulator, uint64_t Data);
+}
@@ -11,11 +11,41 @@ $end_info$
 #include <cstdint>
 
 namespace FEXCore::CPU {
+// Packs x86 flags in to the NZCV layout that SubNZCV and AddNZCV return
+static uint32_t PackNZCV(uint64_t Res, bool CF, bool OF) {
+  return
+    static_cast<uint32_t>(Res >> 63) << 31 |
+    static_cast<uint32_t>(Res == 0) << 30 |
+    static_cast<uint32_t>(CF) << 29 |
+    static_cast<uint32_t>(OF) << 28;
+}
+
 #define DEF_OP(x) void InterpreterOps::Op_##x(IR::IROp_Header *IROp, IROpData *Data, IR::NodeID Node)
 DEF_OP(GetHostFlag) {
   auto Op = IROp->C<IR::IROp_GetHostFlag>();
   GD = (*GetSrc<uint64_t*>(Data->SSAData, Op->Value) >> Op->Flag) & 1;
 }
+
+DEF_OP(SubNZCV) {
+  auto Op = IROp->C<IR::IROp_SubNZCV>();
+  // Shifting the sources to the top of the register calculates the flags at SrcSize
+  const uint32_t Shift = 64 - Op->SrcSize * 8;
+  const uint64_t Src1 = *GetSrc<uint64_t*>(Data->SSAData, Op->Src1) << Shift;
+  const uint64_t Src2 = *GetSrc<uint64_t*>(Data->SSAData, Op->Src2) << Shift;
+  const uint64_t Res = Src1 - Src2;
+
+  GD = PackNZCV(Res, Src1 < Src2, ((Src1 ^ Src2) & (Src1 ^ Res)) >> 63);
+}
+
+DEF_OP(AddNZCV) {
+  auto Op = IROp->C<IR::IROp_AddNZCV>();
+  const uint32_t Shift = 64 - Op->SrcSize * 8;
+  const uint64_t Src1 = *GetSrc<uint64_t*>(Data->SSAData, Op->Src1) << Shift;
+  const uint64_t Src2 = *GetSrc<uint64_t*>(Data->SSAData, Op->Src2) << Shift;
+  const uint64_t Res = Src1 + Src2;
+
+  GD = PackNZCV(Res, Res < Src1, (~(Src1 ^ Src2) & (Src1 ^ Res)) >> 63);
+}
 #undef DEF_OP
 
 } // namespace FEXCore::CPU
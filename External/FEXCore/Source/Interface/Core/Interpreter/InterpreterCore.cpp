@@ -60,8 +60,9 @@ void InterpreterCore::InitializeSignalHandlers(FEXCore::Context::Context *CTX) {
 
 void *InterpreterCore::CompileCode(uint64_t Entry, [[maybe_unused]] FEXCore::IR::IRListView const *IR, [[maybe_unused]] FEXCore::Core::DebugData *DebugData, FEXCore::IR::RegisterAllocationData *RAData, bool GDBEnabled) {
 
-  const auto IRSize = AlignUp(IR->GetInlineSize(), 16);
-  const auto MaxSize = IRSize + Dispatcher::MaxInterpreterTrampolineSize + GDBEnabled * Dispatcher::MaxGDBPauseCheckSize;
+  // Worst case placement of the fragment header, the layout only ever pads up to 16 bytes between sections
+  const auto FragmentSize = AlignUp(InterpreterOps::GetThreadedFragmentSize(0, IR), 16) + 16 * 3;
+  const auto MaxSize = FragmentSize + Dispatcher::MaxInterpreterTrampolineSize + GDBEnabled * Dispatcher::MaxGDBPauseCheckSize;
 
   if ((BufferUsed + MaxSize) > CurrentCodeBuffer->Size) {
     ThreadState->CTX->ClearCodeCache(ThreadState);
@@ -81,10 +82,12 @@ void *InterpreterCore::CompileCode(uint64_t Entry, [[maybe_unused]] FEXCore::IR:
   DestBuffer += TrampolineSize;
   BufferUsed += TrampolineSize;
 
-
-  IR->Serialize(DestBuffer);
-  DestBuffer += IRSize;
-  BufferUsed += IRSize;
+  // The pre-decoded fragment lives with the trampoline in the code buffer.
+  // It is built once here and dropped along with the LookupCache entry when the code cache is cleared.
+  const auto ThreadedSize = AlignUp(InterpreterOps::GetThreadedFragmentSize(reinterpret_cast<uintptr_t>(DestBuffer), IR), 16);
+  InterpreterOps::BuildThreadedFragment(DestBuffer, IR);
+  DestBuffer += ThreadedSize;
+  BufferUsed += ThreadedSize;
 
   return BufferStart;
 }
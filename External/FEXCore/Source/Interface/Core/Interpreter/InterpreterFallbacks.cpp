@@ -1,5 +1,7 @@
 #include "FEXCore/Core/CoreState.h"
+#include "FEXCore/Core/HostFeatures.h"
 #include "Interface/Core/Interpreter/InterpreterOps.h"
+#include "Interface/Core/Interpreter/EncryptionOps.h"
 #include "Interface/Core/Interpreter/F80Ops.h"
 
 #include <cstddef>
@@ -87,7 +89,22 @@ FallbackInfo GetFallbackInfo(X80SoftFloat(*fn)(X80SoftFloat, X80SoftFloat), FEXC
   return {FABI_F80_F80_F80, (void*)fn, HandlerIndex};
 }
 
-void InterpreterOps::FillFallbackIndexPointers(uint64_t *Info) {
+template<>
+FallbackInfo GetFallbackInfo(uint32_t(*fn)(uint32_t, uint64_t), FEXCore::Core::FallbackHandlerIndex HandlerIndex) {
+  return {FABI_I32_I32_I64, (void*)fn, HandlerIndex};
+}
+
+template<>
+FallbackInfo GetFallbackInfo(__uint128_t(*fn)(__uint128_t), FEXCore::Core::FallbackHandlerIndex HandlerIndex) {
+  return {FABI_I128_I128, (void*)fn, HandlerIndex};
+}
+
+template<>
+FallbackInfo GetFallbackInfo(__uint128_t(*fn)(__uint128_t, __uint128_t), FEXCore::Core::FallbackHandlerIndex HandlerIndex) {
+  return {FABI_I128_I128_I128, (void*)fn, HandlerIndex};
+}
+
+void InterpreterOps::FillFallbackIndexPointers(uint64_t *Info, FEXCore::HostFeatures const &Features) {
   Info[Core::OPINDEX_F80LOADFCW] = reinterpret_cast<uint64_t>(GetFallbackInfo(&FEXCore::CPU::OpHandlers<IR::OP_F80LOADFCW>::handle, Core::OPINDEX_F80LOADFCW).fn);
   Info[Core::OPINDEX_F80CVTTO_4] = reinterpret_cast<uint64_t>(GetFallbackInfo(&FEXCore::CPU::OpHandlers<IR::OP_F80CVTTO>::handle4, Core::OPINDEX_F80CVTTO_4).fn);
   Info[Core::OPINDEX_F80CVTTO_8] = reinterpret_cast<uint64_t>(GetFallbackInfo(&FEXCore::CPU::OpHandlers<IR::OP_F80CVTTO>::handle8, Core::OPINDEX_F80CVTTO_8).fn);
@@ -144,6 +161,27 @@ void InterpreterOps::FillFallbackIndexPointers(uint64_t *Info) {
   Info[Core::OPINDEX_F64FPREM1] = reinterpret_cast<uint64_t>(GetFallbackInfo(&FEXCore::CPU::OpHandlers<IR::OP_F64FPREM1>::handle, Core::OPINDEX_F64FPREM1).fn);
   Info[Core::OPINDEX_F64SCALE] = reinterpret_cast<uint64_t>(GetFallbackInfo(&FEXCore::CPU::OpHandlers<IR::OP_F64SCALE>::handle, Core::OPINDEX_F64SCALE).fn);
 
+  // Crypto, only called when the host lacks the extension
+  if (Features.EmulateAES) {
+    Info[Core::OPINDEX_VAESIMC] = reinterpret_cast<uint64_t>(GetFallbackInfo(&FEXCore::CPU::Crypto::AESImc, Core::OPINDEX_VAESIMC).fn);
+    Info[Core::OPINDEX_VAESENC] = reinterpret_cast<uint64_t>(GetFallbackInfo(&FEXCore::CPU::Crypto::AESEnc, Core::OPINDEX_VAESENC).fn);
+    Info[Core::OPINDEX_VAESENCLAST] = reinterpret_cast<uint64_t>(GetFallbackInfo(&FEXCore::CPU::Crypto::AESEncLast, Core::OPINDEX_VAESENCLAST).fn);
+    Info[Core::OPINDEX_VAESDEC] = reinterpret_cast<uint64_t>(GetFallbackInfo(&FEXCore::CPU::Crypto::AESDec, Core::OPINDEX_VAESDEC).fn);
+    Info[Core::OPINDEX_VAESDECLAST] = reinterpret_cast<uint64_t>(GetFallbackInfo(&FEXCore::CPU::Crypto::AESDecLast, Core::OPINDEX_VAESDECLAST).fn);
+    Info[Core::OPINDEX_VAESKEYGENASSIST] = reinterpret_cast<uint64_t>(GetFallbackInfo(&FEXCore::CPU::Crypto::AESKeyGenAssistNoRCON, Core::OPINDEX_VAESKEYGENASSIST).fn);
+  }
+  if (Features.EmulatePMULL_128Bit) {
+    Info[Core::OPINDEX_PCLMUL_00] = reinterpret_cast<uint64_t>(GetFallbackInfo(&FEXCore::CPU::Crypto::PCLMUL<0x00>, Core::OPINDEX_PCLMUL_00).fn);
+    Info[Core::OPINDEX_PCLMUL_01] = reinterpret_cast<uint64_t>(GetFallbackInfo(&FEXCore::CPU::Crypto::PCLMUL<0x01>, Core::OPINDEX_PCLMUL_01).fn);
+    Info[Core::OPINDEX_PCLMUL_10] = reinterpret_cast<uint64_t>(GetFallbackInfo(&FEXCore::CPU::Crypto::PCLMUL<0x10>, Core::OPINDEX_PCLMUL_10).fn);
+    Info[Core::OPINDEX_PCLMUL_11] = reinterpret_cast<uint64_t>(GetFallbackInfo(&FEXCore::CPU::Crypto::PCLMUL<0x11>, Core::OPINDEX_PCLMUL_11).fn);
+  }
+  if (Features.EmulateCRC) {
+    Info[Core::OPINDEX_CRC32_1] = reinterpret_cast<uint64_t>(GetFallbackInfo(&FEXCore::CPU::Crypto::CRC32CB, Core::OPINDEX_CRC32_1).fn);
+    Info[Core::OPINDEX_CRC32_2] = reinterpret_cast<uint64_t>(GetFallbackInfo(&FEXCore::CPU::Crypto::CRC32CH, Core::OPINDEX_CRC32_2).fn);
+    Info[Core::OPINDEX_CRC32_4] = reinterpret_cast<uint64_t>(GetFallbackInfo(&FEXCore::CPU::Crypto::CRC32CW, Core::OPINDEX_CRC32_4).fn);
+    Info[Core::OPINDEX_CRC32_8] = reinterpret_cast<uint64_t>(GetFallbackInfo(&FEXCore::CPU::Crypto::CRC32CX, Core::OPINDEX_CRC32_8).fn);
+  }
 }
 
 bool InterpreterOps::GetFallbackHandler(IR::IROp_Header const *IROp, FallbackInfo *Info) {
@@ -302,6 +340,79 @@ bool InterpreterOps::GetFallbackHandler(IR::IROp_Header const *IROp, FallbackInf
     COMMON_F64_OP(FPREM)
     COMMON_F64_OP(SCALE)
 
+    // Crypto
+    case IR::OP_VAESIMC: {
+      *Info = GetFallbackInfo(&FEXCore::CPU::Crypto::AESImc, Core::OPINDEX_VAESIMC);
+      return true;
+    }
+    case IR::OP_VAESENC: {
+      *Info = GetFallbackInfo(&FEXCore::CPU::Crypto::AESEnc, Core::OPINDEX_VAESENC);
+      return true;
+    }
+    case IR::OP_VAESENCLAST: {
+      *Info = GetFallbackInfo(&FEXCore::CPU::Crypto::AESEncLast, Core::OPINDEX_VAESENCLAST);
+      return true;
+    }
+    case IR::OP_VAESDEC: {
+      *Info = GetFallbackInfo(&FEXCore::CPU::Crypto::AESDec, Core::OPINDEX_VAESDEC);
+      return true;
+    }
+    case IR::OP_VAESDECLAST: {
+      *Info = GetFallbackInfo(&FEXCore::CPU::Crypto::AESDecLast, Core::OPINDEX_VAESDECLAST);
+      return true;
+    }
+    case IR::OP_VAESKEYGENASSIST: {
+      auto Op = IROp->C<IR::IROp_VAESKeyGenAssist>();
+
+      // The OpcodeDispatcher XORs the round constant in separately when these handlers are in use
+      if (Op->RCON != 0) {
+        break;
+      }
+
+      *Info = GetFallbackInfo(&FEXCore::CPU::Crypto::AESKeyGenAssistNoRCON, Core::OPINDEX_VAESKEYGENASSIST);
+      return true;
+    }
+    case IR::OP_PCLMUL: {
+      auto Op = IROp->C<IR::IROp_PCLMUL>();
+
+      switch (Op->Selector) {
+        case 0b00000000:
+          *Info = GetFallbackInfo(&FEXCore::CPU::Crypto::PCLMUL<0x00>, Core::OPINDEX_PCLMUL_00);
+          return true;
+        case 0b00000001:
+          *Info = GetFallbackInfo(&FEXCore::CPU::Crypto::PCLMUL<0x01>, Core::OPINDEX_PCLMUL_01);
+          return true;
+        case 0b00010000:
+          *Info = GetFallbackInfo(&FEXCore::CPU::Crypto::PCLMUL<0x10>, Core::OPINDEX_PCLMUL_10);
+          return true;
+        case 0b00010001:
+          *Info = GetFallbackInfo(&FEXCore::CPU::Crypto::PCLMUL<0x11>, Core::OPINDEX_PCLMUL_11);
+          return true;
+        default: LogMan::Msg::DFmt("Unhandled PCLMUL selector: {}", Op->Selector);
+      }
+      break;
+    }
+    case IR::OP_CRC32: {
+      auto Op = IROp->C<IR::IROp_CRC32>();
+
+      switch (Op->SrcSize) {
+        case 1:
+          *Info = GetFallbackInfo(&FEXCore::CPU::Crypto::CRC32CB, Core::OPINDEX_CRC32_1);
+          return true;
+        case 2:
+          *Info = GetFallbackInfo(&FEXCore::CPU::Crypto::CRC32CH, Core::OPINDEX_CRC32_2);
+          return true;
+        case 4:
+          *Info = GetFallbackInfo(&FEXCore::CPU::Crypto::CRC32CW, Core::OPINDEX_CRC32_4);
+          return true;
+        case 8:
+          *Info = GetFallbackInfo(&FEXCore::CPU::Crypto::CRC32CX, Core::OPINDEX_CRC32_8);
+          return true;
+        default: LogMan::Msg::DFmt("Unhandled CRC32 size: {}", Op->SrcSize);
+      }
+      break;
+    }
+
     default:
       break;
   }
@@ -1,5 +1,6 @@
 #include "Interface/Context/Context.h"
 #include "Interface/Core/CPUID.h"
+#include "Interface/Core/Dispatcher/Dispatcher.h"
 #include "InterpreterDefines.h"
 #include "InterpreterOps.h"
 #include "F80Ops.h"
@@ -17,6 +18,7 @@
 #include <FEXCore/Utils/BitUtils.h>
 #include <FEXCore/Utils/CompilerDefs.h>
 #include <FEXCore/Utils/LogManager.h>
+#include <FEXCore/Utils/MathUtils.h>
 
 #include "Interface/HLE/Thunks/Thunks.h"
 
@@ -36,7 +38,7 @@
 
 namespace FEXCore::CPU {
 
-using OpHandler = void (*)(IR::IROp_Header *IROp, InterpreterOps::IROpData *Data, IR::NodeID Node);
+using OpHandler = InterpreterOps::OpHandler;
 using OpHandlerArray = std::array<OpHandler, IR::IROps::OP_LAST + 1>;
 
 constexpr OpHandlerArray InterpreterOpHandlers = [] {
@@ -123,6 +125,7 @@ constexpr OpHandlerArray InterpreterOpHandlers = [] {
   REGISTER_OP(THUNK,                  Thunk);
   REGISTER_OP(VALIDATECODE,           ValidateCode);
   REGISTER_OP(THREADREMOVECODEENTRY,        ThreadRemoveCodeEntry);
+  REGISTER_OP(SAFEPOINT,                    Safepoint);
   REGISTER_OP(CPUID,                  CPUID);
 
   // Conversion ops
@@ -138,6 +141,8 @@ constexpr OpHandlerArray InterpreterOpHandlers = [] {
 
   // Flag ops
   REGISTER_OP(GETHOSTFLAG,            GetHostFlag);
+  REGISTER_OP(SUBNZCV,                SubNZCV);
+  REGISTER_OP(ADDNZCV,                AddNZCV);
 
   // Memory ops
   REGISTER_OP(LOADCONTEXT,            LoadContext);
@@ -264,6 +269,7 @@ constexpr OpHandlerArray InterpreterOpHandlers = [] {
   REGISTER_OP(VSMULL2,                VSMull2);
   REGISTER_OP(VUABDL,                 VUABDL);
   REGISTER_OP(VTBL1,                  VTBL1);
+  REGISTER_OP(VPERMUTE,               VPermute);
   REGISTER_OP(VREV64,                 VRev64);
 
   // Encryption ops
@@ -324,69 +330,170 @@ void InterpreterOps::Op_Unhandled(FEXCore::IR::IROp_Header *IROp, IROpData *Data
 void InterpreterOps::Op_NoOp(FEXCore::IR::IROp_Header *IROp, IROpData *Data, IR::NodeID Node) {
 }
 
-void InterpreterOps::InterpretIR(FEXCore::Core::CpuStateFrame *Frame, FEXCore::IR::IRListView const *CurrentIR) {
+namespace {
+struct ThreadedFragmentLayout {
+  uint32_t NumBlocks{};
+  uint32_t NumOps{};
+  uint32_t BlocksOffset{};
+  uint32_t OpsOffset{};
+  uint32_t IROffset{};
+  size_t TotalSize{};
+};
+
+ThreadedFragmentLayout CalculateThreadedFragmentLayout(uintptr_t FragmentAddress, FEXCore::IR::IRListView const *IR) {
+  ThreadedFragmentLayout Layout{};
+
+  for (auto [BlockNode, BlockHeader] : IR->GetBlocks()) {
+    ++Layout.NumBlocks;
+    for (auto [CodeNode, IROp] : IR->GetCode(BlockNode)) {
+      ++Layout.NumOps;
+    }
+  }
+
+  auto AlignedOffset = [FragmentAddress](uintptr_t Offset) {
+    return static_cast<uint32_t>(AlignUp(FragmentAddress + Offset, 16) - FragmentAddress);
+  };
+
+  Layout.BlocksOffset = AlignedOffset(sizeof(InterpreterOps::ThreadedFragment));
+  Layout.OpsOffset = AlignedOffset(Layout.BlocksOffset + Layout.NumBlocks * sizeof(InterpreterOps::ThreadedBlock));
+  Layout.IROffset = AlignedOffset(Layout.OpsOffset + Layout.NumOps * sizeof(InterpreterOps::ThreadedOp));
+  Layout.TotalSize = Layout.IROffset + IR->GetInlineSize();
+  return Layout;
+}
+
+uint32_t GetSSAClearSize(FEXCore::IR::IROp_Header const *IROp) {
+  const auto Class = FEXCore::IR::GetRegClass(IROp->Op);
+  if (Class == FEXCore::IR::InvalidClass) {
+    return 0;
+  }
+
+  // 128-bit GPR ops (Div, UDiv, Rem, URem) read full 128-bit sources, even ones produced by 64-bit ops
+  // Everything else might be consumed as a full 256-bit vector
+  if (Class == FEXCore::IR::GPRClass) {
+    return sizeof(__uint128_t);
+  }
+  return sizeof(InterpVector256);
+}
+}
+
+size_t InterpreterOps::GetThreadedFragmentSize(uintptr_t FragmentAddress, FEXCore::IR::IRListView const *IR) {
+  return CalculateThreadedFragmentLayout(FragmentAddress, IR).TotalSize;
+}
+
+void InterpreterOps::BuildThreadedFragment(uint8_t *Buffer, FEXCore::IR::IRListView const *IR) {
+  static_assert(alignof(ThreadedFragment) <= Dispatcher::InterpreterFragmentAlignment);
+  LOGMAN_THROW_AA_FMT((reinterpret_cast<uintptr_t>(Buffer) % alignof(ThreadedFragment)) == 0, "Threaded fragment header is misaligned");
+
+  const auto Layout = CalculateThreadedFragmentLayout(reinterpret_cast<uintptr_t>(Buffer), IR);
+
+  auto Fragment = reinterpret_cast<ThreadedFragment*>(Buffer);
+  Fragment->NumBlocks = Layout.NumBlocks;
+  Fragment->NumOps = Layout.NumOps;
+  Fragment->BlocksOffset = Layout.BlocksOffset;
+  Fragment->OpsOffset = Layout.OpsOffset;
+  Fragment->IROffset = Layout.IROffset;
+
+  // Handlers reference the IR through the serialized copy so that it shares the fragment's lifetime
+  IR->Serialize(Buffer + Layout.IROffset);
+  auto CurrentIR = Fragment->GetIR();
+
+  auto Blocks = reinterpret_cast<ThreadedBlock*>(Buffer + Layout.BlocksOffset);
+  auto Ops = reinterpret_cast<ThreadedOp*>(Buffer + Layout.OpsOffset);
+
+  uint32_t NumBlocks{};
+  uint32_t NumOps{};
+  uint32_t MaxSSAID{};
+
+  for (auto [BlockNode, BlockHeader] : CurrentIR->GetBlocks()) {
+    auto &Block = Blocks[NumBlocks++];
+    Block.ID = CurrentIR->GetID(BlockNode);
+    Block.FirstOp = NumOps;
+
+    for (auto [CodeNode, IROp] : CurrentIR->GetCode(BlockNode)) {
+      const auto ID = CurrentIR->GetID(CodeNode);
+      const auto ClearSize = GetSSAClearSize(IROp);
+
+      Ops[NumOps++] = ThreadedOp {
+        .Handler = InterpreterOpHandlers[IROp->Op],
+        .IROp = IROp,
+        .ID = ID,
+        .ClearSize = ClearSize,
+      };
+
+      if (ClearSize) {
+        MaxSSAID = std::max(MaxSSAID, ID.Value);
+      }
+    }
+
+    Block.NumOps = NumOps - Block.FirstOp;
+  }
+
+  Fragment->SSADataSize = (MaxSSAID + 1) * sizeof(InterpVector256);
+}
+
+void InterpreterOps::InterpretIR(FEXCore::Core::CpuStateFrame *Frame, ThreadedFragment const *Fragment) {
   volatile void *StackEntry = alloca(0);
 
-  const uintptr_t ListSize = CurrentIR->GetSSACount();
+  auto CurrentIR = Fragment->GetIR();
+  auto Blocks = Fragment->GetBlocks();
+  auto Ops = Fragment->GetOps();
+  const uint32_t NumBlocks = Fragment->NumBlocks;
 
   static_assert(sizeof(FEXCore::IR::IROp_Header) == 4);
   static_assert(sizeof(FEXCore::IR::OrderedNode) == 16);
 
-  auto BlockEnd = CurrentIR->GetBlocks().end();
-
-  constexpr size_t ListEntrySizeInBytes = sizeof(InterpVector256);
-  const size_t SSADataSize = ListSize * ListEntrySizeInBytes;
-
   InterpreterOps::IROpData OpData{
     .State = Frame->Thread,
     .CurrentEntry = Frame->State.rip,
     .CurrentIR = CurrentIR,
     .StackEntry = StackEntry,
-    .SSAData = alloca(SSADataSize),
+    // SSA slots are cleared as their op executes rather than up front
+    .SSAData = alloca(Fragment->SSADataSize),
     .BlockResults = {},
     .BlockIterator = CurrentIR->GetBlocks().begin(),
   };
 
-  // Clear all SSAData entries to zero. Required for Zero-extend semantics
-  memset(OpData.SSAData, 0, SSADataSize);
+  uint32_t BlockIndex = 0;
 
   while (1) {
-    using namespace FEXCore::IR;
-    auto [BlockNode, BlockHeader] = OpData.BlockIterator();
-    auto BlockIROp = BlockHeader->CW<IROp_CodeBlock>();
-    LOGMAN_THROW_AA_FMT(BlockIROp->Header.Op == IR::OP_CODEBLOCK, "IR type failed to be a code block");
-
     // Reset the block results per block
     memset(&OpData.BlockResults, 0, sizeof(OpData.BlockResults));
 
-    auto CodeBegin = CurrentIR->at(BlockIROp->Begin);
-    auto CodeLast = CurrentIR->at(BlockIROp->Last);
-
-    for (auto [CodeNode, IROp] : CurrentIR->GetCode(BlockNode)) {
-      const auto ID = CurrentIR->GetID(CodeNode);
-      const uint32_t Op = IROp->Op;
+    const auto &Block = Blocks[BlockIndex];
+    const auto OpsEnd = &Ops[Block.FirstOp + Block.NumOps];
 
-      // Execute handler
-      OpHandler Handler = InterpreterOpHandlers[Op];
+    for (auto Op = &Ops[Block.FirstOp]; Op != OpsEnd; ++Op) {
+      // Handlers rely on zero-extend semantics when writing less than a full slot
+      if (Op->ClearSize == sizeof(__uint128_t)) {
+        *GetDest<__uint128_t*>(OpData.SSAData, Op->ID) = 0;
+      }
+      else if (Op->ClearSize) {
+        *GetDest<InterpVector256*>(OpData.SSAData, Op->ID) = {};
+      }
 
-      Handler(IROp, &OpData, ID);
+      Op->Handler(Op->IROp, &OpData, Op->ID);
 
       if (OpData.BlockResults.Quit ||
-          OpData.BlockResults.Redo ||
-          CodeBegin == CodeLast) {
+          OpData.BlockResults.Redo) {
         break;
       }
-
-      ++CodeBegin;
     }
 
     // Iterator will have been set, go again
     if (OpData.BlockResults.Redo) {
+      const auto TargetID = OpData.BlockIterator.ID();
+
+      // Fragments only have a handful of blocks, a linear search is fine
+      BlockIndex = 0;
+      while (Blocks[BlockIndex].ID != TargetID) {
+        ++BlockIndex;
+        LOGMAN_THROW_AA_FMT(BlockIndex < NumBlocks, "Jump to unknown block");
+      }
       continue;
     }
 
     // If we have set to early exit or at the end block then leave
-    if (OpData.BlockResults.Quit || ++OpData.BlockIterator == BlockEnd) {
+    if (OpData.BlockResults.Quit || ++BlockIndex == NumBlocks) {
       break;
     }
   }
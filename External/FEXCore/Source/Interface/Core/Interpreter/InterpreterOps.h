@@ -5,6 +5,10 @@
 #include <FEXCore/IR/IR.h>
 #include <FEXCore/IR/IntrusiveIRList.h>
 
+namespace FEXCore {
+  class HostFeatures;
+}
+
 namespace FEXCore::Core {
   struct InternalThreadState;
 }
@@ -36,6 +40,9 @@ namespace FEXCore::CPU {
     FABI_I64_F80_F80,
     FABI_F80_F80,
     FABI_F80_F80_F80,
+    FABI_I32_I32_I64,
+    FABI_I128_I128,
+    FABI_I128_I128_I128,
   };
 
   struct FallbackInfo {
@@ -47,8 +54,10 @@ namespace FEXCore::CPU {
   class InterpreterOps {
 
     public:
-      static void InterpretIR(FEXCore::Core::CpuStateFrame *Frame, FEXCore::IR::IRListView const *IR);
-      static void FillFallbackIndexPointers(uint64_t *Info);
+      struct ThreadedFragment;
+
+      static void InterpretIR(FEXCore::Core::CpuStateFrame *Frame, ThreadedFragment const *Fragment);
+      static void FillFallbackIndexPointers(uint64_t *Info, FEXCore::HostFeatures const &Features);
       static bool GetFallbackHandler(IR::IROp_Header const *IROp, FallbackInfo *Info);
 
       struct IROpData {
@@ -65,6 +74,57 @@ namespace FEXCore::CPU {
         IR::NodeIterator BlockIterator{0, 0};
       };
 
+      using OpHandler = void (*)(IR::IROp_Header *IROp, IROpData *Data, IR::NodeID Node);
+
+      struct ThreadedOp {
+        OpHandler Handler;
+        IR::IROp_Header *IROp;
+        IR::NodeID ID;
+        // Bytes of the SSA slot to clear before the handler runs, zero if the op has no destination
+        uint32_t ClearSize;
+      };
+
+      struct ThreadedBlock {
+        IR::NodeID ID;
+        uint32_t FirstOp;
+        uint32_t NumOps;
+      };
+
+      /**
+       * @brief Pre-decoded form of an IR fragment
+       *
+       * Built once when the fragment is compiled and stored in the code buffer directly behind the interpreter trampoline.
+       * Handlers are resolved up front so execution is a linear walk over ThreadedOps instead of the IR lists.
+       *
+       * The trampoline pads so the header starts at Dispatcher::InterpreterFragmentAlignment.
+       * The block and op arrays, followed by the serialized IR, are placed at aligned offsets from it.
+       */
+      struct ThreadedFragment {
+        uint32_t NumBlocks;
+        uint32_t NumOps;
+        // Only enough SSA slots to cover the highest value producing node
+        uint32_t SSADataSize;
+        uint32_t BlocksOffset;
+        uint32_t OpsOffset;
+        uint32_t IROffset;
+
+        ThreadedBlock const *GetBlocks() const {
+          return reinterpret_cast<ThreadedBlock const*>(reinterpret_cast<uintptr_t>(this) + BlocksOffset);
+        }
+
+        ThreadedOp const *GetOps() const {
+          return reinterpret_cast<ThreadedOp const*>(reinterpret_cast<uintptr_t>(this) + OpsOffset);
+        }
+
+        FEXCore::IR::IRListView const *GetIR() const {
+          return reinterpret_cast<FEXCore::IR::IRListView const*>(reinterpret_cast<uintptr_t>(this) + IROffset);
+        }
+      };
+
+      // Size of the fragment built for IR if its header is placed at FragmentAddress, including the serialized IR
+      static size_t GetThreadedFragmentSize(uintptr_t FragmentAddress, FEXCore::IR::IRListView const *IR);
+      static void BuildThreadedFragment(uint8_t *Buffer, FEXCore::IR::IRListView const *IR);
+
 #define DEF_OP(x) static void Op_##x(IR::IROp_Header *IROp, IROpData *Data, IR::NodeID Node)
 
   ///< Unhandled handler
@@ -152,6 +212,7 @@ namespace FEXCore::CPU {
   DEF_OP(Thunk);
   DEF_OP(ValidateCode);
   DEF_OP(ThreadRemoveCodeEntry);
+  DEF_OP(Safepoint);
   DEF_OP(CPUID);
 
   ///< Conversion ops
@@ -167,6 +228,8 @@ namespace FEXCore::CPU {
 
   ///< Flag ops
   DEF_OP(GetHostFlag);
+  DEF_OP(SubNZCV);
+  DEF_OP(AddNZCV);
 
   ///< Memory ops
   DEF_OP(LoadContext);
@@ -284,6 +347,7 @@ namespace FEXCore::CPU {
   DEF_OP(VSMull2);
   DEF_OP(VUABDL);
   DEF_OP(VTBL1);
+  DEF_OP(VPermute);
   DEF_OP(VRev64);
 
   ///< Encryption ops
@@ -2177,6 +2177,24 @@ DEF_OP(VTBL1) {
   memcpy(GDP, Tmp, OpSize);
 }
 
+DEF_OP(VPermute) {
+  const auto Op = IROp->C<IR::IROp_VPermute>();
+  const uint8_t OpSize = IROp->Size;
+
+  uint8_t Table[Core::CPUState::XMM_SSE_REG_SIZE * 2];
+  memcpy(&Table[0], GetSrc<void*>(Data->SSAData, Op->VectorLower), Core::CPUState::XMM_SSE_REG_SIZE);
+  memcpy(&Table[Core::CPUState::XMM_SSE_REG_SIZE], GetSrc<void*>(Data->SSAData, Op->VectorUpper), Core::CPUState::XMM_SSE_REG_SIZE);
+
+  uint8_t Tmp[Core::CPUState::XMM_SSE_REG_SIZE];
+
+  for (size_t i = 0; i < OpSize; ++i) {
+    const uint64_t Indices = i < 8 ? Op->IndicesLow : Op->IndicesHigh;
+    const uint8_t Index = Indices >> ((i % 8) * 8);
+    Tmp[i] = Index >= sizeof(Table) ? 0 : Table[Index];
+  }
+  memcpy(GDP, Tmp, OpSize);
+}
+
 DEF_OP(VRev64) {
   const auto Op = IROp->C<IR::IROp_VRev64>();
   const uint8_t OpSize = IROp->Size;
@@ -6,6 +6,7 @@ $end_info$
 
 #include "Interface/Context/Context.h"
 #include "FEXCore/IR/IR.h"
+#include "Interface/Core/CodeHash.h"
 #include "Interface/Core/LookupCache.h"
 
 #include "Interface/Core/JIT/Arm64/JITClass.h"
@@ -16,6 +17,9 @@ $end_info$
 #include <FEXCore/Utils/MathUtils.h>
 #include <Interface/HLE/Thunks/Thunks.h>
 
+#include <array>
+#include <cstring>
+
 namespace FEXCore::CPU {
 using namespace vixl;
 using namespace vixl::aarch64;
@@ -78,6 +82,69 @@ DEF_OP(ExitFunction) {
   } else {
     RipReg = GetReg<RA_64>(Op->NewRIP.ID());
 
+    if (IndirectBranchCache) {
+      using IndirectBranchCacheRecord = LookupCache::IndirectBranchCacheRecord;
+
+      Label CacheRecord;
+      Label CacheMiss;
+      auto SiteStats = CTX->Config.IndirectBranchStats() ? ThreadState->LookupCache->AllocateIndirectBranchSite(Entry) : nullptr;
+
+      // Inline cache of the targets this exit has seen
+      // Each entry gets its own br for better branch prediction
+      adr(x0, &CacheRecord);
+      for (size_t i = 0; i < IndirectBranchCacheRecord::NUM_ENTRIES; ++i) {
+        Label NextEntry;
+        ldp(x1, x2, MemOperand(x0, offsetof(IndirectBranchCacheRecord, Entries[i])));
+        cmp(x2, RipReg);
+        b(&NextEntry, Condition::ne);
+        if (SiteStats) {
+          ldr(x3, MemOperand(x0, offsetof(IndirectBranchCacheRecord, Stats)));
+          ldr(x2, MemOperand(x3, offsetof(LookupCache::IndirectBranchSiteStats, Hits)));
+          add(x2, x2, 1);
+          str(x2, MemOperand(x3, offsetof(LookupCache::IndirectBranchSiteStats, Hits)));
+        }
+        br(x1);
+        bind(&NextEntry);
+      }
+
+      if (SiteStats) {
+        ldr(x3, MemOperand(x0, offsetof(IndirectBranchCacheRecord, Stats)));
+        ldr(x2, MemOperand(x3, offsetof(LookupCache::IndirectBranchSiteStats, Misses)));
+        add(x2, x2, 1);
+        str(x2, MemOperand(x3, offsetof(LookupCache::IndirectBranchSiteStats, Misses)));
+      }
+
+      // Once the site is out of fills it is considered megamorphic and only uses the L1 cache
+      ldr(x1, MemOperand(x0, offsetof(IndirectBranchCacheRecord, FillsRemaining)));
+      cbz(x1, &CacheMiss);
+
+      // The linker fills an entry and branches to the target
+      str(RipReg, MemOperand(STATE, offsetof(FEXCore::Core::CpuStateFrame, State.rip)));
+      ldr(x1, MemOperand(STATE, offsetof(FEXCore::Core::CpuStateFrame, Pointers.Common.IndirectBranchLinker)));
+
+      // The record follows the blr so it is passed through LR, keep it 8 byte aligned
+      if ((GetCursorAddress<uint64_t>() + 4) & 7) {
+        nop();
+      }
+      blr(x1);
+
+      bind(&CacheRecord);
+      const IndirectBranchCacheRecord InitialRecord {
+        .Entries = {},
+        .FillsRemaining = LookupCache::INDIRECT_BRANCH_CACHE_FILLS,
+        .Stats = SiteStats,
+      };
+
+      std::array<uint64_t, sizeof(IndirectBranchCacheRecord) / sizeof(uint64_t)> RecordData;
+      memcpy(RecordData.data(), &InitialRecord, sizeof(InitialRecord));
+      for (auto Data : RecordData) {
+        Literal<uint64_t> l_Data{Data};
+        place(&l_Data);
+      }
+
+      bind(&CacheMiss);
+    }
+
     // L1 Cache
     ldr(x0, MemOperand(STATE, offsetof(FEXCore::Core::CpuStateFrame, Pointers.Common.L1Pointer)));
 
@@ -393,50 +460,42 @@ DEF_OP(Thunk) {
 
 DEF_OP(ValidateCode) {
   auto Op = IROp->C<IR::IROp_ValidateCode>();
-  const auto *OldCode = (const uint8_t *)&Op->CodeOriginalLow;
-  int len = Op->CodeLength;
-  int idx = 0;
+  auto Dst = GetReg<RA_64>(Node);
+  uint32_t Length = Op->CodeLength;
 
-  LoadConstant(GetReg<RA_64>(Node), 0);
+  // Rehash the code with CodeHash::Hash and compare against the hash from compile time
   LoadConstant(x0, Entry + Op->Offset);
-  LoadConstant(x1, 1);
-
-  while (len >= 8)
-  {
-    ldr(x2, MemOperand(x0, idx));
-    LoadConstant(x3, *(const uint32_t *)(OldCode + idx));
-    cmp(x2, x3);
-    csel(GetReg<RA_64>(Node), GetReg<RA_64>(Node), x1, Condition::eq);
-    len -= 8;
-    idx += 8;
+  LoadConstant(x1, CodeHash::SEED);
+  LoadConstant(x3, CodeHash::MULTIPLIER);
+
+  const auto Step = [this]() {
+    eor(x1, x1, x2);
+    mul(x1, x1, x3);
+  };
+
+  while (Length >= 8) {
+    ldr(x2, MemOperand(x0, 8, PostIndex));
+    Step();
+    Length -= 8;
   }
-  while (len >= 4)
-  {
-    ldr(w2, MemOperand(x0, idx));
-    LoadConstant(w3, *(const uint32_t *)(OldCode + idx));
-    cmp(w2, w3);
-    csel(GetReg<RA_64>(Node), GetReg<RA_64>(Node), x1, Condition::eq);
-    len -= 4;
-    idx += 4;
+  if (Length >= 4) {
+    ldr(w2, MemOperand(x0, 4, PostIndex));
+    Step();
+    Length -= 4;
   }
-  while (len >= 2)
-  {
-    ldrh(w2, MemOperand(x0, idx));
-    LoadConstant(w3, *(const uint16_t *)(OldCode + idx));
-    cmp(w2, w3);
-    csel(GetReg<RA_64>(Node), GetReg<RA_64>(Node), x1, Condition::eq);
-    len -= 2;
-    idx += 2;
+  if (Length >= 2) {
+    ldrh(w2, MemOperand(x0, 2, PostIndex));
+    Step();
+    Length -= 2;
   }
-  while (len >= 1)
-  {
-    ldrb(w2, MemOperand(x0, idx));
-    LoadConstant(w3, *(const uint8_t *)(OldCode + idx));
-    cmp(w2, w3);
-    csel(GetReg<RA_64>(Node), GetReg<RA_64>(Node), x1, Condition::eq);
-    len -= 1;
-    idx += 1;
+  if (Length >= 1) {
+    ldrb(w2, MemOperand(x0));
+    Step();
   }
+
+  LoadConstant(x2, Op->CodeHash);
+  cmp(x1, x2);
+  cset(Dst, Condition::ne);
 }
 
 DEF_OP(ThreadRemoveCodeEntry) {
@@ -462,6 +521,23 @@ DEF_OP(ThreadRemoveCodeEntry) {
   PopDynamicRegsAndLR();
 }
 
+DEF_OP(Safepoint) {
+  auto Op = IROp->C<IR::IROp_Safepoint>();
+
+  Label NoRequest;
+  ldr(w0, MemOperand(STATE, offsetof(FEXCore::Core::CpuStateFrame, SafepointRequest)));
+  cbz(w0, &NoRequest);
+
+  // Guest state is already in the context at a block start, leave through the dispatcher which handles the request
+  ResetStack();
+  LoadConstant(x0, Entry + Op->Offset);
+  str(x0, MemOperand(STATE, offsetof(FEXCore::Core::CpuStateFrame, State.rip)));
+  ldr(x0, MemOperand(STATE, offsetof(FEXCore::Core::CpuStateFrame, Pointers.Common.DispatcherLoopTop)));
+  br(x0);
+
+  bind(&NoRequest);
+}
+
 DEF_OP(CPUID) {
   auto Op = IROp->C<IR::IROp_CPUID>();
 
@@ -504,6 +580,7 @@ void Arm64JITCore::RegisterBranchHandlers() {
   REGISTER_OP(THUNK,             Thunk);
   REGISTER_OP(VALIDATECODE,      ValidateCode);
   REGISTER_OP(THREADREMOVECODEENTRY,   ThreadRemoveCodeEntry);
+  REGISTER_OP(SAFEPOINT,         Safepoint);
   REGISTER_OP(CPUID,             CPUID);
 #undef REGISTER_OP
 }
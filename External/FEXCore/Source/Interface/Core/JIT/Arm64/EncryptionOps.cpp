@@ -4,6 +4,7 @@ tags: backend|arm64
 $end_info$
 */
 
+#include "Interface/Context/Context.h"
 #include "Interface/Core/JIT/Arm64/JITClass.h"
 #include "Interface/IR/Passes/RegisterAllocationPass.h"
 
@@ -132,14 +133,21 @@ DEF_OP(PCLMUL) {
 #undef DEF_OP
 void Arm64JITCore::RegisterEncryptionHandlers() {
 #define REGISTER_OP(op, x) OpHandlers[FEXCore::IR::IROps::OP_##op] = &Arm64JITCore::Op_##x
-  REGISTER_OP(VAESIMC,           AESImc);
-  REGISTER_OP(VAESENC,           AESEnc);
-  REGISTER_OP(VAESENCLAST,       AESEncLast);
-  REGISTER_OP(VAESDEC,           AESDec);
-  REGISTER_OP(VAESDECLAST,       AESDecLast);
-  REGISTER_OP(VAESKEYGENASSIST,  AESKeyGenAssist);
-  REGISTER_OP(CRC32,             CRC32);
-  REGISTER_OP(PCLMUL,            PCLMUL);
+  // Without the host extension these fall through to Op_Unhandled and the software fallbacks
+  if (CTX->HostFeatures.SupportsAES) {
+    REGISTER_OP(VAESIMC,           AESImc);
+    REGISTER_OP(VAESENC,           AESEnc);
+    REGISTER_OP(VAESENCLAST,       AESEncLast);
+    REGISTER_OP(VAESDEC,           AESDec);
+    REGISTER_OP(VAESDECLAST,       AESDecLast);
+    REGISTER_OP(VAESKEYGENASSIST,  AESKeyGenAssist);
+  }
+  if (CTX->HostFeatures.SupportsCRC) {
+    REGISTER_OP(CRC32,             CRC32);
+  }
+  if (CTX->HostFeatures.SupportsPMULL_128Bit) {
+    REGISTER_OP(PCLMUL,            PCLMUL);
+  }
 #undef REGISTER_OP
 }
 }
@@ -16,10 +16,63 @@ DEF_OP(GetHostFlag) {
   ubfx(GetReg<RA_64>(Node), GetReg<RA_64>(Op->Value.ID()), Op->Flag, 1);
 }
 
+DEF_OP(SubNZCV) {
+  auto Op = IROp->C<IR::IROp_SubNZCV>();
+  auto Dst = GetReg<RA_64>(Node);
+
+  switch (Op->SrcSize) {
+    case 1:
+    case 2: {
+      // Shifting the sources to the top of the register calculates the flags at SrcSize
+      const auto Shift = 32 - Op->SrcSize * 8;
+      lsl(TMP1.W(), GetReg<RA_32>(Op->Src1.ID()), Shift);
+      cmp(TMP1.W(), Operand(GetReg<RA_32>(Op->Src2.ID()), LSL, Shift));
+      break;
+    }
+    case 4:
+      cmp(GetReg<RA_32>(Op->Src1.ID()), GetReg<RA_32>(Op->Src2.ID()));
+      break;
+    case 8:
+      cmp(GetReg<RA_64>(Op->Src1.ID()), GetReg<RA_64>(Op->Src2.ID()));
+      break;
+    default: LOGMAN_MSG_A_FMT("Unsupported SubNZCV size: {}", Op->SrcSize);
+  }
+
+  mrs(Dst, NZCV);
+  // C is set when there was no borrow, x86 sets CF when there was
+  eor(Dst.W(), Dst.W(), 1U << 29);
+}
+
+DEF_OP(AddNZCV) {
+  auto Op = IROp->C<IR::IROp_AddNZCV>();
+  auto Dst = GetReg<RA_64>(Node);
+
+  switch (Op->SrcSize) {
+    case 1:
+    case 2: {
+      const auto Shift = 32 - Op->SrcSize * 8;
+      lsl(TMP1.W(), GetReg<RA_32>(Op->Src1.ID()), Shift);
+      cmn(TMP1.W(), Operand(GetReg<RA_32>(Op->Src2.ID()), LSL, Shift));
+      break;
+    }
+    case 4:
+      cmn(GetReg<RA_32>(Op->Src1.ID()), GetReg<RA_32>(Op->Src2.ID()));
+      break;
+    case 8:
+      cmn(GetReg<RA_64>(Op->Src1.ID()), GetReg<RA_64>(Op->Src2.ID()));
+      break;
+    default: LOGMAN_MSG_A_FMT("Unsupported AddNZCV size: {}", Op->SrcSize);
+  }
+
+  mrs(Dst, NZCV);
+}
+
 #undef DEF_OP
 void Arm64JITCore::RegisterFlagHandlers() {
 #define REGISTER_OP(op, x) OpHandlers[FEXCore::IR::IROps::OP_##op] = &Arm64JITCore::Op_##x
   REGISTER_OP(GETHOSTFLAG, GetHostFlag);
+  REGISTER_OP(SUBNZCV,     SubNZCV);
+  REGISTER_OP(ADDNZCV,     AddNZCV);
 #undef REGISTER_OP
 }
 }
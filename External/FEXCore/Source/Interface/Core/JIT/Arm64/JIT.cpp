@@ -32,6 +32,7 @@ $end_info$
 
 #include "Interface/Core/Interpreter/InterpreterOps.h"
 
+#include <algorithm>
 #include <sys/mman.h>
 #include <stdio.h>
 #include <unistd.h>
@@ -87,6 +88,12 @@ void Arm64JITCore::Op_Unhandled(IR::IROp_Header const *IROp, IR::NodeID Node) {
     LOGMAN_MSG_A_FMT("Unhandled IR Op: {}", FEXCore::IR::GetName(IROp->Op));
 #endif
   } else {
+    if (CTX->Config.GuestProfiler()) {
+      ldr(TMP1, MemOperand(STATE, offsetof(FEXCore::Core::CpuStateFrame, ExitCounters.Fallback)));
+      add(TMP1, TMP1, 1);
+      str(TMP1, MemOperand(STATE, offsetof(FEXCore::Core::CpuStateFrame, ExitCounters.Fallback)));
+    }
+
     switch(Info.ABI) {
       case FABI_VOID_U16:{
         SpillStaticRegs();
@@ -415,6 +422,77 @@ void Arm64JITCore::Op_Unhandled(IR::IROp_Header const *IROp, IR::NodeID Node) {
         ins(GetVReg(Node).V8H(), 4, w1);
       }
       break;
+      case FABI_I32_I32_I64:{
+        SpillStaticRegs();
+
+        PushDynamicRegsAndLR(TMP1);
+
+        mov(w0, GetReg<RA_32>(IROp->Args[0].ID()));
+        mov(x1, GetReg<RA_64>(IROp->Args[1].ID()));
+
+        ldr(x2, MemOperand(STATE, offsetof(FEXCore::Core::CpuStateFrame, Pointers.Common.FallbackHandlerPointers[Info.HandlerIndex])));
+#ifdef VIXL_SIMULATOR
+        GenerateIndirectRuntimeCall<uint32_t, uint32_t, uint64_t>(x2);
+#else
+        blr(x2);
+#endif
+
+        PopDynamicRegsAndLR();
+
+        FillStaticRegs();
+
+        mov(GetReg<RA_32>(Node), w0);
+      }
+      break;
+      case FABI_I128_I128:{
+        SpillStaticRegs();
+
+        PushDynamicRegsAndLR(TMP1);
+
+        umov(x0, GetVReg(IROp->Args[0].ID()).V2D(), 0);
+        umov(x1, GetVReg(IROp->Args[0].ID()).V2D(), 1);
+
+        ldr(x2, MemOperand(STATE, offsetof(FEXCore::Core::CpuStateFrame, Pointers.Common.FallbackHandlerPointers[Info.HandlerIndex])));
+#ifdef VIXL_SIMULATOR
+        GenerateIndirectRuntimeCall<__uint128_t, uint64_t, uint64_t>(x2);
+#else
+        blr(x2);
+#endif
+
+        PopDynamicRegsAndLR();
+
+        FillStaticRegs();
+
+        ins(GetVReg(Node).V2D(), 0, x0);
+        ins(GetVReg(Node).V2D(), 1, x1);
+      }
+      break;
+      case FABI_I128_I128_I128:{
+        SpillStaticRegs();
+
+        PushDynamicRegsAndLR(TMP1);
+
+        umov(x0, GetVReg(IROp->Args[0].ID()).V2D(), 0);
+        umov(x1, GetVReg(IROp->Args[0].ID()).V2D(), 1);
+
+        umov(x2, GetVReg(IROp->Args[1].ID()).V2D(), 0);
+        umov(x3, GetVReg(IROp->Args[1].ID()).V2D(), 1);
+
+        ldr(x4, MemOperand(STATE, offsetof(FEXCore::Core::CpuStateFrame, Pointers.Common.FallbackHandlerPointers[Info.HandlerIndex])));
+#ifdef VIXL_SIMULATOR
+        GenerateIndirectRuntimeCall<__uint128_t, uint64_t, uint64_t, uint64_t, uint64_t>(x4);
+#else
+        blr(x4);
+#endif
+
+        PopDynamicRegsAndLR();
+
+        FillStaticRegs();
+
+        ins(GetVReg(Node).V2D(), 0, x0);
+        ins(GetVReg(Node).V2D(), 1, x1);
+      }
+      break;
 
       case FABI_UNKNOWN:
       default:
@@ -445,6 +523,9 @@ static uint64_t Arm64JITCore_ExitFunctionLink(FEXCore::Core::CpuStateFrame *Fram
 
   auto offset = HostCode/4 - branch/4;
   if (IsInt26(offset)) {
+    // The branch only replaces the ldr of the linker address, delinking restores it
+    const auto LinkerLoad = *reinterpret_cast<uint32_t*>(branch);
+
     // optimal case - can branch directly
     // patch the code
     vixl::aarch64::Assembler emit((uint8_t*)(branch), 24);
@@ -453,25 +534,14 @@ static uint64_t Arm64JITCore_ExitFunctionLink(FEXCore::Core::CpuStateFrame *Fram
     emit.FinalizeCode();
     vixl::aarch64::CPU::EnsureIAndDCacheCoherency((void*)branch, 24);
 
-    // Add de-linking handler
-    Context::Context::ThreadAddBlockLink(Thread, GuestRip, (uintptr_t)record, [branch, LinkerAddress]{
-      vixl::aarch64::Assembler emit((uint8_t*)(branch), 24);
-      vixl::CodeBufferCheckScope scope(&emit, 24, vixl::CodeBufferCheckScope::kDontReserveBufferSpace, vixl::CodeBufferCheckScope::kNoAssert);
-      Literal l_BranchHost{LinkerAddress};
-      emit.ldr(x0, &l_BranchHost);
-      emit.blr(x0);
-      emit.place(&l_BranchHost);
-      emit.FinalizeCode();
-      vixl::aarch64::CPU::EnsureIAndDCacheCoherency((void*)branch, 24);
-    });
+    // Add de-linking record
+    Context::Context::ThreadAddBlockLink(Thread, GuestRip, branch, LookupCache::BlockLinkKind::Instruction, LinkerLoad);
   } else {
     // fallback case - do a soft-er link by patching the pointer
     record[0] = HostCode;
 
-    // Add de-linking handler
-    Context::Context::ThreadAddBlockLink(Thread, GuestRip, (uintptr_t)record, [record, LinkerAddress]{
-      record[0] = LinkerAddress;
-    });
+    // Add de-linking record
+    Context::Context::ThreadAddBlockLink(Thread, GuestRip, (uintptr_t)record, LookupCache::BlockLinkKind::Pointer, LinkerAddress);
   }
 
   return HostCode;
@@ -481,9 +551,10 @@ void Arm64JITCore::Op_NoOp(IR::IROp_Header const *IROp, IR::NodeID Node) {
 }
 
 Arm64JITCore::Arm64JITCore(FEXCore::Context::Context *ctx, FEXCore::Core::InternalThreadState *Thread)
-  : CPUBackend(Thread, INITIAL_CODE_SIZE, MAX_CODE_SIZE)
+  : CPUBackend(Thread, INITIAL_CODE_SIZE, MAX_CODE_SIZE, true)
   , Arm64Emitter(ctx, 0)
   , HostSupportsSVE{ctx->HostFeatures.SupportsAVX}
+  , IndirectBranchCache{ctx->Config.CacheObjectCodeCompilation() == FEXCore::Config::ConfigObjectCodeHandler::CONFIG_NONE}
   , CTX {ctx} {
 
   RAPass = Thread->PassManager->GetPass<IR::RegisterAllocationPass>("RA");
@@ -544,10 +615,11 @@ Arm64JITCore::Arm64JITCore(FEXCore::Context::Context *ctx, FEXCore::Core::Intern
     Common.SyscallHandlerObj = reinterpret_cast<uint64_t>(CTX->SyscallHandler);
     Common.SyscallHandlerFunc = reinterpret_cast<uint64_t>(FEXCore::Context::HandleSyscall);
     Common.ExitFunctionLink = reinterpret_cast<uintptr_t>(&Context::Context::ThreadExitFunctionLink<Arm64JITCore_ExitFunctionLink>);
+    Common.IndirectBranchLink = reinterpret_cast<uintptr_t>(&Context::Context::ThreadExitFunctionLink<Context::Context::ThreadIndirectBranchLink>);
 
 
     // Fill in the fallback handlers
-    InterpreterOps::FillFallbackIndexPointers(Common.FallbackHandlerPointers);
+    InterpreterOps::FillFallbackIndexPointers(Common.FallbackHandlerPointers, CTX->HostFeatures);
 
     // Platform Specific
     auto &AArch64 = ThreadState->CurrentFrame->Pointers.AArch64;
@@ -575,7 +647,22 @@ void Arm64JITCore::InitializeSignalHandlers(FEXCore::Context::Context *CTX) {
       return false;
     }
 
-    return FEXCore::ArchHelpers::Arm64::HandleSIGBUS(Thread->CTX->Config.ParanoidTSO(), Signal, info, ucontext);
+    const auto PC = ArchHelpers::Context::GetPc(ucontext);
+    const bool ParanoidTSO = Thread->CTX->Config.ParanoidTSO();
+    if (!FEXCore::ArchHelpers::Arm64::HandleSIGBUS(ParanoidTSO, Signal, info, ucontext)) {
+      return false;
+    }
+
+    if (!ParanoidTSO) {
+      // The access got backpatched, remember it so the next compile of this code doesn't fault again
+      auto &Pending = Thread->PendingUnalignedAccesses;
+      const auto GuestRIP = static_cast<Arm64JITCore*>(Thread->CPUBackend.get())->GetTSOAccessGuestRIP(PC);
+      if (GuestRIP && Pending.Count < Pending.RIPs.size()) {
+        Pending.RIPs[Pending.Count++] = GuestRIP;
+      }
+    }
+
+    return true;
   }, true);
 #endif
 }
@@ -587,11 +674,34 @@ void Arm64JITCore::EmitDetectionString() {
   Buffer->Align();
 }
 
+uint64_t Arm64JITCore::GetTSOAccessGuestRIP(uint64_t HostPC) const {
+  auto &Records = TSOAccesses[GetCodeRegionIndex(HostPC)];
+  auto it = std::lower_bound(Records.begin(), Records.end(), HostPC, [](TSOAccessRecord const &Record, uint64_t PC) {
+    return Record.HostPC < PC;
+  });
+
+  if (it != Records.end() && it->HostPC == HostPC) {
+    return it->GuestRIP;
+  }
+
+  return 0;
+}
+
 void Arm64JITCore::ClearCache() {
+  for (auto &Records : TSOAccesses) {
+    Records.clear();
+  }
+
   // Get the backing code buffer
+  [[maybe_unused]] auto CodeBuffer = GetEmptyCodeBuffer();
+  *GetBuffer() = vixl::CodeBuffer(CurrentCodeRegion.Ptr, CurrentCodeRegion.Size);
+  EmitDetectionString();
+}
+
+void Arm64JITCore::ResetCodeRegion() {
+  TSOAccesses[CurrentCodeRegionIndex].clear();
 
-  auto CodeBuffer = GetEmptyCodeBuffer();
-  *GetBuffer() = vixl::CodeBuffer(CodeBuffer->Ptr, CodeBuffer->Size);
+  *GetBuffer() = vixl::CodeBuffer(CurrentCodeRegion.Ptr, CurrentCodeRegion.Size);
   EmitDetectionString();
 }
 
@@ -658,6 +768,7 @@ void *Arm64JITCore::CompileCode(uint64_t Entry,
 
   using namespace aarch64;
   JumpTargets.clear();
+  VectorConstantPool.clear();
   uint32_t SSACount = IR->GetSSACount();
 
   this->Entry = Entry;
@@ -676,8 +787,15 @@ void *Arm64JITCore::CompileCode(uint64_t Entry,
 
   // Fairly excessive buffer range to make sure we don't overflow
   uint32_t BufferRange = SSACount * 16 + GDBEnabled * Dispatcher::MaxGDBPauseCheckSize;
-  if ((GetCursorOffset() + BufferRange) > CurrentCodeBuffer->Size) {
-    CTX->ClearCodeCache(ThreadState);
+  if (IndirectBranchCache) {
+    for (auto [CodeNode, IROp] : IR->GetAllCode()) {
+      if (IROp->Op == IR::OP_EXITFUNCTION) {
+        BufferRange += MaxIndirectBranchCacheSize;
+      }
+    }
+  }
+  if ((GetCursorOffset() + BufferRange) > CurrentCodeRegion.Size) {
+    CTX->ClearCodeRegion(ThreadState);
   }
 
   // AAPCS64
@@ -769,6 +887,17 @@ void *Arm64JITCore::CompileCode(uint64_t Entry,
   }
   PendingTargetLabel = nullptr;
 
+  if (!VectorConstantPool.empty()) {
+    while (reinterpret_cast<uintptr_t>(GetCursorAddress<uint8_t *>()) & 15) {
+      nop();
+    }
+
+    for (auto &[Key, Literal] : VectorConstantPool) {
+      place(&Literal);
+    }
+    VectorConstantPool.clear();
+  }
+
   FinalizeCode();
 
   auto CodeEnd = GetCursorAddress<uint8_t *>();
@@ -50,13 +50,22 @@ public:
 
   void ClearCache() override;
 
+  void ResetCodeRegion() override;
+
   static void InitializeSignalHandlers(FEXCore::Context::Context *CTX);
 
   void ClearRelocations() override { Relocations.clear(); }
 
+  // Returns the guest RIP of the acquire/release access at HostPC, or 0 if there isn't one
+  // Called from the SIGBUS handler so this must not allocate
+  [[nodiscard]] uint64_t GetTSOAccessGuestRIP(uint64_t HostPC) const;
+
 private:
   FEX_CONFIG_OPT(ParanoidTSO, PARANOIDTSO);
   const bool HostSupportsSVE{};
+  // Indirect block exits get an inline cache, unless the code is getting serialized
+  const bool IndirectBranchCache{};
+  constexpr static uint32_t MaxIndirectBranchCacheSize = 512;
 
   Label *PendingTargetLabel;
   FEXCore::Context::Context *CTX;
@@ -65,6 +74,24 @@ private:
 
   std::map<IR::NodeID, aarch64::Label> JumpTargets;
 
+  // Host PC and guest RIP of every acquire/release GPR access that the SIGBUS handler might backpatch
+  // One list per code region, each sorted by HostPC since a region is only appended to until it gets reset
+  struct TSOAccessRecord {
+    uint64_t HostPC;
+    uint64_t GuestRIP;
+  };
+  std::array<std::vector<TSOAccessRecord>, CODE_REGION_COUNT> TSOAccesses;
+
+  void RecordTSOAccess(int32_t GuestOffset) {
+    // ParanoidTSO emulates unaligned accesses instead of backpatching them
+    if (!ParanoidTSO()) {
+      TSOAccesses[CurrentCodeRegionIndex].push_back({GetCursorAddress<uint64_t>(), Entry + GuestOffset});
+    }
+  }
+
+  // 128-bit masks loaded by VPermute, placed after the last instruction of the block
+  std::map<std::pair<uint64_t, uint64_t>, aarch64::Literal<uint64_t>> VectorConstantPool;
+
   /**
    * @name Register Allocation
    * @{ */
@@ -353,6 +380,7 @@ private:
   DEF_OP(Thunk);
   DEF_OP(ValidateCode);
   DEF_OP(ThreadRemoveCodeEntry);
+  DEF_OP(Safepoint);
   DEF_OP(CPUID);
 
   ///< Conversion ops
@@ -368,6 +396,8 @@ private:
 
   ///< Flag ops
   DEF_OP(GetHostFlag);
+  DEF_OP(SubNZCV);
+  DEF_OP(AddNZCV);
 
   ///< Memory ops
   DEF_OP(LoadContext);
@@ -489,6 +519,7 @@ private:
   DEF_OP(VSMull2);
   DEF_OP(VUABDL);
   DEF_OP(VTBL1);
+  DEF_OP(VPermute);
   DEF_OP(VRev64);
 
   ///< Encryption ops
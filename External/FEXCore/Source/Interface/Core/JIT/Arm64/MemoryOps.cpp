@@ -990,6 +990,7 @@ DEF_OP(LoadMemTSO) {
     else {
       // Aligned
       nop();
+      RecordTSOAccess(Op->GuestOffset);
       const auto Dst = GetReg<RA_64>(Node);
       switch (OpSize) {
         case 2:
@@ -1020,6 +1021,7 @@ DEF_OP(LoadMemTSO) {
       // Aligned
       const auto Dst = GetReg<RA_64>(Node);
       nop();
+      RecordTSOAccess(Op->GuestOffset);
       switch (OpSize) {
         case 2:
           ldaprh(Dst, MemSrc);
@@ -1049,6 +1051,7 @@ DEF_OP(LoadMemTSO) {
       // Aligned
       const auto Dst = GetReg<RA_64>(Node);
       nop();
+      RecordTSOAccess(Op->GuestOffset);
       switch (OpSize) {
         case 2:
           ldarh(Dst, MemSrc);
@@ -1175,6 +1178,7 @@ DEF_OP(StoreMemTSO) {
     }
     else {
       nop();
+      RecordTSOAccess(Op->GuestOffset);
       switch (OpSize) {
         case 2:
           stlurh(GetReg<RA_64>(Op->Value.ID()), MemSrc);
@@ -1201,6 +1205,7 @@ DEF_OP(StoreMemTSO) {
     }
     else {
       nop();
+      RecordTSOAccess(Op->GuestOffset);
       switch (OpSize) {
         case 2:
           stlrh(GetReg<RA_64>(Op->Value.ID()), MemSrc);
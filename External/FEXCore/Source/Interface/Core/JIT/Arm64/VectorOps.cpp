@@ -5162,6 +5162,274 @@ DEF_OP(VTBL1) {
   }
 }
 
+DEF_OP(VPermute) {
+  const auto Op = IROp->C<IR::IROp_VPermute>();
+  const auto OpSize = IROp->Size;
+
+  const auto Dst = GetVReg(Node);
+  auto Lower = GetVReg(Op->VectorLower.ID());
+  auto Upper = GetVReg(Op->VectorUpper.ID());
+
+  constexpr uint8_t ZeroIndex = 0xFF;
+  std::array<uint8_t, 16> Indices{};
+  for (size_t i = 0; i < Indices.size(); ++i) {
+    const uint64_t Half = i < 8 ? Op->IndicesLow : Op->IndicesHigh;
+    const uint8_t Index = Half >> ((i % 8) * 8);
+    Indices[i] = Index >= 32 ? ZeroIndex : Index;
+  }
+
+  // Fold everything down to one table register when only one is used
+  bool UsesLower{}, UsesUpper{}, UsesZero{};
+  for (size_t i = 0; i < OpSize; ++i) {
+    UsesZero |= Indices[i] == ZeroIndex;
+    UsesLower |= Indices[i] < 16;
+    UsesUpper |= Indices[i] >= 16 && Indices[i] != ZeroIndex;
+  }
+
+  if (UsesUpper && (!UsesLower || Lower.GetCode() == Upper.GetCode())) {
+    for (auto &Index : Indices) {
+      if (Index != ZeroIndex) {
+        Index &= 15;
+      }
+    }
+    Lower = Upper;
+    UsesLower = true;
+    UsesUpper = false;
+  }
+  const bool SingleSource = !UsesUpper;
+  if (SingleSource) {
+    Upper = Lower;
+  }
+
+  if (!UsesLower && !UsesUpper) {
+    movi(Dst.V2D(), 0);
+    return;
+  }
+
+  const auto LoadIndices = [this](std::array<uint8_t, 16> const &Mask) {
+    uint64_t Low{}, High{};
+    for (size_t i = 0; i < 8; ++i) {
+      Low |= static_cast<uint64_t>(Mask[i]) << (i * 8);
+      High |= static_cast<uint64_t>(Mask[i + 8]) << (i * 8);
+    }
+
+    // Identical masks in a block share one literal
+    auto &Literal = VectorConstantPool.try_emplace(std::make_pair(Low, High), High, Low).first->second;
+    ldr(VTMP3.Q(), &Literal);
+  };
+
+  if (OpSize == 8) {
+    bool Identity = !UsesZero;
+    for (size_t i = 0; i < 8; ++i) {
+      Identity &= Indices[i] == i;
+    }
+
+    if (Identity) {
+      mov(Dst.V8B(), Lower.V8B());
+      return;
+    }
+
+    LoadIndices(Indices);
+    if (SingleSource) {
+      tbl(Dst.V8B(), Lower.V16B(), VTMP3.V8B());
+    }
+    else {
+      mov(VTMP1.V16B(), Lower.V16B());
+      mov(VTMP2.V16B(), Upper.V16B());
+      tbl(Dst.V8B(), VTMP1.V16B(), VTMP2.V16B(), VTMP3.V8B());
+    }
+    return;
+  }
+
+  LOGMAN_THROW_AA_FMT(OpSize == 16, "Unknown OpSize: {}", OpSize);
+
+  if (!UsesZero) {
+    // Byte granular shift across the two sources
+    // A single source matches with the index wrapping around
+    for (uint8_t Start = 0; Start < 16; ++Start) {
+      bool Matches = true;
+      for (size_t i = 0; i < 16 && Matches; ++i) {
+        Matches = Indices[i] == (SingleSource ? (Start + i) & 15 : Start + i);
+      }
+
+      if (Matches) {
+        if (Start == 0) {
+          if (Dst.GetCode() != Lower.GetCode()) {
+            mov(Dst.V16B(), Lower.V16B());
+          }
+        }
+        else {
+          ext(Dst.V16B(), Lower.V16B(), Upper.V16B(), Start);
+        }
+        return;
+      }
+    }
+
+    const auto Arrangement = [](aarch64::VRegister Reg, size_t ElementSize) {
+      switch (ElementSize) {
+        case 1: return Reg.V16B();
+        case 2: return Reg.V8H();
+        case 4: return Reg.V4S();
+        default: return Reg.V2D();
+      }
+    };
+
+    // Try the element shuffles from the widest element down
+    for (size_t ElementSize = 8; ElementSize > 0; ElementSize >>= 1) {
+      const size_t NumElements = 16 / ElementSize;
+
+      // Element index in to the Lower:Upper table for each destination element
+      std::array<uint8_t, 16> Sel{};
+      bool IsElements = true;
+      for (size_t e = 0; e < NumElements && IsElements; ++e) {
+        const uint8_t First = Indices[e * ElementSize];
+        IsElements = (First % ElementSize) == 0;
+        for (size_t i = 1; i < ElementSize && IsElements; ++i) {
+          IsElements = Indices[e * ElementSize + i] == First + i;
+        }
+        Sel[e] = First / ElementSize;
+      }
+
+      if (!IsElements) {
+        continue;
+      }
+
+      // With one source Upper elements are the same as Lower elements
+      const auto Matches = [&](auto Expected) {
+        for (size_t e = 0; e < NumElements; ++e) {
+          uint8_t Element = Expected(e);
+          if (SingleSource) {
+            Element %= NumElements;
+          }
+          if (Sel[e] != Element) {
+            return false;
+          }
+        }
+        return true;
+      };
+
+      const auto DstE = Arrangement(Dst, ElementSize);
+      const auto LowerE = Arrangement(Lower, ElementSize);
+      const auto UpperE = Arrangement(Upper, ElementSize);
+      const size_t Half = NumElements / 2;
+
+      if (Matches([&](size_t) { return Sel[0]; })) {
+        dup(DstE, Sel[0] < NumElements ? LowerE : UpperE, Sel[0] % NumElements);
+      }
+      else if (Matches([&](size_t e) { return (e & 1) ? NumElements + e / 2 : e / 2; })) {
+        zip1(DstE, LowerE, UpperE);
+      }
+      else if (Matches([&](size_t e) { return (e & 1) ? NumElements + Half + e / 2 : Half + e / 2; })) {
+        zip2(DstE, LowerE, UpperE);
+      }
+      else if (Matches([&](size_t e) { return e * 2; })) {
+        uzp1(DstE, LowerE, UpperE);
+      }
+      else if (Matches([&](size_t e) { return e * 2 + 1; })) {
+        uzp2(DstE, LowerE, UpperE);
+      }
+      else if (Matches([&](size_t e) { return (e & 1) ? NumElements + e - 1 : e; })) {
+        trn1(DstE, LowerE, UpperE);
+      }
+      else if (Matches([&](size_t e) { return (e & 1) ? NumElements + e : e + 1; })) {
+        trn2(DstE, LowerE, UpperE);
+      }
+      else {
+        // Insert of a single element in to one of the sources
+        size_t LowerMismatch{}, LowerElement{};
+        size_t UpperMismatch{}, UpperElement{};
+        for (size_t e = 0; e < NumElements; ++e) {
+          if (Sel[e] != e) {
+            ++LowerMismatch;
+            LowerElement = e;
+          }
+          if (Sel[e] != NumElements + e) {
+            ++UpperMismatch;
+            UpperElement = e;
+          }
+        }
+
+        const bool InsertInLower = LowerMismatch == 1;
+        if (!InsertInLower && (SingleSource || UpperMismatch != 1)) {
+          continue;
+        }
+
+        const auto Base = InsertInLower ? Lower : Upper;
+        const auto Other = InsertInLower ? Upper : Lower;
+        const size_t DestElement = InsertInLower ? LowerElement : UpperElement;
+        const size_t SrcElement = Sel[DestElement] % NumElements;
+        const auto Src = Sel[DestElement] < NumElements ? Lower : Upper;
+
+        if (Dst.GetCode() == Base.GetCode()) {
+          ins(DstE, DestElement, Arrangement(Src, ElementSize), SrcElement);
+        }
+        else if (Dst.GetCode() == Other.GetCode()) {
+          // Copying the base would clobber the inserted element's source
+          mov(VTMP1.V16B(), Base.V16B());
+          ins(Arrangement(VTMP1, ElementSize), DestElement, Arrangement(Src, ElementSize), SrcElement);
+          mov(Dst.V16B(), VTMP1.V16B());
+        }
+        else {
+          mov(Dst.V16B(), Base.V16B());
+          ins(DstE, DestElement, Arrangement(Src, ElementSize), SrcElement);
+        }
+      }
+      return;
+    }
+  }
+
+  if (SingleSource) {
+    LoadIndices(Indices);
+    tbl(Dst.V16B(), Lower.V16B(), VTMP3.V16B());
+    return;
+  }
+
+  // Blends keep one source in place and pull the rest of the bytes from the other source
+  // tbx leaves the destination byte alone for out of range indices
+  bool LowerInPlace = !UsesZero;
+  bool UpperInPlace = !UsesZero;
+  for (size_t i = 0; i < 16; ++i) {
+    LowerInPlace &= Indices[i] == i || Indices[i] >= 16;
+    UpperInPlace &= Indices[i] == 16 + i || Indices[i] < 16;
+  }
+
+  if (LowerInPlace || UpperInPlace) {
+    const auto Base = LowerInPlace ? Lower : Upper;
+    const auto Table = LowerInPlace ? Upper : Lower;
+
+    std::array<uint8_t, 16> Mask{};
+    for (size_t i = 0; i < 16; ++i) {
+      const bool FromTable = LowerInPlace ? Indices[i] >= 16 : Indices[i] < 16;
+      Mask[i] = FromTable ? (Indices[i] & 15) : ZeroIndex;
+    }
+    LoadIndices(Mask);
+
+    if (Dst.GetCode() == Table.GetCode()) {
+      mov(VTMP1.V16B(), Base.V16B());
+      tbx(VTMP1.V16B(), Table.V16B(), VTMP3.V16B());
+      mov(Dst.V16B(), VTMP1.V16B());
+    }
+    else {
+      if (Dst.GetCode() != Base.GetCode()) {
+        mov(Dst.V16B(), Base.V16B());
+      }
+      tbx(Dst.V16B(), Table.V16B(), VTMP3.V16B());
+    }
+    return;
+  }
+
+  LoadIndices(Indices);
+  if (Upper.GetCode() == Lower.GetCode() + 1) {
+    // Already a consecutive register pair
+    tbl(Dst.V16B(), Lower.V16B(), Upper.V16B(), VTMP3.V16B());
+  }
+  else {
+    mov(VTMP1.V16B(), Lower.V16B());
+    mov(VTMP2.V16B(), Upper.V16B());
+    tbl(Dst.V16B(), VTMP1.V16B(), VTMP2.V16B(), VTMP3.V16B());
+  }
+}
+
 DEF_OP(VRev64) {
   const auto Op = IROp->C<IR::IROp_VRev64>();
   const auto OpSize = IROp->Size;
@@ -5293,6 +5561,7 @@ void Arm64JITCore::RegisterVectorHandlers() {
   REGISTER_OP(VSMULL2,           VSMull2);
   REGISTER_OP(VUABDL,            VUABDL);
   REGISTER_OP(VTBL1,             VTBL1);
+  REGISTER_OP(VPERMUTE,          VPermute);
   REGISTER_OP(VREV64,            VRev64);
 #undef REGISTER_OP
 }
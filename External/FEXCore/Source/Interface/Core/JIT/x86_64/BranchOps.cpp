@@ -5,6 +5,7 @@ $end_info$
 */
 
 #include "Interface/Context/Context.h"
+#include "Interface/Core/CodeHash.h"
 #include "Interface/Core/CPUID.h"
 #include "Interface/Core/Dispatcher/Dispatcher.h"
 #include "Interface/Core/LookupCache.h"
@@ -20,6 +21,7 @@ $end_info$
 #include <FEXCore/Utils/LogManager.h>
 
 #include <array>
+#include <cstring>
 #include <memory>
 #include <stddef.h>
 #include <stdint.h>
@@ -91,6 +93,59 @@ DEF_OP(ExitFunction) {
   } else {
     Xbyak::Reg RipReg = GetSrc<RA_64>(Op->NewRIP.ID());
 
+    if (IndirectBranchCache) {
+      using IndirectBranchCacheRecord = LookupCache::IndirectBranchCacheRecord;
+
+      Label CacheRecord;
+      Label CacheMiss;
+      auto SiteStats = CTX->Config.IndirectBranchStats() ? ThreadState->LookupCache->AllocateIndirectBranchSite(Entry) : nullptr;
+
+      // Inline cache of the targets this exit has seen
+      // Each entry gets its own jmp for better branch prediction
+      lea(rcx, ptr[rip + CacheRecord]);
+      for (size_t i = 0; i < IndirectBranchCacheRecord::NUM_ENTRIES; ++i) {
+        Label NextEntry;
+        cmp(qword[rcx + offsetof(IndirectBranchCacheRecord, Entries[i].GuestCode)], RipReg);
+        jne(NextEntry);
+        if (SiteStats) {
+          mov(rax, qword[rcx + offsetof(IndirectBranchCacheRecord, Stats)]);
+          inc(qword[rax + offsetof(LookupCache::IndirectBranchSiteStats, Hits)]);
+        }
+        jmp(qword[rcx + offsetof(IndirectBranchCacheRecord, Entries[i].HostCode)]);
+        L(NextEntry);
+      }
+
+      if (SiteStats) {
+        mov(rax, qword[rcx + offsetof(IndirectBranchCacheRecord, Stats)]);
+        inc(qword[rax + offsetof(LookupCache::IndirectBranchSiteStats, Misses)]);
+      }
+
+      // Once the site is out of fills it is considered megamorphic and only uses the L1 cache
+      cmp(qword[rcx + offsetof(IndirectBranchCacheRecord, FillsRemaining)], 0);
+      je(CacheMiss, T_NEAR);
+
+      // The linker fills an entry and jumps to the target
+      mov(qword [STATE + offsetof(FEXCore::Core::CpuStateFrame, State.rip)], RipReg);
+      mov(rax, rcx);
+      jmp(qword [STATE + offsetof(FEXCore::Core::CpuStateFrame, Pointers.Common.IndirectBranchLinker)]);
+
+      align(8);
+      L(CacheRecord);
+      const IndirectBranchCacheRecord InitialRecord {
+        .Entries = {},
+        .FillsRemaining = LookupCache::INDIRECT_BRANCH_CACHE_FILLS,
+        .Stats = SiteStats,
+      };
+
+      std::array<uint64_t, sizeof(IndirectBranchCacheRecord) / sizeof(uint64_t)> RecordData;
+      memcpy(RecordData.data(), &InitialRecord, sizeof(InitialRecord));
+      for (auto Data : RecordData) {
+        dq(Data);
+      }
+
+      L(CacheMiss);
+    }
+
     // L1 Cache
     mov(rcx, qword [STATE + offsetof(FEXCore::Core::CpuStateFrame, Pointers.Common.L1Pointer)]);
 
@@ -225,32 +280,45 @@ DEF_OP(Thunk) {
 
 DEF_OP(ValidateCode) {
   auto Op = IROp->C<IR::IROp_ValidateCode>();
-  const auto* OldCode = (const uint8_t*)&Op->CodeOriginalLow;
-  int len = Op->CodeLength;
-  int idx = 0;
+  auto Dst = GetDst<RA_64>(Node);
+  uint32_t Length = Op->CodeLength;
+  uint32_t idx = 0;
 
-  xor_(GetDst<RA_64>(Node), GetDst<RA_64>(Node));
+  // Rehash the code with CodeHash::Hash and compare against the hash from compile time
   mov(rax, Entry + Op->Offset);
-  mov(rbx, 1);
-  while (len >= 4) {
-    cmp(dword[rax + idx], *(const uint32_t*)(OldCode + idx));
-    cmovne(GetDst<RA_64>(Node), rbx);
-    len-=4;
-    idx+=4;
+  mov(rcx, CodeHash::SEED);
+  mov(rdx, CodeHash::MULTIPLIER);
+
+  while (Length >= 8) {
+    xor_(rcx, qword[rax + idx]);
+    imul(rcx, rdx);
+    Length -= 8;
+    idx += 8;
   }
-  while (len >= 2) {
-    mov(rcx, *(const uint16_t*)(OldCode + idx));
-    cmp(word[rax + idx], cx);
-    cmovne(GetDst<RA_64>(Node), rbx);
-    len-=2;
-    idx+=2;
+  if (Length >= 4) {
+    mov(ebx, dword[rax + idx]);
+    xor_(rcx, rbx);
+    imul(rcx, rdx);
+    Length -= 4;
+    idx += 4;
   }
-  while (len >= 1) {
-    cmp(byte[rax + idx], *(const uint8_t*)(OldCode + idx));
-    cmovne(GetDst<RA_64>(Node), rbx);
-    len-=1;
-    idx+=1;
+  if (Length >= 2) {
+    movzx(ebx, word[rax + idx]);
+    xor_(rcx, rbx);
+    imul(rcx, rdx);
+    Length -= 2;
+    idx += 2;
   }
+  if (Length >= 1) {
+    movzx(ebx, byte[rax + idx]);
+    xor_(rcx, rbx);
+    imul(rcx, rdx);
+  }
+
+  mov(rbx, Op->CodeHash);
+  xor_(Dst, Dst);
+  cmp(rcx, rbx);
+  setne(Dst.cvt8());
 }
 
 DEF_OP(ThreadRemoveCodeEntry) {
@@ -275,6 +343,25 @@ DEF_OP(ThreadRemoveCodeEntry) {
     pop(RA64[i - 1]);
 }
 
+DEF_OP(Safepoint) {
+  auto Op = IROp->C<IR::IROp_Safepoint>();
+
+  Label NoRequest;
+  cmp(dword [STATE + offsetof(FEXCore::Core::CpuStateFrame, SafepointRequest)], 0);
+  je(NoRequest, T_NEAR);
+
+  // Guest state is already in the context at a block start, leave through the dispatcher which handles the request
+  if (SpillSlots) {
+    add(rsp, SpillSlots * MaxSpillSlotSize);
+  }
+
+  mov(TMP1, Entry + Op->Offset);
+  mov(qword [STATE + offsetof(FEXCore::Core::CpuStateFrame, State.rip)], TMP1);
+  jmp(qword [STATE + offsetof(FEXCore::Core::CpuStateFrame, Pointers.Common.DispatcherLoopTop)]);
+
+  L(NoRequest);
+}
+
 DEF_OP(CPUID) {
   auto Op = IROp->C<IR::IROp_CPUID>();
 
@@ -323,6 +410,7 @@ void X86JITCore::RegisterBranchHandlers() {
   REGISTER_OP(THUNK,             Thunk);
   REGISTER_OP(VALIDATECODE,      ValidateCode);
   REGISTER_OP(THREADREMOVECODEENTRY,   ThreadRemoveCodeEntry);
+  REGISTER_OP(SAFEPOINT,         Safepoint);
   REGISTER_OP(CPUID,             CPUID);
 #undef REGISTER_OP
 }
@@ -4,6 +4,7 @@ tags: backend|x86-64
 $end_info$
 */
 
+#include "Interface/Context/Context.h"
 #include "Interface/Core/JIT/x86_64/JITClass.h"
 
 #include <FEXCore/IR/IR.h>
@@ -98,14 +99,21 @@ DEF_OP(PCLMUL) {
 #undef DEF_OP
 void X86JITCore::RegisterEncryptionHandlers() {
 #define REGISTER_OP(op, x) OpHandlers[FEXCore::IR::IROps::OP_##op] = &X86JITCore::Op_##x
-  REGISTER_OP(VAESIMC,           AESImc);
-  REGISTER_OP(VAESENC,           AESEnc);
-  REGISTER_OP(VAESENCLAST,       AESEncLast);
-  REGISTER_OP(VAESDEC,           AESDec);
-  REGISTER_OP(VAESDECLAST,       AESDecLast);
-  REGISTER_OP(VAESKEYGENASSIST,  AESKeyGenAssist);
-  REGISTER_OP(CRC32,             CRC32);
-  REGISTER_OP(PCLMUL,            PCLMUL);
+  // Without the host extension these fall through to Op_Unhandled and the software fallbacks
+  if (CTX->HostFeatures.SupportsAES) {
+    REGISTER_OP(VAESIMC,           AESImc);
+    REGISTER_OP(VAESENC,           AESEnc);
+    REGISTER_OP(VAESENCLAST,       AESEncLast);
+    REGISTER_OP(VAESDEC,           AESDec);
+    REGISTER_OP(VAESDECLAST,       AESDecLast);
+    REGISTER_OP(VAESKEYGENASSIST,  AESKeyGenAssist);
+  }
+  if (CTX->HostFeatures.SupportsCRC) {
+    REGISTER_OP(CRC32,             CRC32);
+  }
+  if (CTX->HostFeatures.SupportsPMULL_128Bit) {
+    REGISTER_OP(PCLMUL,            PCLMUL);
+  }
 #undef REGISTER_OP
 }
 }
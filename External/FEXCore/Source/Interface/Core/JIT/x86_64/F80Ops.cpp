@@ -0,0 +1,193 @@
+/*
+$info$
+tags: backend|x86-64
+$end_info$
+*/
+
+#include "Interface/Context/Context.h"
+#include "Interface/Core/JIT/x86_64/JITClass.h"
+
+#include <FEXCore/IR/IR.h>
+
+#include <stdint.h>
+#include <xbyak/xbyak.h>
+
+namespace FEXCore::CPU {
+// The host x87 does the F80 arithmetic directly.
+// F80LoadFCW keeps the guest precision and rounding control in the frame, each arithmetic op loads it in to the
+// host FCW for its x87 sequence and then restores the host's own FCW so the rest of the host code never sees it.
+// Results match SoftFloat, which unittests/APITests/X80SoftFloat.cpp checks for every rounding mode and precision.
+
+// Xbyak has no 80-bit memory forms of fld and fstp, so encode the [rsp + disp8] forms directly
+static void LoadF80(Xbyak::CodeGenerator *Emit, int8_t Offset) {
+  // fld tword [rsp + Offset]
+  Emit->db(0xDB);
+  Emit->db(0x6C);
+  Emit->db(0x24);
+  Emit->db(Offset);
+}
+
+static void StoreF80(Xbyak::CodeGenerator *Emit, int8_t Offset) {
+  // fstp tword [rsp + Offset]
+  Emit->db(0xDB);
+  Emit->db(0x7C);
+  Emit->db(0x24);
+  Emit->db(Offset);
+}
+
+// Saves the host FCW to [rsp + Offset] and loads the guest one
+static void EnterGuestFCW(Xbyak::CodeGenerator *Emit, int8_t Offset) {
+  using namespace Xbyak::util;
+  Emit->fnstcw(Emit->word[rsp + Offset]);
+  Emit->fldcw(Emit->word[STATE + offsetof(FEXCore::Core::CpuStateFrame, F80GuestFCW)]);
+}
+
+static void ExitGuestFCW(Xbyak::CodeGenerator *Emit, int8_t Offset) {
+  using namespace Xbyak::util;
+  Emit->fldcw(Emit->word[rsp + Offset]);
+}
+
+#define DEF_OP(x) void X86JITCore::Op_##x(IR::IROp_Header *IROp, IR::NodeID Node)
+
+DEF_OP(F80LoadFCW) {
+  auto Op = IROp->C<IR::IROp_F80LoadFCW>();
+
+  // Ops that still fall back to SoftFloat use its rounding state
+  Op_Unhandled(IROp, Node);
+
+  // Precision and rounding control only, every exception stays masked
+  mov(eax, GetSrc<RA_32>(Op->Src.ID()));
+  and_(eax, 0xF00);
+  or_(eax, 0x7F);
+
+  mov(word [STATE + offsetof(FEXCore::Core::CpuStateFrame, F80GuestFCW)], ax);
+}
+
+DEF_OP(F80Add) {
+  auto Op = IROp->C<IR::IROp_F80Add>();
+
+  sub(rsp, 48);
+  movups(xword [rsp], GetSrc(Op->X80Src1.ID()));
+  movups(xword [rsp + 16], GetSrc(Op->X80Src2.ID()));
+  EnterGuestFCW(this, 32);
+  LoadF80(this, 0);
+  LoadF80(this, 16);
+  // st1 = st1 + st0, pop
+  faddp();
+  StoreF80(this, 0);
+  ExitGuestFCW(this, 32);
+
+  movq(GetDst(Node), qword [rsp]);
+  pinsrw(GetDst(Node), word [rsp + 8], 4);
+  add(rsp, 48);
+}
+
+DEF_OP(F80Sub) {
+  auto Op = IROp->C<IR::IROp_F80Sub>();
+
+  sub(rsp, 48);
+  movups(xword [rsp], GetSrc(Op->X80Src1.ID()));
+  movups(xword [rsp + 16], GetSrc(Op->X80Src2.ID()));
+  EnterGuestFCW(this, 32);
+  LoadF80(this, 0);
+  LoadF80(this, 16);
+  // st1 = st1 - st0, pop
+  fsubp();
+  StoreF80(this, 0);
+  ExitGuestFCW(this, 32);
+
+  movq(GetDst(Node), qword [rsp]);
+  pinsrw(GetDst(Node), word [rsp + 8], 4);
+  add(rsp, 48);
+}
+
+DEF_OP(F80Mul) {
+  auto Op = IROp->C<IR::IROp_F80Mul>();
+
+  sub(rsp, 48);
+  movups(xword [rsp], GetSrc(Op->X80Src1.ID()));
+  movups(xword [rsp + 16], GetSrc(Op->X80Src2.ID()));
+  EnterGuestFCW(this, 32);
+  LoadF80(this, 0);
+  LoadF80(this, 16);
+  // st1 = st1 * st0, pop
+  fmulp();
+  StoreF80(this, 0);
+  ExitGuestFCW(this, 32);
+
+  movq(GetDst(Node), qword [rsp]);
+  pinsrw(GetDst(Node), word [rsp + 8], 4);
+  add(rsp, 48);
+}
+
+DEF_OP(F80Div) {
+  auto Op = IROp->C<IR::IROp_F80Div>();
+
+  sub(rsp, 48);
+  movups(xword [rsp], GetSrc(Op->X80Src1.ID()));
+  movups(xword [rsp + 16], GetSrc(Op->X80Src2.ID()));
+  EnterGuestFCW(this, 32);
+  LoadF80(this, 0);
+  LoadF80(this, 16);
+  // st1 = st1 / st0, pop
+  fdivp();
+  StoreF80(this, 0);
+  ExitGuestFCW(this, 32);
+
+  movq(GetDst(Node), qword [rsp]);
+  pinsrw(GetDst(Node), word [rsp + 8], 4);
+  add(rsp, 48);
+}
+
+DEF_OP(F80Cmp) {
+  auto Op = IROp->C<IR::IROp_F80Cmp>();
+  auto Dst = GetDst<RA_32>(Node);
+
+  sub(rsp, 32);
+  movups(xword [rsp], GetSrc(Op->X80Src1.ID()));
+  movups(xword [rsp + 16], GetSrc(Op->X80Src2.ID()));
+  xor_(Dst, Dst);
+
+  // Compares don't round, so they run with the host FCW
+  LoadF80(this, 16);
+  LoadF80(this, 0);
+  fucomip(st1);
+  fstp(st0);
+
+  // Unordered sets all three flags, so LT and EQ only count when PF is clear
+  setb(al);
+  setz(cl);
+  setp(dl);
+
+  if (Op->Flags & (1 << IR::FCMP_FLAG_LT)) {
+    xor_(al, dl);
+    movzx(eax, al);
+    shl(eax, IR::FCMP_FLAG_LT);
+    or_(Dst, eax);
+  }
+  if (Op->Flags & (1 << IR::FCMP_FLAG_EQ)) {
+    xor_(cl, dl);
+    movzx(ecx, cl);
+    shl(ecx, IR::FCMP_FLAG_EQ);
+    or_(Dst, ecx);
+  }
+  if (Op->Flags & (1 << IR::FCMP_FLAG_UNORDERED)) {
+    movzx(edx, dl);
+    shl(edx, IR::FCMP_FLAG_UNORDERED);
+    or_(Dst, edx);
+  }
+  add(rsp, 32);
+}
+
+#undef DEF_OP
+void X86JITCore::RegisterF80Handlers() {
+#define REGISTER_OP(op, x) OpHandlers[FEXCore::IR::IROps::OP_##op] = &X86JITCore::Op_##x
+  REGISTER_OP(F80LOADFCW,  F80LoadFCW);
+  REGISTER_OP(F80ADD,      F80Add);
+  REGISTER_OP(F80SUB,      F80Sub);
+  REGISTER_OP(F80MUL,      F80Mul);
+  REGISTER_OP(F80DIV,      F80Div);
+  REGISTER_OP(F80CMP,      F80Cmp);
+#undef REGISTER_OP
+}
+}
@@ -14,6 +14,28 @@ $end_info$
 
 namespace FEXCore::CPU {
 
+// Packs SF, ZF, CF and OF from the host flags in to the NZCV layout that SubNZCV and AddNZCV return
+static void PackNZCV(Xbyak::CodeGenerator *Emit, Xbyak::Reg32 const &Dst) {
+  using namespace Xbyak::util;
+  Emit->sets(al);
+  Emit->setz(cl);
+  Emit->setb(dl);
+  Emit->seto(dil);
+
+  Emit->movzx(eax, al);
+  Emit->shl(eax, 31);
+  Emit->movzx(ecx, cl);
+  Emit->shl(ecx, 30);
+  Emit->or_(eax, ecx);
+  Emit->movzx(ecx, dl);
+  Emit->shl(ecx, 29);
+  Emit->or_(eax, ecx);
+  Emit->movzx(ecx, dil);
+  Emit->shl(ecx, 28);
+  Emit->or_(eax, ecx);
+  Emit->mov(Dst, eax);
+}
+
 #define DEF_OP(x) void X86JITCore::Op_##x(IR::IROp_Header *IROp, IR::NodeID Node)
 DEF_OP(GetHostFlag) {
   auto Op = IROp->C<IR::IROp_GetHostFlag>();
@@ -24,10 +46,53 @@ DEF_OP(GetHostFlag) {
   mov(GetDst<RA_64>(Node), rax);
 }
 
+DEF_OP(SubNZCV) {
+  auto Op = IROp->C<IR::IROp_SubNZCV>();
+
+  switch (Op->SrcSize) {
+    case 1: cmp(GetSrc<RA_8>(Op->Src1.ID()), GetSrc<RA_8>(Op->Src2.ID())); break;
+    case 2: cmp(GetSrc<RA_16>(Op->Src1.ID()), GetSrc<RA_16>(Op->Src2.ID())); break;
+    case 4: cmp(GetSrc<RA_32>(Op->Src1.ID()), GetSrc<RA_32>(Op->Src2.ID())); break;
+    case 8: cmp(GetSrc<RA_64>(Op->Src1.ID()), GetSrc<RA_64>(Op->Src2.ID())); break;
+    default: LOGMAN_MSG_A_FMT("Unsupported SubNZCV size: {}", Op->SrcSize);
+  }
+
+  PackNZCV(this, GetDst<RA_32>(Node));
+}
+
+DEF_OP(AddNZCV) {
+  auto Op = IROp->C<IR::IROp_AddNZCV>();
+
+  // Only the flags are needed, so the add happens in a temporary
+  switch (Op->SrcSize) {
+    case 1:
+      mov(TMP4.cvt8(), GetSrc<RA_8>(Op->Src1.ID()));
+      add(TMP4.cvt8(), GetSrc<RA_8>(Op->Src2.ID()));
+      break;
+    case 2:
+      mov(TMP4.cvt16(), GetSrc<RA_16>(Op->Src1.ID()));
+      add(TMP4.cvt16(), GetSrc<RA_16>(Op->Src2.ID()));
+      break;
+    case 4:
+      mov(TMP4.cvt32(), GetSrc<RA_32>(Op->Src1.ID()));
+      add(TMP4.cvt32(), GetSrc<RA_32>(Op->Src2.ID()));
+      break;
+    case 8:
+      mov(TMP4, GetSrc<RA_64>(Op->Src1.ID()));
+      add(TMP4, GetSrc<RA_64>(Op->Src2.ID()));
+      break;
+    default: LOGMAN_MSG_A_FMT("Unsupported AddNZCV size: {}", Op->SrcSize);
+  }
+
+  PackNZCV(this, GetDst<RA_32>(Node));
+}
+
 #undef DEF_OP
 void X86JITCore::RegisterFlagHandlers() {
 #define REGISTER_OP(op, x) OpHandlers[FEXCore::IR::IROps::OP_##op] = &X86JITCore::Op_##x
   REGISTER_OP(GETHOSTFLAG, GetHostFlag);
+  REGISTER_OP(SUBNZCV,     SubNZCV);
+  REGISTER_OP(ADDNZCV,     AddNZCV);
 #undef REGISTER_OP
 }
 }
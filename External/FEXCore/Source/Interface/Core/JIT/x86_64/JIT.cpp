@@ -68,11 +68,12 @@ void X86JITCore::PushRegs() {
     vmovups(ptr[rsp + i * AVXRegSize], ToYMM(RAXMM_x[i]));
   }
 
-  for (const auto &Reg : RA64) {
+  // rbp, r12, r13 and r15 are callee saved so the called function already preserves them
+  for (const auto &Reg : RA64CallerSaved) {
     push(Reg);
   }
 
-  const auto NumPush = RA64.size();
+  const auto NumPush = RA64CallerSaved.size();
   if ((NumPush & 1) != 0) {
     // Align
     sub(rsp, 8);
@@ -81,15 +82,15 @@ void X86JITCore::PushRegs() {
 
 void X86JITCore::PopRegs() {
   const auto AVXRegSize = Core::CPUState::XMM_AVX_REG_SIZE;
-  const auto NumPush = RA64.size();
+  const auto NumPush = RA64CallerSaved.size();
 
   if ((NumPush & 1) != 0) {
     // Align
     add(rsp, 8);
   }
 
-  for (uint32_t i = RA64.size(); i > 0; --i) {
-    pop(RA64[i - 1]);
+  for (uint32_t i = RA64CallerSaved.size(); i > 0; --i) {
+    pop(RA64CallerSaved[i - 1]);
   }
 
   for (size_t i = 0; i < RAXMM_x.size(); ++i) {
@@ -106,6 +107,10 @@ void X86JITCore::Op_Unhandled(IR::IROp_Header *IROp, IR::NodeID Node) {
     LOGMAN_MSG_A_FMT("Unhandled IR Op: {}", FEXCore::IR::GetName(IROp->Op));
 #endif
   } else {
+    if (CTX->Config.GuestProfiler()) {
+      inc(qword [STATE + offsetof(FEXCore::Core::CpuStateFrame, ExitCounters.Fallback)]);
+    }
+
     switch(Info.ABI) {
       case FABI_VOID_U16: {
         PushRegs();
@@ -301,6 +306,50 @@ void X86JITCore::Op_Unhandled(IR::IROp_Header *IROp, IR::NodeID Node) {
         pinsrw(GetDst(Node), edx, 4);
       }
       break;
+      case FABI_I32_I32_I64:{
+        PushRegs();
+
+        mov(edi, GetSrc<RA_32>(IROp->Args[0].ID()));
+        mov(rsi, GetSrc<RA_64>(IROp->Args[1].ID()));
+
+        call(qword [STATE + offsetof(FEXCore::Core::CpuStateFrame, Pointers.Common.FallbackHandlerPointers[Info.HandlerIndex])]);
+
+        PopRegs();
+
+        mov(GetDst<RA_32>(Node), eax);
+      }
+      break;
+      case FABI_I128_I128:{
+        PushRegs();
+
+        movq(rdi, GetSrc(IROp->Args[0].ID()));
+        pextrq(rsi, GetSrc(IROp->Args[0].ID()), 1);
+
+        call(qword [STATE + offsetof(FEXCore::Core::CpuStateFrame, Pointers.Common.FallbackHandlerPointers[Info.HandlerIndex])]);
+
+        PopRegs();
+
+        movq(GetDst(Node), rax);
+        pinsrq(GetDst(Node), rdx, 1);
+      }
+      break;
+      case FABI_I128_I128_I128:{
+        PushRegs();
+
+        movq(rdi, GetSrc(IROp->Args[0].ID()));
+        pextrq(rsi, GetSrc(IROp->Args[0].ID()), 1);
+
+        movq(rdx, GetSrc(IROp->Args[1].ID()));
+        pextrq(rcx, GetSrc(IROp->Args[1].ID()), 1);
+
+        call(qword [STATE + offsetof(FEXCore::Core::CpuStateFrame, Pointers.Common.FallbackHandlerPointers[Info.HandlerIndex])]);
+
+        PopRegs();
+
+        movq(GetDst(Node), rax);
+        pinsrq(GetDst(Node), rdx, 1);
+      }
+      break;
 
       case FABI_UNKNOWN:
       default:
@@ -325,10 +374,8 @@ static uint64_t X86JITCore_ExitFunctionLink(FEXCore::Core::CpuStateFrame *Frame,
   }
 
   auto LinkerAddress = Frame->Pointers.Common.ExitFunctionLinker;
-  Context::Context::ThreadAddBlockLink(Thread, GuestRip, (uintptr_t)record, [record, LinkerAddress]{
-    // undo the link
-    record[0] = LinkerAddress;
-  });
+  // undo the link by pointing back to the linker
+  Context::Context::ThreadAddBlockLink(Thread, GuestRip, (uintptr_t)record, LookupCache::BlockLinkKind::Pointer, LinkerAddress);
 
   record[0] = HostCode;
   return HostCode;
@@ -344,6 +391,8 @@ X86JITCore::X86JITCore(FEXCore::Context::Context *ctx, FEXCore::Core::InternalTh
 
   RAPass = Thread->PassManager->GetPass<IR::RegisterAllocationPass>("RA");
 
+  IndirectBranchCache = ctx->Config.CacheObjectCodeCompilation() == FEXCore::Config::ConfigObjectCodeHandler::CONFIG_NONE;
+
   RAPass->AllocateRegisterSet(RegisterCount, RegisterClasses);
   RAPass->AddRegisters(FEXCore::IR::GPRClass, NumGPRs);
   RAPass->AddRegisters(FEXCore::IR::FPRClass, NumXMMs);
@@ -368,6 +417,7 @@ X86JITCore::X86JITCore(FEXCore::Context::Context *ctx, FEXCore::Core::InternalTh
   RegisterMoveHandlers();
   RegisterVectorHandlers();
   RegisterEncryptionHandlers();
+  RegisterF80Handlers();
 
   {
     auto &Common = ThreadState->CurrentFrame->Pointers.Common;
@@ -385,9 +435,10 @@ X86JITCore::X86JITCore(FEXCore::Context::Context *ctx, FEXCore::Core::InternalTh
     Common.SyscallHandlerObj = reinterpret_cast<uint64_t>(CTX->SyscallHandler);
     Common.SyscallHandlerFunc = reinterpret_cast<uint64_t>(FEXCore::Context::HandleSyscall);
     Common.ExitFunctionLink = reinterpret_cast<uintptr_t>(&Context::Context::ThreadExitFunctionLink<X86JITCore_ExitFunctionLink>);
+    Common.IndirectBranchLink = reinterpret_cast<uintptr_t>(&Context::Context::ThreadExitFunctionLink<Context::Context::ThreadIndirectBranchLink>);
 
     // Fill in the fallback handlers
-    InterpreterOps::FillFallbackIndexPointers(Common.FallbackHandlerPointers);
+    InterpreterOps::FillFallbackIndexPointers(Common.FallbackHandlerPointers, CTX->HostFeatures);
   }
 
   // Must be done after Dispatcher init
@@ -594,6 +645,13 @@ void *X86JITCore::CompileCode(uint64_t Entry, [[maybe_unused]] FEXCore::IR::IRLi
 
   // Fairly excessive buffer range to make sure we don't overflow
   uint32_t BufferRange = SSACount * 16 + GDBEnabled * Dispatcher::MaxGDBPauseCheckSize;
+  if (IndirectBranchCache) {
+    for (auto [CodeNode, IROp] : IR->GetAllCode()) {
+      if (IROp->Op == IR::OP_EXITFUNCTION) {
+        BufferRange += MaxIndirectBranchCacheSize;
+      }
+    }
+  }
   if ((getSize() + BufferRange) > CurrentCodeBuffer->Size) {
     CTX->ClearCodeCache(ThreadState);
   }
@@ -45,6 +45,8 @@ namespace FEXCore::CPU {
 #define TMP5 rbx
 using namespace Xbyak::util;
 const std::array<Xbyak::Reg, 9> RA64 = { rsi, r8, r9, r10, r11, rbp, r12, r13, r15 };
+// Subset of RA64 that isn't preserved across calls in the SysV ABI
+const std::array<Xbyak::Reg, 5> RA64CallerSaved = { rsi, r8, r9, r10, r11 };
 const std::array<std::pair<Xbyak::Reg, Xbyak::Reg>, 4> RA64Pair = {{ {rsi, r8}, {r9, r10}, {r11, rbp}, {r12, r13} }};
 const std::array<Xbyak::Reg, 11> RAXMM = { xmm1, xmm2, xmm3, xmm4, xmm5, xmm6, xmm7, xmm8, xmm9, xmm10, xmm11};
 const std::array<Xbyak::Xmm, 11> RAXMM_x = {  xmm1, xmm2, xmm3, xmm4, xmm5, xmm6, xmm7, xmm8, xmm9, xmm10, xmm11};
@@ -139,6 +141,10 @@ private:
   FEXCore::IR::IRListView const *IR;
   uint64_t Entry;
 
+  // Indirect block exits get an inline cache, unless the code is getting serialized
+  bool IndirectBranchCache{};
+  constexpr static uint32_t MaxIndirectBranchCacheSize = 512;
+
   std::unordered_map<IR::NodeID, Label> JumpTargets;
   Xbyak::util::Cpu Features{};
 
@@ -228,7 +234,9 @@ private:
   void RegisterMoveHandlers();
   void RegisterVectorHandlers();
   void RegisterEncryptionHandlers();
+  void RegisterF80Handlers();
 
+  // Saves the registers a call in to host code can clobber
   void PushRegs();
   void PopRegs();
 #define DEF_OP(x) void Op_##x(IR::IROp_Header *IROp, IR::NodeID Node)
@@ -317,6 +325,7 @@ private:
   DEF_OP(Thunk);
   DEF_OP(ValidateCode);
   DEF_OP(ThreadRemoveCodeEntry);
+  DEF_OP(Safepoint);
   DEF_OP(CPUID);
 
   ///< Conversion ops
@@ -333,6 +342,8 @@ private:
 
   ///< Flag ops
   DEF_OP(GetHostFlag);
+  DEF_OP(SubNZCV);
+  DEF_OP(AddNZCV);
 
   ///< Memory ops
   DEF_OP(LoadContext);
@@ -450,6 +461,7 @@ private:
   DEF_OP(VSMull2);
   DEF_OP(VUABDL);
   DEF_OP(VTBL1);
+  DEF_OP(VPermute);
   DEF_OP(VRev64);
 
   ///< Encryption ops
@@ -461,6 +473,14 @@ private:
   DEF_OP(AESKeyGenAssist);
   DEF_OP(CRC32);
   DEF_OP(PCLMUL);
+
+  ///< F80 ops
+  DEF_OP(F80LoadFCW);
+  DEF_OP(F80Add);
+  DEF_OP(F80Sub);
+  DEF_OP(F80Mul);
+  DEF_OP(F80Div);
+  DEF_OP(F80Cmp);
 #undef DEF_OP
 };
 
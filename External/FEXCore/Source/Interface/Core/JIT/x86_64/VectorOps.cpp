@@ -4079,6 +4079,149 @@ DEF_OP(VTBL1) {
   }
 }
 
+DEF_OP(VPermute) {
+  const auto Op = IROp->C<IR::IROp_VPermute>();
+  const auto OpSize = IROp->Size;
+
+  const auto Dst = GetDst(Node);
+  auto Lower = GetSrc(Op->VectorLower.ID());
+  auto Upper = GetSrc(Op->VectorUpper.ID());
+
+  constexpr uint8_t ZeroIndex = 0xFF;
+  std::array<uint8_t, 16> Indices{};
+  for (size_t i = 0; i < Indices.size(); ++i) {
+    const uint64_t Half = i < 8 ? Op->IndicesLow : Op->IndicesHigh;
+    const uint8_t Index = Half >> ((i % 8) * 8);
+    Indices[i] = (i >= OpSize || Index >= 32) ? ZeroIndex : Index;
+  }
+
+  // Fold everything down to one source when only one is used
+  bool UsesLower{}, UsesUpper{}, UsesZero{};
+  for (size_t i = 0; i < OpSize; ++i) {
+    UsesZero |= Indices[i] == ZeroIndex;
+    UsesLower |= Indices[i] < 16;
+    UsesUpper |= Indices[i] >= 16 && Indices[i] != ZeroIndex;
+  }
+
+  if (UsesUpper && (!UsesLower || Lower.getIdx() == Upper.getIdx())) {
+    for (auto &Index : Indices) {
+      if (Index != ZeroIndex) {
+        Index &= 15;
+      }
+    }
+    Lower = Upper;
+    UsesLower = true;
+    UsesUpper = false;
+  }
+
+  if (!UsesLower && !UsesUpper) {
+    vpxor(Dst, Dst, Dst);
+    return;
+  }
+
+  if (OpSize == 16 && !UsesZero) {
+    bool Identity = !UsesUpper;
+    for (size_t i = 0; i < 16; ++i) {
+      Identity &= Indices[i] == i;
+    }
+
+    if (Identity) {
+      if (Dst.getIdx() != Lower.getIdx()) {
+        vmovapd(Dst, Lower);
+      }
+      return;
+    }
+
+    // 32-bit element shuffles
+    std::array<uint8_t, 4> Sel{};
+    bool IsElements = true;
+    for (size_t e = 0; e < 4 && IsElements; ++e) {
+      const uint8_t First = Indices[e * 4];
+      IsElements = (First % 4) == 0;
+      for (size_t i = 1; i < 4 && IsElements; ++i) {
+        IsElements = Indices[e * 4 + i] == First + i;
+      }
+      Sel[e] = First / 4;
+    }
+
+    if (IsElements) {
+      const auto Imm = [](uint8_t a, uint8_t b, uint8_t c, uint8_t d) {
+        return (a & 3) | ((b & 3) << 2) | ((c & 3) << 4) | ((d & 3) << 6);
+      };
+
+      if (!UsesUpper) {
+        vpshufd(Dst, Lower, Imm(Sel[0], Sel[1], Sel[2], Sel[3]));
+        return;
+      }
+
+      // shufps takes the low half from the first source and the high half from the second
+      if (Sel[0] < 4 && Sel[1] < 4 && Sel[2] >= 4 && Sel[3] >= 4) {
+        vshufps(Dst, Lower, Upper, Imm(Sel[0], Sel[1], Sel[2], Sel[3]));
+        return;
+      }
+      if (Sel[0] >= 4 && Sel[1] >= 4 && Sel[2] < 4 && Sel[3] < 4) {
+        vshufps(Dst, Upper, Lower, Imm(Sel[0], Sel[1], Sel[2], Sel[3]));
+        return;
+      }
+    }
+
+    // Blends of 16-bit elements that stay in place
+    uint8_t BlendMask{};
+    bool IsBlend = true;
+    for (size_t e = 0; e < 8 && IsBlend; ++e) {
+      const uint8_t First = Indices[e * 2];
+      const uint8_t Second = Indices[e * 2 + 1];
+      if (First == e * 2 && Second == e * 2 + 1) {
+        continue;
+      }
+      IsBlend = First == 16 + e * 2 && Second == 16 + e * 2 + 1;
+      BlendMask |= 1 << e;
+    }
+
+    if (IsBlend) {
+      vpblendw(Dst, Lower, Upper, BlendMask);
+      return;
+    }
+  }
+
+  // pshufb zeroes the byte when the top bit of the index is set
+  const auto LoadIndices = [this](std::array<uint8_t, 16> const &Mask) {
+    uint64_t Low{}, High{};
+    for (size_t i = 0; i < 8; ++i) {
+      Low |= static_cast<uint64_t>(Mask[i]) << (i * 8);
+      High |= static_cast<uint64_t>(Mask[i + 8]) << (i * 8);
+    }
+
+    mov(TMP1, Low);
+    vmovq(xmm15, TMP1);
+    mov(TMP1, High);
+    vpinsrq(xmm15, xmm15, TMP1, 1);
+  };
+
+  if (!UsesUpper) {
+    LoadIndices(Indices);
+    vpshufb(Dst, Lower, xmm15);
+  }
+  else {
+    std::array<uint8_t, 16> LowerMask{};
+    std::array<uint8_t, 16> UpperMask{};
+    for (size_t i = 0; i < 16; ++i) {
+      LowerMask[i] = Indices[i] < 16 ? Indices[i] : 0x80;
+      UpperMask[i] = (Indices[i] >= 16 && Indices[i] != ZeroIndex) ? (Indices[i] & 15) : 0x80;
+    }
+
+    LoadIndices(LowerMask);
+    vpshufb(xmm14, Lower, xmm15);
+    LoadIndices(UpperMask);
+    vpshufb(Dst, Upper, xmm15);
+    vpor(Dst, Dst, xmm14);
+  }
+
+  if (OpSize == 8) {
+    vmovq(Dst, Dst);
+  }
+}
+
 DEF_OP(VRev64) {
   const auto Op = IROp->C<IR::IROp_VRev64>();
   const auto OpSize = IROp->Size;
@@ -4266,6 +4409,7 @@ void X86JITCore::RegisterVectorHandlers() {
   REGISTER_OP(VSMULL2,           VSMull2);
   REGISTER_OP(VUABDL,            VUABDL);
   REGISTER_OP(VTBL1,             VTBL1);
+  REGISTER_OP(VPERMUTE,          VPermute);
   REGISTER_OP(VREV64,            VRev64);
 #undef REGISTER_OP
 }
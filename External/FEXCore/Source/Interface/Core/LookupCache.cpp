@@ -18,8 +18,6 @@ LookupCache::LookupCache(FEXCore::Context::Context *CTX)
   : ctx {CTX} {
 
   TotalCacheSize = ctx->Config.VirtualMemSize / 4096 * 8 + CODE_SIZE + L1_SIZE;
-  // Setup our PMR map.
-  BlockLinks = BlockLinks_pma.new_object<BlockLinksMapType>();
 
   // Block cache ends up looking like this
   // PageMemoryMap[VirtualMemoryRegion >> 12]
@@ -53,9 +51,6 @@ LookupCache::LookupCache(FEXCore::Context::Context *CTX)
 LookupCache::~LookupCache() {
   const size_t TotalCacheSize = ctx->Config.VirtualMemSize / 4096 * 8 + CODE_SIZE + L1_SIZE;
   FEXCore::Allocator::munmap(reinterpret_cast<void*>(PagePointer), TotalCacheSize);
-
-  // No need to free BlockLinks map.
-  // These will get freed when their memory allocators are deallocated.
 }
 
 void LookupCache::ClearL2Cache() {
@@ -71,13 +66,46 @@ void LookupCache::ClearCache() {
 
   // Clear L1 and L2 by clearing the full cache.
   madvise(reinterpret_cast<void*>(PagePointer), TotalCacheSize, MADV_DONTNEED);
-  // Clear the BlockLinks allocator which frees the BlockLinks map implicitly.
-  BlockLinks_mbr.release();
-  // Allocate a new pointer from the BlockLinks pma again.
-  BlockLinks = BlockLinks_pma.new_object<BlockLinksMapType>();
+  // Links are only reachable through the block list, dropping the records is enough. The slab keeps its capacity
+  BlockLinks.clear();
+  FreeBlockLinks = NO_LINK;
   // All code is gone, clear the block list
   BlockList.clear();
 }
 
+std::vector<uint64_t> LookupCache::EraseHostRange(uintptr_t Start, uintptr_t End) {
+  std::lock_guard<std::recursive_mutex> lk(WriteLock);
+
+  std::vector<uint64_t> ErasedBlocks;
+  for (auto &[GuestCode, Block] : BlockList) {
+    if (Block.HostCode >= Start && Block.HostCode < End) {
+      ErasedBlocks.push_back(GuestCode);
+    }
+  }
+
+  // Severs links from the rest of the code in to these blocks
+  for (auto GuestCode : ErasedBlocks) {
+    Erase(GuestCode);
+  }
+
+  // Links that are inside the range go away with the code, they must not be undone once the range gets reused
+  for (auto Block = BlockList.begin(); Block != BlockList.end(); ++Block) {
+    auto Index = &Block.value().FirstLink;
+    while (*Index != NO_LINK) {
+      const auto Current = *Index;
+      auto &Link = BlockLinks[Current];
+
+      if (Link.HostLink >= Start && Link.HostLink < End) {
+        *Index = Link.Next;
+        FreeBlockLink(Current);
+      } else {
+        Index = &Link.Next;
+      }
+    }
+  }
+
+  return ErasedBlocks;
+}
+
 }
 
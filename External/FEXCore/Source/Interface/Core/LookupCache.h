@@ -2,9 +2,8 @@
 #include <FEXCore/Utils/LogManager.h>
 
 #include <cstdint>
-#include <functional>
+#include <deque>
 #include <map>
-#include <memory_resource>
 #include <stddef.h>
 #include <utility>
 #include <vector>
@@ -24,6 +23,41 @@ public:
     uintptr_t GuestCode;
   };
 
+  struct IndirectBranchSiteStats {
+    uint64_t BlockRIP;
+    uint64_t Hits;
+    uint64_t Misses;
+  };
+
+  /**
+   * @brief Inline cache for an indirect block exit
+   *
+   * Lives in the code buffer right after the exit's call to the IndirectBranchLinker.
+   * The JIT compares the target RIP against each entry before falling back to the L1 lookup.
+   * Entries are filled by the linker and severed like direct links (BlockLinkKind::IndirectBranchEntry), using GuestCode == 0 as empty.
+   */
+  struct IndirectBranchCacheRecord {
+    constexpr static size_t NUM_ENTRIES = 4;
+
+    LookupCacheEntry Entries[NUM_ENTRIES];
+    // Number of times the linker may still be called for this site
+    // Megamorphic sites run out and stay on the L1 lookup
+    uint64_t FillsRemaining;
+    // Only set when IndirectBranchStats is enabled
+    IndirectBranchSiteStats *Stats;
+  };
+  constexpr static uint64_t INDIRECT_BRANCH_CACHE_FILLS = IndirectBranchCacheRecord::NUM_ENTRIES * 2;
+
+  // How Erase undoes a link to the erased block
+  enum class BlockLinkKind : uint32_t {
+    // HostLink is a 64-bit pointer in the code that gets set back to Value
+    Pointer,
+    // HostLink is a patched 32-bit instruction that gets set back to Value, then flushed from the icache
+    Instruction,
+    // HostLink is an IndirectBranchCacheRecord entry, emptied unless it got refilled with another target
+    IndirectBranchEntry,
+  };
+
   LookupCache(FEXCore::Context::Context *CTX);
   ~LookupCache();
 
@@ -58,11 +92,11 @@ public:
     }
 
     // Try L3
-    auto HostCode = BlockList.find(Address);
+    auto Block = BlockList.find(Address);
 
-    if (HostCode != BlockList.end()) {
-      CacheBlockMapping(Address, HostCode->second);
-      return HostCode->second;
+    if (Block != BlockList.end()) {
+      CacheBlockMapping(Address, Block->second.HostCode);
+      return Block->second.HostCode;
     }
 
     // Failed to find
@@ -91,7 +125,7 @@ public:
   void AddBlockMapping(uint64_t Address, void *HostCode) {
     std::lock_guard<std::recursive_mutex> lk(WriteLock);
 
-    [[maybe_unused]] auto Inserted = BlockList.emplace(Address, (uintptr_t)HostCode).second;
+    [[maybe_unused]] auto Inserted = BlockList.emplace(Address, BlockEntry {(uintptr_t)HostCode, NO_LINK}).second;
     LOGMAN_THROW_AA_FMT(Inserted, "Duplicate block mapping added");
 
     // There is no need to update L1 or L2, they will get updated on first lookup
@@ -105,15 +139,21 @@ public:
 
     std::lock_guard<std::recursive_mutex> lk(WriteLock);
 
-    // Sever any links to this block
-    auto lower = BlockLinks->lower_bound({Address, 0});
-    auto upper = BlockLinks->upper_bound({Address, UINTPTR_MAX});
-    for (auto it = lower; it != upper; it = BlockLinks->erase(it)) {
-      it->second();
-    }
+    auto Block = BlockList.find(Address);
+    if (Block != BlockList.end()) {
+      // Sever any links to this block
+      for (auto Index = Block->second.FirstLink; Index != NO_LINK;) {
+        auto &Link = BlockLinks[Index];
+        Delink(Address, Link);
+
+        auto Next = Link.Next;
+        FreeBlockLink(Index);
+        Index = Next;
+      }
 
-    // Remove from BlockList
-    BlockList.erase(Address);
+      // Remove from BlockList
+      BlockList.erase(Block);
+    }
 
     // Do L1
     auto &L1Entry = reinterpret_cast<LookupCacheEntry*>(L1Pointer)[Address & L1_ENTRIES_MASK];
@@ -143,15 +183,38 @@ public:
   }
 
 
-  void AddBlockLink(uint64_t GuestDestination, uintptr_t HostLink, const std::function<void()> &delinker) {
+  // Records a link from HostLink to the block at GuestDestination, which must be in the cache
+  void AddBlockLink(uint64_t GuestDestination, uintptr_t HostLink, BlockLinkKind Kind, uint64_t Value) {
     std::lock_guard<std::recursive_mutex> lk(WriteLock);
 
-    BlockLinks->insert({{GuestDestination, HostLink}, delinker});
+    auto Block = BlockList.find(GuestDestination);
+    LOGMAN_THROW_AA_FMT(Block != BlockList.end(), "Linking to a block that isn't in the cache");
+
+    const auto Index = AllocateBlockLink();
+    BlockLinks[Index] = BlockLinkRecord {
+      .HostLink = HostLink,
+      .Value = Value,
+      .Next = Block->second.FirstLink,
+      .Kind = Kind,
+    };
+    Block.value().FirstLink = Index;
   }
 
   void ClearCache();
   void ClearL2Cache();
 
+  // Erases every block with host code in [Start, End) and drops the links that live in that range
+  // Returns the guest RIPs of the erased blocks
+  std::vector<uint64_t> EraseHostRange(uintptr_t Start, uintptr_t End);
+
+  IndirectBranchSiteStats *AllocateIndirectBranchSite(uint64_t BlockRIP) {
+    return &IndirectBranchSites.emplace_back(IndirectBranchSiteStats{BlockRIP, 0, 0});
+  }
+
+  // JIT code holds pointers to these, std::deque doesn't move elements on emplace_back
+  // Not cleared with the cache so the stats cover the whole thread lifetime
+  std::deque<IndirectBranchSiteStats> IndirectBranchSites;
+
   uintptr_t GetL1Pointer() const { return L1Pointer; }
   uintptr_t GetPagePointer() const { return PagePointer; }
   uintptr_t GetVirtualMemorySize() const { return VirtualMemSize; }
@@ -225,32 +288,65 @@ private:
   uintptr_t PageMemory;
   uintptr_t L1Pointer;
 
-  struct BlockLinkTag {
-    uint64_t GuestDestination;
+  constexpr static uint32_t NO_LINK = ~0U;
+
+  struct BlockLinkRecord {
     uintptr_t HostLink;
+    uint64_t Value;
+    // Next link to the same block, or next free record
+    uint32_t Next;
+    BlockLinkKind Kind;
+  };
+
+  // Slab of link records, referenced by index so that growing it doesn't invalidate the lists
+  // Each block in BlockList heads an intrusive list of the links to it, freed records form another list
+  std::vector<BlockLinkRecord> BlockLinks;
+  uint32_t FreeBlockLinks {NO_LINK};
 
-    bool operator <(const BlockLinkTag& other) const {
-      if (GuestDestination < other.GuestDestination)
-        return true;
-      else if (GuestDestination == other.GuestDestination)
-        return HostLink < other.HostLink;
-      else
-        return false;
+  uint32_t AllocateBlockLink() {
+    if (FreeBlockLinks != NO_LINK) {
+      const auto Index = FreeBlockLinks;
+      FreeBlockLinks = BlockLinks[Index].Next;
+      return Index;
     }
-  };
 
-  // Use a monotonic buffer resource to allocate both the std::pmr::map and its members.
-  // This allows us to quickly clear the block link map by clearing the monotonic allocator.
-  // If we had allocated the block link map without the MBR, then clearing the map would require slowly
-  // walking each block member and destructing objects.
-  //
-  // This makes `BlockLinks` look like a raw pointer that could memory leak, but since it is backed by the MBR, it won't.
-  std::pmr::monotonic_buffer_resource BlockLinks_mbr;
-  using BlockLinksMapType = std::pmr::map<BlockLinkTag, std::function<void()>>;
-  std::pmr::polymorphic_allocator<std::byte> BlockLinks_pma {&BlockLinks_mbr};
-  BlockLinksMapType *BlockLinks;
-
-  tsl::robin_map<uint64_t, uint64_t> BlockList;
+    BlockLinks.emplace_back();
+    return BlockLinks.size() - 1;
+  }
+
+  void FreeBlockLink(uint32_t Index) {
+    BlockLinks[Index].Next = FreeBlockLinks;
+    FreeBlockLinks = Index;
+  }
+
+  static void Delink(uint64_t GuestDestination, BlockLinkRecord const &Link) {
+    switch (Link.Kind) {
+      case BlockLinkKind::Pointer:
+        *reinterpret_cast<uint64_t*>(Link.HostLink) = Link.Value;
+        break;
+      case BlockLinkKind::Instruction: {
+        auto Instruction = reinterpret_cast<uint32_t*>(Link.HostLink);
+        *Instruction = Link.Value;
+        __builtin___clear_cache(reinterpret_cast<char*>(Instruction), reinterpret_cast<char*>(Instruction + 1));
+        break;
+      }
+      case BlockLinkKind::IndirectBranchEntry: {
+        auto Entry = reinterpret_cast<LookupCacheEntry*>(Link.HostLink);
+        if (Entry->GuestCode == GuestDestination) {
+          // Leave HostCode as is, like the L1 cache
+          Entry->GuestCode = 0;
+        }
+        break;
+      }
+    }
+  }
+
+  struct BlockEntry {
+    uintptr_t HostCode;
+    // Head of the links to this block in BlockLinks
+    uint32_t FirstLink;
+  };
+  tsl::robin_map<uint64_t, BlockEntry> BlockList;
 
   size_t TotalCacheSize;
 
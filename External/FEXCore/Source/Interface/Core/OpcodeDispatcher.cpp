@@ -211,7 +211,7 @@ void OpDispatchBuilder::RETOp(OpcodeArgs) {
   StoreGPRRegister(X86State::REG_RSP, NewSP);
 
   // Store the new RIP
-  _ExitFunction(NewRIP);
+  IndirectExitFunction(NewRIP);
   BlockSetRIP = true;
 }
 
@@ -788,8 +788,16 @@ void OpDispatchBuilder::CALLOp(OpcodeArgs) {
   const uint64_t TargetRIP = Op->PC + Op->InstSize + Op->Src[0].Data.Literal.Value;
 
   if (NextRIP != TargetRIP) {
-    // Store the RIP
-    _ExitFunction(NewRIP); // If we get here then leave the function now
+    const uint64_t CallTargetRIP = GPRSize == 4 ? (TargetRIP & 0xFFFFFFFFU) : TargetRIP;
+
+    if (HotRegion && JumpTargets.contains(CallTargetRIP)) {
+      // Hot regions can contain the callee, jump directly to it in that case
+      _Jump(GetNewJumpBlock(CallTargetRIP));
+    }
+    else {
+      // Store the RIP
+      _ExitFunction(NewRIP); // If we get here then leave the function now
+    }
   }
   else {
     NeedsBlockEnd = true;
@@ -817,7 +825,7 @@ void OpDispatchBuilder::CALLAbsoluteOp(OpcodeArgs) {
   _StoreMem(GPRClass, Size, NewSP, ConstantPCReturn, Size);
 
   // Store the RIP
-  _ExitFunction(JMPPCOffset); // If we get here then leave the function now
+  IndirectExitFunction(JMPPCOffset); // If we get here then leave the function now
 }
 
 OrderedNode *OpDispatchBuilder::SelectCC(uint8_t OP, OrderedNode *TrueValue, OrderedNode *FalseValue) {
@@ -1358,7 +1366,7 @@ void OpDispatchBuilder::JUMPAbsoluteOp(OpcodeArgs) {
   auto RIPOffset = LoadSource(GPRClass, Op, Op->Src[0], Op->Flags, -1);
 
   // Store the new RIP
-  _ExitFunction(RIPOffset);
+  IndirectExitFunction(RIPOffset);
 }
 
 template<uint32_t SrcIndex>
@@ -4796,6 +4804,118 @@ void OpDispatchBuilder::Finalize() {
     SetCurrentCodeBlock(Handler.second.BlockEntry);
     _ExitFunction(_EntrypointOffset(Handler.first - Entry, GPRSize));
   }
+
+  if (TierProfile) {
+    ProfileDirectExits();
+  }
+}
+
+void OpDispatchBuilder::IndirectExitFunction(OrderedNode *NewRIP) {
+  const uint8_t GPRSize = CTX->GetGPRSize();
+
+  if (TierProfile) {
+    // Track how often the target repeats so a hot region can predict it
+    auto Profile = TierData->GetIndirectProfile(Entry, CurrentInstructionRIP);
+    if (Profile) {
+      auto LastTargetPtr = _Constant(reinterpret_cast<uint64_t>(&Profile->LastTarget));
+      auto RepeatsPtr = _Constant(reinterpret_cast<uint64_t>(&Profile->Repeats));
+      auto ExitsPtr = _Constant(reinterpret_cast<uint64_t>(&Profile->Exits));
+
+      auto LastTarget = _LoadMem(GPRClass, GPRSize, LastTargetPtr, GPRSize);
+      auto Repeats = _LoadMem(GPRClass, 4, RepeatsPtr, 4);
+      auto Exits = _LoadMem(GPRClass, 4, ExitsPtr, 4);
+
+      auto NewRepeats = _Select(FEXCore::IR::COND_EQ, LastTarget, NewRIP, _Add(Repeats, _Constant(1)), Repeats, GPRSize);
+      _StoreMem(GPRClass, 4, RepeatsPtr, NewRepeats, 4);
+      _StoreMem(GPRClass, 4, ExitsPtr, _Add(Exits, _Constant(1)), 4);
+      _StoreMem(GPRClass, GPRSize, LastTargetPtr, NewRIP, GPRSize);
+    }
+  }
+  else if (HotRegion) {
+    auto Prediction = HotRegion->IndirectTargets.find(CurrentInstructionRIP);
+    if (Prediction != HotRegion->IndirectTargets.end() && JumpTargets.contains(Prediction->second)) {
+      // Jump straight to the predicted target, anything else still leaves through the dispatcher
+      const uint64_t PredictedRIP = Prediction->second;
+      auto CondJump = _CondJump(NewRIP, _EntrypointOffset(PredictedRIP - Entry, GPRSize), Invalid(), Invalid(), {FEXCore::IR::COND_EQ}, GPRSize);
+      SetTrueJumpTarget(CondJump, GetNewJumpBlock(PredictedRIP));
+
+      auto MissBlock = CreateNewCodeBlockAfter(GetCurrentBlock());
+      SetFalseJumpTarget(CondJump, MissBlock);
+      SetCurrentCodeBlock(MissBlock);
+    }
+  }
+
+  _ExitFunction(NewRIP);
+}
+
+bool OpDispatchBuilder::GetConstantExitTarget(OrderedNodeWrapper NewRIP, uint64_t *Target) {
+  auto IROp = GetOpHeader(NewRIP);
+
+  switch (IROp->Op) {
+    case OP_CONSTANT:
+      *Target = IROp->C<IR::IROp_Constant>()->Constant;
+      break;
+    case OP_ENTRYPOINTOFFSET:
+      *Target = Entry + IROp->C<IR::IROp_EntrypointOffset>()->Offset;
+      break;
+    case OP_ADD: {
+      // Relative jumps outside of multiblock add their displacement to the relocated PC
+      uint64_t Src1, Src2;
+      if (!GetConstantExitTarget(IROp->Args[0], &Src1) ||
+          !GetConstantExitTarget(IROp->Args[1], &Src2)) {
+        return false;
+      }
+      *Target = Src1 + Src2;
+      break;
+    }
+    default:
+      return false;
+  }
+
+  if (CTX->GetGPRSize() == 4) {
+    *Target &= 0xFFFFFFFFU;
+  }
+
+  return true;
+}
+
+void OpDispatchBuilder::ProfileDirectExits() {
+  // Collect the exits first, emitting the counters changes the list being walked
+  std::vector<std::pair<OrderedNode*, uint64_t>> Exits;
+
+  auto CurrentIR = ViewIR();
+  for (auto [BlockNode, BlockHeader] : CurrentIR.GetBlocks()) {
+    bool RemovesCodeEntry {false};
+
+    for (auto [CodeNode, IROp] : CurrentIR.GetCode(BlockNode)) {
+      if (IROp->Op == OP_THREADREMOVECODEENTRY) {
+        // Tier-up and SMC exits recompile this block, they aren't edges
+        RemovesCodeEntry = true;
+      }
+      else if (IROp->Op == OP_EXITFUNCTION && !RemovesCodeEntry) {
+        uint64_t Target;
+        if (GetConstantExitTarget(IROp->C<IR::IROp_ExitFunction>()->NewRIP, &Target) && Target != 0) {
+          Exits.emplace_back(CodeNode, Target);
+        }
+      }
+    }
+  }
+
+  auto OriginalWriteCursor = GetWriteCursor();
+
+  for (auto [ExitNode, Target] : Exits) {
+    auto Counter = BlockTierData::GetEdgeCounter(TierProfile, Target);
+    if (!Counter) {
+      continue;
+    }
+
+    SetWriteCursor(UnwrapNode(ExitNode->Header.Previous));
+    auto CounterPtr = _Constant(reinterpret_cast<uint64_t>(Counter));
+    auto Count = _LoadMem(GPRClass, 4, CounterPtr, 4);
+    _StoreMem(GPRClass, 4, CounterPtr, _Add(Count, _Constant(1)), 4);
+  }
+
+  SetWriteCursor(OriginalWriteCursor);
 }
 
 uint8_t OpDispatchBuilder::GetDstSize(X86Tables::DecodedOp Op) const {
@@ -6106,13 +6226,14 @@ void OpDispatchBuilder::InstallHostSpecificOpcodeHandlers() {
     }
   };
 
-  if (CTX->HostFeatures.SupportsCRC) {
+  // Emulate* means the host lacks the extension and the JITs call the software fallback handlers
+  if (CTX->HostFeatures.SupportsCRC || CTX->HostFeatures.EmulateCRC) {
     InstallToTable(FEXCore::X86Tables::H0F38TableOps, H0F38_CRC);
   }
 
   InstallToTable(FEXCore::X86Tables::H0F38TableOps, H0F38_SHA);
 
-  if (CTX->HostFeatures.SupportsAES) {
+  if (CTX->HostFeatures.SupportsAES || CTX->HostFeatures.EmulateAES) {
     InstallToTable(FEXCore::X86Tables::H0F38TableOps, H0F38_AES);
     InstallToTable(FEXCore::X86Tables::H0F3ATableOps, H0F3A_AES);
   }
@@ -6130,7 +6251,7 @@ void OpDispatchBuilder::InstallHostSpecificOpcodeHandlers() {
     InstallToTable(FEXCore::X86Tables::VEXTableGroupOps, VEXTableGroupOps);
   }
 
-  if (CTX->HostFeatures.SupportsPMULL_128Bit) {
+  if (CTX->HostFeatures.SupportsPMULL_128Bit || CTX->HostFeatures.EmulatePMULL_128Bit) {
     InstallToTable(FEXCore::X86Tables::H0F3ATableOps, H0F3A_PCLMUL);
     InstallToTable(FEXCore::X86Tables::VEXTableOps, VEX_PCLMUL);
   }
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "Interface/Core/BlockTierData.h"
 #include "Interface/Core/Frontend.h"
 #include "Interface/Context/Context.h"
 
@@ -13,6 +14,7 @@
 
 #include <FEXCore/Utils/LogManager.h>
 
+#include <array>
 #include <cstdint>
 #include <fmt/format.h>
 #include <map>
@@ -728,7 +730,18 @@ public:
 
   void SetMultiblock(bool _Multiblock) { Multiblock = _Multiblock; }
 
+  // Profiling tier code records its exits in to Profile, nullptr when not profiling
+  void SetTierProfile(FEXCore::BlockTierData *Data, FEXCore::BlockTierData::BlockProfile *Profile) {
+    TierData = Data;
+    TierProfile = Profile;
+  }
+
+  // Hot regions link their in-region calls and predicted indirect branches, nullptr when not compiling one
+  void SetHotRegion(FEXCore::BlockTierData::HotRegionInfo const *Region) { HotRegion = Region; }
+
   bool HandledLock = false;
+  // Guest RIP of the instruction being dispatched, used to tie TSO accesses back to it
+  uint64_t CurrentInstructionRIP{};
 private:
   bool DecodeFailure{false};
   bool NeedsBlockEnd{false};
@@ -797,6 +810,15 @@ private:
 
   OrderedNode* Vector_CVT_Int_To_FloatImpl(OpcodeArgs, size_t SrcElementSize, bool Widen);
 
+  // Constant byte shuffles. Each destination byte takes the byte at its index from Lower (0-15) or Upper (16-31)
+  // Indices of PERMUTE_ZERO zero the destination byte
+  using PermuteIndices = std::array<uint8_t, 16>;
+  constexpr static uint8_t PERMUTE_ZERO = 0xFF;
+
+  static PermuteIndices IdentityPermute();
+  static void SetPermuteElement(PermuteIndices &Indices, size_t ElementSize, size_t DestElement, size_t SrcElement);
+  OrderedNode* VPermuteImpl(uint8_t Size, OrderedNode *Lower, OrderedNode *Upper, PermuteIndices const &Indices);
+
   #undef OpcodeArgs
 
   OrderedNode *AppendSegmentOffset(OrderedNode *Value, uint32_t Flags, uint32_t DefaultPrefix = 0, bool Override = false);
@@ -838,20 +860,100 @@ private:
   [[nodiscard]] uint32_t GetDstBitSize(X86Tables::DecodedOp Op) const;
   [[nodiscard]] uint32_t GetSrcBitSize(X86Tables::DecodedOp Op) const;
 
+  /**
+   * @name RFLAG storage
+   *
+   * Most flags are stored as a 0 or 1 byte in their context slot.
+   * PF and AF are stored lazily since they are generated by nearly every ALU op but rarely read:
+   *  - PF's slot holds a byte whose low 8 bits have the same parity as the result that generated it.
+   *    PF is set when that byte has even parity.
+   *  - AF's slot holds a byte whose bit 4 is AF.
+   * Only the low byte of a flag slot is ever stored so the raw setters can be passed full width results.
+   * CF, ZF, SF and OF are packed in the 32-bit NZCV word at RFLAG_NZCV_LOC, using AArch64's NZCV layout.
+   * Ops that generate all four store the word once, and SubNZCV/AddNZCV can take it straight from the host flags.
+   * Code outside of the OpcodeDispatcher must go through CPUState::GetEFLAGS/SetEFLAGS to observe these.
+   * @{ */
+  OrderedNode *LoadNZCV() {
+    return _LoadContext(4, GPRClass, offsetof(FEXCore::Core::CPUState, flags) + FEXCore::X86State::RFLAG_NZCV_LOC);
+  }
+
+  void StoreNZCV(OrderedNode *Value) {
+    flagsOp = SelectionFlag::Nothing;
+    _StoreContext(4, GPRClass, Value, offsetof(FEXCore::Core::CPUState, flags) + FEXCore::X86State::RFLAG_NZCV_LOC);
+  }
+
+  // Inserts the low bit of each flag in to NZCV. A nullptr flag keeps its value from NZCV.
+  OrderedNode *PackNZCV(OrderedNode *NZCV, OrderedNode *SF, OrderedNode *ZF, OrderedNode *CF, OrderedNode *OF) {
+    if (SF) {
+      NZCV = _Bfi(4, 1, FEXCore::X86State::NZCV_SF_LOC, NZCV, SF);
+    }
+    if (ZF) {
+      NZCV = _Bfi(4, 1, FEXCore::X86State::NZCV_ZF_LOC, NZCV, ZF);
+    }
+    if (CF) {
+      NZCV = _Bfi(4, 1, FEXCore::X86State::NZCV_CF_LOC, NZCV, CF);
+    }
+    if (OF) {
+      NZCV = _Bfi(4, 1, FEXCore::X86State::NZCV_OF_LOC, NZCV, OF);
+    }
+    return NZCV;
+  }
+
+  // Stores all four flags with a single NZCV store. A nullptr flag keeps its current value.
+  void SetNZCV(OrderedNode *SF, OrderedNode *ZF, OrderedNode *CF, OrderedNode *OF) {
+    OrderedNode *Base = (SF && ZF && CF && OF) ? _Constant(0) : LoadNZCV();
+    StoreNZCV(PackNZCV(Base, SF, ZF, CF, OF));
+  }
+
   template<unsigned BitOffset>
   void SetRFLAG(OrderedNode *Value) {
-    flagsOp = SelectionFlag::Nothing;
-    _StoreFlag(_Bfe(1, 0, Value), BitOffset);
+    SetRFLAG(Value, BitOffset);
   }
 
   void SetRFLAG(OrderedNode *Value, unsigned BitOffset) {
     flagsOp = SelectionFlag::Nothing;
-    _StoreFlag(_Bfe(1, 0, Value), BitOffset);
+    if (BitOffset == FEXCore::X86State::RFLAG_PF_LOC) {
+      // Zero has even parity, one has odd parity
+      _StoreFlag(_Xor(_Bfe(1, 0, Value), _Constant(1)), BitOffset);
+    }
+    else if (BitOffset == FEXCore::X86State::RFLAG_AF_LOC) {
+      _StoreFlag(_Lshl(_Bfe(1, 0, Value), _Constant(4)), BitOffset);
+    }
+    else if (FEXCore::X86State::IsNZCVFlag(BitOffset)) {
+      StoreNZCV(_Bfi(4, 1, FEXCore::X86State::GetNZCVLoc(BitOffset), LoadNZCV(), Value));
+    }
+    else {
+      _StoreFlag(_Bfe(1, 0, Value), BitOffset);
+    }
+  }
+
+  // Stores the result of an ALU op for later parity calculation
+  void SetRawPF(OrderedNode *Result) {
+    flagsOp = SelectionFlag::Nothing;
+    _StoreFlag(Result, FEXCore::X86State::RFLAG_PF_LOC);
+  }
+
+  // Stores Src1 ^ Src2 ^ Result of an ALU op for later AF extraction
+  void SetRawAF(OrderedNode *XorResult) {
+    flagsOp = SelectionFlag::Nothing;
+    _StoreFlag(XorResult, FEXCore::X86State::RFLAG_AF_LOC);
   }
 
   OrderedNode *GetRFLAG(unsigned BitOffset) {
+    if (BitOffset == FEXCore::X86State::RFLAG_PF_LOC) {
+      auto PopCountOp = _Popcount(_And(_LoadFlag(BitOffset), _Constant(0xFF)));
+      return _Bfe(1, 0, _Xor(PopCountOp, _Constant(1)));
+    }
+    else if (BitOffset == FEXCore::X86State::RFLAG_AF_LOC) {
+      return _Bfe(1, 4, _LoadFlag(BitOffset));
+    }
+    else if (FEXCore::X86State::IsNZCVFlag(BitOffset)) {
+      return _Bfe(1, FEXCore::X86State::GetNZCVLoc(BitOffset), LoadNZCV());
+    }
+
     return _LoadFlag(BitOffset);
   }
+  /**  @} */
 
   OrderedNode *SelectCC(uint8_t OP, OrderedNode *TrueValue, OrderedNode *FalseValue);
 
@@ -1399,16 +1501,52 @@ private:
   bool Multiblock{};
   uint64_t Entry;
 
+  FEXCore::BlockTierData *TierData{};
+  FEXCore::BlockTierData::BlockProfile *TierProfile{};
+  FEXCore::BlockTierData::HotRegionInfo const *HotRegion{};
+
+  // Leaves through a RIP computed at runtime, profiling or predicting the target depending on the tier
+  void IndirectExitFunction(OrderedNode *NewRIP);
+  // Counts every exit of profiling tier code to a RIP known at compile time
+  void ProfileDirectExits();
+  bool GetConstantExitTarget(OrderedNodeWrapper NewRIP, uint64_t *Target);
+
+  // Whether this TSO access has been backpatched for being unaligned before
+  // If so emit the same fenced plain access the SIGBUS handler would have patched in
+  bool IsKnownUnalignedAccess(FEXCore::IR::RegisterClassType Class, uint8_t Size) const {
+    return Class == FEXCore::IR::GPRClass && Size > 1 &&
+      !CTX->Config.ParanoidTSO() &&
+      CTX->UnalignedAccesses.Contains(CurrentInstructionRIP);
+  }
+
+  int32_t GetGuestOffset() const {
+    return static_cast<int32_t>(CurrentInstructionRIP - Entry);
+  }
+
   OrderedNode* _StoreMemAutoTSO(FEXCore::IR::RegisterClassType Class, uint8_t Size, OrderedNode *Addr, OrderedNode *Value, uint8_t Align = 1) {
-    if (CTX->IsTSOEnabled())
-      return _StoreMemTSO(Class, Size, Value, Addr, Invalid(), Align, MEM_OFFSET_SXTX, 1);
+    if (CTX->IsTSOEnabled()) {
+      if (IsKnownUnalignedAccess(Class, Size)) {
+        _Fence({FEXCore::IR::Fence_LoadStore});
+        auto Store = _StoreMem(Class, Size, Value, Addr, Invalid(), Align, MEM_OFFSET_SXTX, 1);
+        _Fence({FEXCore::IR::Fence_LoadStore});
+        return Store;
+      }
+      return _StoreMemTSO(Class, Size, Value, Addr, Invalid(), Align, MEM_OFFSET_SXTX, 1, GetGuestOffset());
+    }
     else
       return _StoreMem(Class, Size, Value, Addr, Invalid(), Align, MEM_OFFSET_SXTX, 1);
   }
 
   OrderedNode* _LoadMemAutoTSO(FEXCore::IR::RegisterClassType Class, uint8_t Size, OrderedNode *ssa0, uint8_t Align = 1) {
-    if (CTX->IsTSOEnabled())
-      return _LoadMemTSO(Class, Size, ssa0, Invalid(), Align, MEM_OFFSET_SXTX, 1);
+    if (CTX->IsTSOEnabled()) {
+      if (IsKnownUnalignedAccess(Class, Size)) {
+        _Fence({FEXCore::IR::Fence_LoadStore});
+        auto Load = _LoadMem(Class, Size, ssa0, Invalid(), Align, MEM_OFFSET_SXTX, 1);
+        _Fence({FEXCore::IR::Fence_LoadStore});
+        return Load;
+      }
+      return _LoadMemTSO(Class, Size, ssa0, Invalid(), Align, MEM_OFFSET_SXTX, 1, GetGuestOffset());
+    }
     else
       return _LoadMem(Class, Size, ssa0, Invalid(), Align, MEM_OFFSET_SXTX, 1);
   }
@@ -5,6 +5,7 @@ desc: Handles x86/64 Crypto instructions to IR
 $end_info$
 */
 
+#include "Interface/Context/Context.h"
 #include <FEXCore/Debug/X86Tables.h>
 #include <FEXCore/IR/IREmitter.h>
 #include <FEXCore/Utils/LogManager.h>
@@ -378,6 +379,13 @@ OrderedNode* OpDispatchBuilder::AESKeyGenAssistImpl(OpcodeArgs) {
   LOGMAN_THROW_A_FMT(Op->Src[1].IsLiteral(), "Src1 needs to be literal here");
   const uint64_t RCON = Op->Src[1].Data.Literal.Value;
 
+  if (!CTX->HostFeatures.SupportsAES && RCON != 0) {
+    // Keeps the fallback to a single handler, the round constant goes in to both RotWord results
+    OrderedNode *Assist = _VAESKeyGenAssist(Src, 0);
+    OrderedNode *RCONVec = _VDupElement(16, 8, _VCastFromGPR(16, 8, _Constant(RCON << 32)), 0);
+    return _VXor(16, 8, Assist, RCONVec);
+  }
+
   return _VAESKeyGenAssist(Src, RCON);
 }
 
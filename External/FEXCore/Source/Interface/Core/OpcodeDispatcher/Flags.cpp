@@ -53,11 +53,23 @@ void OpDispatchBuilder::SetPackedRFLAG(bool Lower8, OrderedNode *Src) {
   }
 
   auto OneConst = _Constant(1);
+  auto ExtractFlag = [&](uint32_t FlagOffset) {
+    return _And(_Lshr(Src, _Constant(FlagOffset)), OneConst);
+  };
+
   for (size_t i = 0; i < NumFlags; ++i) {
     const auto FlagOffset = FlagOffsets[i];
-    auto Tmp = _And(_Lshr(Src, _Constant(FlagOffset)), OneConst);
-    SetRFLAG(Tmp, FlagOffset);
+    if (FEXCore::X86State::IsNZCVFlag(FlagOffset)) {
+      continue;
+    }
+    SetRFLAG(ExtractFlag(FlagOffset), FlagOffset);
   }
+
+  // The packed flags get stored together. OF isn't in the lower 8 bits.
+  SetNZCV(ExtractFlag(FEXCore::X86State::RFLAG_SF_LOC),
+          ExtractFlag(FEXCore::X86State::RFLAG_ZF_LOC),
+          ExtractFlag(FEXCore::X86State::RFLAG_CF_LOC),
+          Lower8 ? nullptr : static_cast<OrderedNode*>(ExtractFlag(FEXCore::X86State::RFLAG_OF_LOC)));
 }
 
 OrderedNode *OpDispatchBuilder::GetPackedRFLAG(bool Lower8) {
@@ -70,9 +82,14 @@ OrderedNode *OpDispatchBuilder::GetPackedRFLAG(bool Lower8) {
     NumFlags = 5;
   }
 
+  // Only load the packed flags once
+  OrderedNode *NZCV = LoadNZCV();
+
   for (size_t i = 0; i < NumFlags; ++i) {
     const auto FlagOffset = FlagOffsets[i];
-    OrderedNode *Flag = _LoadFlag(FlagOffset);
+    OrderedNode *Flag = FEXCore::X86State::IsNZCVFlag(FlagOffset) ?
+      _Bfe(1, FEXCore::X86State::GetNZCVLoc(FlagOffset), NZCV) :
+      GetRFLAG(FlagOffset);
     Flag = _Bfe(4, 32, 0, Flag);
     Flag = _Lshl(Flag, _Constant(FlagOffset));
     Original = _Or(Original, Flag);
@@ -264,266 +281,156 @@ void OpDispatchBuilder::CalculcateFlags_ADC(uint8_t SrcSize, OrderedNode *Res, O
   auto Size = SrcSize * 8;
   // AF
   {
-    OrderedNode *AFRes = _Xor(_Xor(Src1, Src2), Res);
-    AFRes = _Bfe(1, 4, AFRes);
-    SetRFLAG<FEXCore::X86State::RFLAG_AF_LOC>(AFRes);
-  }
-
-  // SF
-  {
-    auto SignBitConst = _Constant(Size - 1);
-
-    auto LshrOp = _Lshr(Res, SignBitConst);
-    SetRFLAG<FEXCore::X86State::RFLAG_SF_LOC>(LshrOp);
+    SetRawAF(_Xor(_Xor(Src1, Src2), Res));
   }
 
   // PF
   if (!CTX->Config.ABINoPF) {
-    auto PopCountOp = _Popcount(_And(Res, _Constant(0xFF)));
-
-    auto XorOp = _Xor(PopCountOp, _Constant(1));
-    SetRFLAG<FEXCore::X86State::RFLAG_PF_LOC>(XorOp);
+    SetRawPF(Res);
   } else {
     _InvalidateFlags(1UL << FEXCore::X86State::RFLAG_PF_LOC);
   }
 
+  // SF
+  auto SignBitConst = _Constant(Size - 1);
+  auto SF = _Lshr(Res, SignBitConst);
+
   // ZF
-  {
-    auto SelectOp = _Select(FEXCore::IR::COND_EQ,
-        Res, _Constant(0), _Constant(1), _Constant(0));
-    SetRFLAG<FEXCore::X86State::RFLAG_ZF_LOC>(SelectOp);
-  }
+  auto ZF = _Select(FEXCore::IR::COND_EQ,
+      Res, _Constant(0), _Constant(1), _Constant(0));
 
   // CF
   // Unsigned
-  {
-    auto SelectOpLT = _Select(FEXCore::IR::COND_ULT, Res, Src2, _Constant(1), _Constant(0));
-    auto SelectOpLE = _Select(FEXCore::IR::COND_ULE, Res, Src2, _Constant(1), _Constant(0));
-    auto SelectCF   = _Select(FEXCore::IR::COND_EQ, CF, _Constant(1), SelectOpLE, SelectOpLT);
-    SetRFLAG<FEXCore::X86State::RFLAG_CF_LOC>(SelectCF);
-  }
+  auto SelectOpLT = _Select(FEXCore::IR::COND_ULT, Res, Src2, _Constant(1), _Constant(0));
+  auto SelectOpLE = _Select(FEXCore::IR::COND_ULE, Res, Src2, _Constant(1), _Constant(0));
+  auto SelectCF   = _Select(FEXCore::IR::COND_EQ, CF, _Constant(1), SelectOpLE, SelectOpLT);
 
   // OF
   // Signed
-  {
-    auto NegOne = _Constant(~0ULL);
-    auto XorOp1 = _Xor(_Xor(Src1, Src2), NegOne);
-    auto XorOp2 = _Xor(Res, Src1);
-    OrderedNode *AndOp1 = _And(XorOp1, XorOp2);
-
-    switch (Size) {
-    case 8:
-      AndOp1 = _Bfe(1, 7, AndOp1);
-    break;
-    case 16:
-      AndOp1 = _Bfe(1, 15, AndOp1);
-    break;
-    case 32:
-      AndOp1 = _Bfe(1, 31, AndOp1);
-    break;
-    case 64:
-      AndOp1 = _Bfe(1, 63, AndOp1);
-    break;
-    default:
-      LOGMAN_MSG_A_FMT("Unknown BFE size: {}", Size);
-    break;
-    }
-    SetRFLAG<FEXCore::X86State::RFLAG_OF_LOC>(AndOp1);
-  }
+  auto NegOne = _Constant(~0ULL);
+  auto XorOp1 = _Xor(_Xor(Src1, Src2), NegOne);
+  auto XorOp2 = _Xor(Res, Src1);
+  OrderedNode *AndOp1 = _And(XorOp1, XorOp2);
+
+  switch (Size) {
+  case 8:
+    AndOp1 = _Bfe(1, 7, AndOp1);
+  break;
+  case 16:
+    AndOp1 = _Bfe(1, 15, AndOp1);
+  break;
+  case 32:
+    AndOp1 = _Bfe(1, 31, AndOp1);
+  break;
+  case 64:
+    AndOp1 = _Bfe(1, 63, AndOp1);
+  break;
+  default:
+    LOGMAN_MSG_A_FMT("Unknown BFE size: {}", Size);
+  break;
+  }
+
+  SetNZCV(SF, ZF, SelectCF, AndOp1);
 }
 
 void OpDispatchBuilder::CalculcateFlags_SBB(uint8_t SrcSize, OrderedNode *Res, OrderedNode *Src1, OrderedNode *Src2, OrderedNode *CF) {
   // AF
   {
-    OrderedNode *AFRes = _Xor(_Xor(Src1, Src2), Res);
-    AFRes = _Bfe(1, 4, AFRes);
-    SetRFLAG<FEXCore::X86State::RFLAG_AF_LOC>(AFRes);
-  }
-
-  // SF
-  {
-    auto SignBitConst = _Constant(SrcSize * 8 - 1);
-
-    auto LshrOp = _Lshr(Res, SignBitConst);
-    SetRFLAG<FEXCore::X86State::RFLAG_SF_LOC>(LshrOp);
+    SetRawAF(_Xor(_Xor(Src1, Src2), Res));
   }
 
   // PF
   if (!CTX->Config.ABINoPF) {
-    auto PopCountOp = _Popcount(_And(Res, _Constant(0xFF)));
-
-    auto XorOp = _Xor(PopCountOp, _Constant(1));
-    SetRFLAG<FEXCore::X86State::RFLAG_PF_LOC>(XorOp);
+    SetRawPF(Res);
   } else {
     _InvalidateFlags(1UL << FEXCore::X86State::RFLAG_PF_LOC);
   }
 
+  // SF
+  auto SignBitConst = _Constant(SrcSize * 8 - 1);
+  auto SF = _Lshr(Res, SignBitConst);
+
   // ZF
-  {
-    auto SelectOp = _Select(FEXCore::IR::COND_EQ,
-        Res, _Constant(0), _Constant(1), _Constant(0));
-    SetRFLAG<FEXCore::X86State::RFLAG_ZF_LOC>(SelectOp);
-  }
+  auto ZF = _Select(FEXCore::IR::COND_EQ,
+      Res, _Constant(0), _Constant(1), _Constant(0));
 
   // CF
   // Unsigned
-  {
-    auto SelectOpLT = _Select(FEXCore::IR::COND_UGT, Res, Src1, _Constant(1), _Constant(0));
-    auto SelectOpLE = _Select(FEXCore::IR::COND_UGE, Res, Src1, _Constant(1), _Constant(0));
-    auto SelectCF   = _Select(FEXCore::IR::COND_EQ, CF, _Constant(1), SelectOpLE, SelectOpLT);
-    SetRFLAG<FEXCore::X86State::RFLAG_CF_LOC>(SelectCF);
-  }
+  auto SelectOpLT = _Select(FEXCore::IR::COND_UGT, Res, Src1, _Constant(1), _Constant(0));
+  auto SelectOpLE = _Select(FEXCore::IR::COND_UGE, Res, Src1, _Constant(1), _Constant(0));
+  auto SelectCF   = _Select(FEXCore::IR::COND_EQ, CF, _Constant(1), SelectOpLE, SelectOpLT);
 
   // OF
   // Signed
-  {
-    auto XorOp1 = _Xor(Src1, Src2);
-    auto XorOp2 = _Xor(Res, Src1);
-    OrderedNode *AndOp1 = _And(XorOp1, XorOp2);
-
-    switch (SrcSize) {
-    case 1:
-      AndOp1 = _Bfe(1, 7, AndOp1);
-    break;
-    case 2:
-      AndOp1 = _Bfe(1, 15, AndOp1);
-    break;
-    case 4:
-      AndOp1 = _Bfe(1, 31, AndOp1);
-    break;
-    case 8:
-      AndOp1 = _Bfe(1, 63, AndOp1);
-    break;
-    default:
-      LOGMAN_MSG_A_FMT("Unknown BFE size: {}", SrcSize);
-    break;
-    }
-    SetRFLAG<FEXCore::X86State::RFLAG_OF_LOC>(AndOp1);
-  }
+  auto XorOp1 = _Xor(Src1, Src2);
+  auto XorOp2 = _Xor(Res, Src1);
+  OrderedNode *AndOp1 = _And(XorOp1, XorOp2);
+
+  switch (SrcSize) {
+  case 1:
+    AndOp1 = _Bfe(1, 7, AndOp1);
+  break;
+  case 2:
+    AndOp1 = _Bfe(1, 15, AndOp1);
+  break;
+  case 4:
+    AndOp1 = _Bfe(1, 31, AndOp1);
+  break;
+  case 8:
+    AndOp1 = _Bfe(1, 63, AndOp1);
+  break;
+  default:
+    LOGMAN_MSG_A_FMT("Unknown BFE size: {}", SrcSize);
+  break;
+  }
+
+  SetNZCV(SF, ZF, SelectCF, AndOp1);
 }
 
 void OpDispatchBuilder::CalculcateFlags_SUB(uint8_t SrcSize, OrderedNode *Res, OrderedNode *Src1, OrderedNode *Src2, bool UpdateCF) {
   // AF
   {
-    OrderedNode *AFRes = _Xor(_Xor(Src1, Src2), Res);
-    AFRes = _Bfe(1, 4, AFRes);
-    SetRFLAG<FEXCore::X86State::RFLAG_AF_LOC>(AFRes);
-  }
-
-  // SF
-  {
-    auto SignBitConst = _Constant(SrcSize * 8 - 1);
-
-    auto LshrOp = _Lshr(Res, SignBitConst);
-    SetRFLAG<FEXCore::X86State::RFLAG_SF_LOC>(LshrOp);
+    SetRawAF(_Xor(_Xor(Src1, Src2), Res));
   }
 
   // PF
   if (!CTX->Config.ABINoPF) {
-    auto EightBitMask = _Constant(0xFF);
-    auto PopCountOp = _Popcount(_And(Res, EightBitMask));
-    auto XorOp = _Xor(PopCountOp, _Constant(1));
-    SetRFLAG<FEXCore::X86State::RFLAG_PF_LOC>(XorOp);
+    SetRawPF(Res);
   } else {
     _InvalidateFlags(1UL << FEXCore::X86State::RFLAG_PF_LOC);
   }
 
-  // ZF
+  // SF/ZF/CF/OF
+  // The backend regenerates these from the compare, so Res isn't needed here
   {
-    auto ZeroConst = _Constant(0);
-    auto OneConst = _Constant(1);
-    auto SelectOp = _Select(FEXCore::IR::COND_EQ,
-        Res, ZeroConst, OneConst, ZeroConst);
-    SetRFLAG<FEXCore::X86State::RFLAG_ZF_LOC>(SelectOp);
-  }
-
-  // CF
-  if (UpdateCF) {
-    auto ZeroConst = _Constant(0);
-    auto OneConst = _Constant(1);
-
-    auto SelectOp = _Select(FEXCore::IR::COND_ULT,
-        Src1, Src2, OneConst, ZeroConst);
-
-    SetRFLAG<FEXCore::X86State::RFLAG_CF_LOC>(SelectOp);
-  }
-  // OF
-  {
-    auto XorOp1 = _Xor(Src1, Src2);
-    auto XorOp2 = _Xor(Res, Src1);
-    OrderedNode *FinalAnd = _And(XorOp1, XorOp2);
-
-    FinalAnd = _Bfe(1, SrcSize * 8 - 1, FinalAnd);
-
-    SetRFLAG<FEXCore::X86State::RFLAG_OF_LOC>(FinalAnd);
+    OrderedNode *NZCV = _SubNZCV(SrcSize, Src1, Src2);
+    if (!UpdateCF) {
+      NZCV = _Bfi(4, 1, FEXCore::X86State::NZCV_CF_LOC, NZCV, GetRFLAG(FEXCore::X86State::RFLAG_CF_LOC));
+    }
+    StoreNZCV(NZCV);
   }
 }
 
 void OpDispatchBuilder::CalculcateFlags_ADD(uint8_t SrcSize, OrderedNode *Res, OrderedNode *Src1, OrderedNode *Src2, bool UpdateCF) {
   // AF
   {
-    OrderedNode *AFRes = _Xor(_Xor(Src1, Src2), Res);
-    AFRes = _Bfe(1, 4, AFRes);
-    SetRFLAG<FEXCore::X86State::RFLAG_AF_LOC>(AFRes);
-  }
-
-  // SF
-  {
-    auto SignBitConst = _Constant(SrcSize * 8 - 1);
-
-    auto LshrOp = _Lshr(Res, SignBitConst);
-    SetRFLAG<FEXCore::X86State::RFLAG_SF_LOC>(LshrOp);
+    SetRawAF(_Xor(_Xor(Src1, Src2), Res));
   }
 
   // PF
   if (!CTX->Config.ABINoPF) {
-    auto EightBitMask = _Constant(0xFF);
-    auto PopCountOp = _Popcount(_And(Res, EightBitMask));
-    auto XorOp = _Xor(PopCountOp, _Constant(1));
-    SetRFLAG<FEXCore::X86State::RFLAG_PF_LOC>(XorOp);
+    SetRawPF(Res);
   } else {
     _InvalidateFlags(1UL << FEXCore::X86State::RFLAG_PF_LOC);
   }
 
-  // ZF
-  {
-    auto SelectOp = _Select(FEXCore::IR::COND_EQ,
-        Res, _Constant(0), _Constant(1), _Constant(0));
-    SetRFLAG<FEXCore::X86State::RFLAG_ZF_LOC>(SelectOp);
-  }
-  // CF
-  if (UpdateCF) {
-    auto SelectOp = _Select(FEXCore::IR::COND_ULT, Res, Src2, _Constant(1), _Constant(0));
-
-    SetRFLAG<FEXCore::X86State::RFLAG_CF_LOC>(SelectOp);
-  }
-
-  // OF
+  // SF/ZF/CF/OF
   {
-    auto NegOne = _Constant(~0ULL);
-    auto XorOp1 = _Xor(_Xor(Src1, Src2), NegOne);
-    auto XorOp2 = _Xor(Res, Src1);
-
-    OrderedNode *AndOp1 = _And(XorOp1, XorOp2);
-
-    switch (SrcSize) {
-    case 1:
-      AndOp1 = _Bfe(1, 7, AndOp1);
-    break;
-    case 2:
-      AndOp1 = _Bfe(1, 15, AndOp1);
-    break;
-    case 4:
-      AndOp1 = _Bfe(1, 31, AndOp1);
-    break;
-    case 8:
-      AndOp1 = _Bfe(1, 63, AndOp1);
-    break;
-    default:
-      LOGMAN_MSG_A_FMT("Unknown BFE size: {}", SrcSize);
-    break;
+    OrderedNode *NZCV = _AddNZCV(SrcSize, Src1, Src2);
+    if (!UpdateCF) {
+      NZCV = _Bfi(4, 1, FEXCore::X86State::NZCV_CF_LOC, NZCV, GetRFLAG(FEXCore::X86State::RFLAG_CF_LOC));
     }
-    SetRFLAG<FEXCore::X86State::RFLAG_OF_LOC>(AndOp1);
+    StoreNZCV(NZCV);
   }
 }
 
@@ -533,8 +440,6 @@ void OpDispatchBuilder::CalculcateFlags_MUL(uint8_t SrcSize, OrderedNode *Res, O
   {
     SetRFLAG<FEXCore::X86State::RFLAG_PF_LOC>(_Constant(0));
     SetRFLAG<FEXCore::X86State::RFLAG_AF_LOC>(_Constant(0));
-    SetRFLAG<FEXCore::X86State::RFLAG_ZF_LOC>(_Constant(0));
-    SetRFLAG<FEXCore::X86State::RFLAG_SF_LOC>(_Constant(0));
   }
 
   // CF/OF
@@ -546,8 +451,7 @@ void OpDispatchBuilder::CalculcateFlags_MUL(uint8_t SrcSize, OrderedNode *Res, O
 
     auto SelectOp = _Select(FEXCore::IR::COND_EQ, High, SignBit, _Constant(0), _Constant(1));
 
-    SetRFLAG<FEXCore::X86State::RFLAG_CF_LOC>(SelectOp);
-    SetRFLAG<FEXCore::X86State::RFLAG_OF_LOC>(SelectOp);
+    SetNZCV(_Constant(0), _Constant(0), SelectOp, SelectOp);
   }
 }
 
@@ -556,9 +460,7 @@ void OpDispatchBuilder::CalculcateFlags_UMUL(OrderedNode *High) {
   // Undefined
   {
     SetRFLAG<FEXCore::X86State::RFLAG_AF_LOC>(_Constant(0));
-    SetRFLAG<FEXCore::X86State::RFLAG_SF_LOC>(_Constant(0));
     SetRFLAG<FEXCore::X86State::RFLAG_PF_LOC>(_Constant(0));
-    SetRFLAG<FEXCore::X86State::RFLAG_ZF_LOC>(_Constant(0));
   }
 
   // CF/OF
@@ -568,8 +470,7 @@ void OpDispatchBuilder::CalculcateFlags_UMUL(OrderedNode *High) {
 
     auto SelectOp = _Select(FEXCore::IR::COND_EQ, High, _Constant(0), _Constant(0), _Constant(1));
 
-    SetRFLAG<FEXCore::X86State::RFLAG_CF_LOC>(SelectOp);
-    SetRFLAG<FEXCore::X86State::RFLAG_OF_LOC>(SelectOp);
+    SetNZCV(_Constant(0), _Constant(0), SelectOp, SelectOp);
   }
 }
 
@@ -581,36 +482,24 @@ void OpDispatchBuilder::CalculcateFlags_Logical(uint8_t SrcSize, OrderedNode *Re
     SetRFLAG<FEXCore::X86State::RFLAG_AF_LOC>(_Constant(0));
   }
 
-  // SF
-  {
-    auto SignBitConst = _Constant(SrcSize * 8 - 1);
-
-    auto LshrOp = _Lshr(Res, SignBitConst);
-    SetRFLAG<FEXCore::X86State::RFLAG_SF_LOC>(LshrOp);
-  }
-
   // PF
   if (!CTX->Config.ABINoPF) {
-    auto EightBitMask = _Constant(0xFF);
-    auto PopCountOp = _Popcount(_And(Res, EightBitMask));
-    auto XorOp = _Xor(PopCountOp, _Constant(1));
-    SetRFLAG<FEXCore::X86State::RFLAG_PF_LOC>(XorOp);
+    SetRawPF(Res);
   } else {
     _InvalidateFlags(1UL << FEXCore::X86State::RFLAG_PF_LOC);
   }
 
+  // SF
+  auto SignBitConst = _Constant(SrcSize * 8 - 1);
+  auto SF = _Lshr(Res, SignBitConst);
+
   // ZF
-  {
-    auto SelectOp = _Select(FEXCore::IR::COND_EQ,
-        Res, _Constant(0), _Constant(1), _Constant(0));
-    SetRFLAG<FEXCore::X86State::RFLAG_ZF_LOC>(SelectOp);
-  }
+  auto ZF = _Select(FEXCore::IR::COND_EQ,
+      Res, _Constant(0), _Constant(1), _Constant(0));
 
   // CF/OF
-  {
-    SetRFLAG<FEXCore::X86State::RFLAG_CF_LOC>(_Constant(0));
-    SetRFLAG<FEXCore::X86State::RFLAG_OF_LOC>(_Constant(0));
-  }
+  // Cleared
+  SetNZCV(SF, ZF, _Constant(0), _Constant(0));
 }
 
 #define COND_FLAG_SET(cond, flag, newflag) \
@@ -618,22 +507,18 @@ auto oldflag = GetRFLAG(FEXCore::X86State::flag);\
 auto newval = _Select(FEXCore::IR::COND_EQ, cond, _Constant(0), oldflag, newflag);\
 SetRFLAG<FEXCore::X86State::flag>(newval);
 
-void OpDispatchBuilder::CalculcateFlags_ShiftLeft(uint8_t SrcSize, OrderedNode *Res, OrderedNode *Src1, OrderedNode *Src2) {
-  // CF
-  {
-    // Extract the last bit shifted in to CF
-    auto Size = _Constant(SrcSize * 8);
-    auto ShiftAmt = _Sub(Size, Src2);
-    auto LastBit = _And(_Lshr(Src1, ShiftAmt), _Constant(1));
-    COND_FLAG_SET(Src2, RFLAG_CF_LOC, LastBit);
-  }
+// Stores the new SF/ZF/CF/OF unless cond is zero, in which case NZCV is left alone
+#define COND_NZCV_SET(cond, newsf, newzf, newcf, newof) \
+auto oldnzcv = LoadNZCV();\
+auto newnzcv = PackNZCV(oldnzcv, newsf, newzf, newcf, newof);\
+StoreNZCV(_Select(FEXCore::IR::COND_EQ, cond, _Constant(0), oldnzcv, newnzcv));
 
+void OpDispatchBuilder::CalculcateFlags_ShiftLeft(uint8_t SrcSize, OrderedNode *Res, OrderedNode *Src1, OrderedNode *Src2) {
   // PF
   if (!CTX->Config.ABINoPF) {
-    auto EightBitMask = _Constant(0xFF);
-    auto PopCountOp = _Popcount(_And(Res, EightBitMask));
-    auto XorOp = _Xor(PopCountOp, _Constant(1));
-    COND_FLAG_SET(Src2, RFLAG_PF_LOC, XorOp);
+    // Raw PF state is selected directly, it doesn't need decoding
+    auto OldPF = _LoadFlag(FEXCore::X86State::RFLAG_PF_LOC);
+    SetRawPF(_Select(FEXCore::IR::COND_EQ, Src2, _Constant(0), OldPF, Res));
   } else {
     _InvalidateFlags(1UL << FEXCore::X86State::RFLAG_PF_LOC);
   }
@@ -645,43 +530,33 @@ void OpDispatchBuilder::CalculcateFlags_ShiftLeft(uint8_t SrcSize, OrderedNode *
     COND_FLAG_SET(Src2, RFLAG_AF_LOC, _Constant(0));
   }
 
+  // CF
+  // Extract the last bit shifted in to CF
+  auto Size = _Constant(SrcSize * 8);
+  auto ShiftAmt = _Sub(Size, Src2);
+  auto CF = _And(_Lshr(Src1, ShiftAmt), _Constant(1));
+
   // ZF
-  {
-    auto SelectOp = _Select(FEXCore::IR::COND_EQ,
-        Res, _Constant(0), _Constant(1), _Constant(0));
-    COND_FLAG_SET(Src2, RFLAG_ZF_LOC, SelectOp);
-  }
+  auto ZF = _Select(FEXCore::IR::COND_EQ,
+      Res, _Constant(0), _Constant(1), _Constant(0));
 
   // SF
-  {
-    auto val = _Bfe(1, SrcSize * 8 - 1, Res);
-    COND_FLAG_SET(Src2, RFLAG_SF_LOC, val);
-  }
+  auto SF = _Bfe(1, SrcSize * 8 - 1, Res);
 
   // OF
-  {
-    // In the case of left shift. OF is only set from the result of <Top Source Bit> XOR <Top Result Bit>
-    // When Shift > 1 then OF is undefined
-    auto val = _Bfe(1, SrcSize * 8 - 1, _Xor(Src1, Res));
-    COND_FLAG_SET(Src2, RFLAG_OF_LOC, val);
-  }
+  // In the case of left shift. OF is only set from the result of <Top Source Bit> XOR <Top Result Bit>
+  // When Shift > 1 then OF is undefined
+  auto OF = _Bfe(1, SrcSize * 8 - 1, _Xor(Src1, Res));
+
+  COND_NZCV_SET(Src2, SF, ZF, CF, OF);
 }
 
 void OpDispatchBuilder::CalculcateFlags_ShiftRight(uint8_t SrcSize, OrderedNode *Res, OrderedNode *Src1, OrderedNode *Src2) {
-  // CF
-  {
-    // Extract the last bit shifted in to CF
-    auto ShiftAmt = _Sub(Src2, _Constant(1));
-    auto LastBit = _And(_Lshr(Src1, ShiftAmt), _Constant(1));
-    COND_FLAG_SET(Src2, RFLAG_CF_LOC, LastBit);
-  }
-
   // PF
   if (!CTX->Config.ABINoPF) {
-    auto EightBitMask = _Constant(0xFF);
-    auto PopCountOp = _Popcount(_And(Res, EightBitMask));
-    auto XorOp = _Xor(PopCountOp, _Constant(1));
-    COND_FLAG_SET(Src2, RFLAG_PF_LOC, XorOp);
+    // Raw PF state is selected directly, it doesn't need decoding
+    auto OldPF = _LoadFlag(FEXCore::X86State::RFLAG_PF_LOC);
+    SetRawPF(_Select(FEXCore::IR::COND_EQ, Src2, _Constant(0), OldPF, Res));
   } else {
     _InvalidateFlags(1UL << FEXCore::X86State::RFLAG_PF_LOC);
   }
@@ -693,43 +568,32 @@ void OpDispatchBuilder::CalculcateFlags_ShiftRight(uint8_t SrcSize, OrderedNode
     COND_FLAG_SET(Src2, RFLAG_AF_LOC, _Constant(0));
   }
 
+  // CF
+  // Extract the last bit shifted in to CF
+  auto ShiftAmt = _Sub(Src2, _Constant(1));
+  auto CF = _And(_Lshr(Src1, ShiftAmt), _Constant(1));
+
   // ZF
-  {
-    auto SelectOp = _Select(FEXCore::IR::COND_EQ,
-        Res, _Constant(0), _Constant(1), _Constant(0));
-    COND_FLAG_SET(Src2, RFLAG_ZF_LOC, SelectOp);
-  }
+  auto ZF = _Select(FEXCore::IR::COND_EQ,
+      Res, _Constant(0), _Constant(1), _Constant(0));
 
   // SF
-  {
-    auto val =_Bfe(1, SrcSize * 8 - 1, Res);
-    COND_FLAG_SET(Src2, RFLAG_SF_LOC, val);
-  }
+  auto SF = _Bfe(1, SrcSize * 8 - 1, Res);
 
   // OF
-  {
-    // Only defined when Shift is 1 else undefined
-    // OF flag is set if a sign change occurred
-    auto val = _Bfe(1, SrcSize * 8 - 1, _Xor(Src1, Res));
-    COND_FLAG_SET(Src2, RFLAG_OF_LOC, val);
-  }
+  // Only defined when Shift is 1 else undefined
+  // OF flag is set if a sign change occurred
+  auto OF = _Bfe(1, SrcSize * 8 - 1, _Xor(Src1, Res));
+
+  COND_NZCV_SET(Src2, SF, ZF, CF, OF);
 }
 
 void OpDispatchBuilder::CalculcateFlags_SignShiftRight(uint8_t SrcSize, OrderedNode *Res, OrderedNode *Src1, OrderedNode *Src2) {
-  // CF
-  {
-    // Extract the last bit shifted in to CF
-    auto ShiftAmt = _Sub(Src2, _Constant(1));
-    auto LastBit = _And(_Lshr(Src1, ShiftAmt), _Constant(1));
-    COND_FLAG_SET(Src2, RFLAG_CF_LOC, LastBit);
-  }
-
   // PF
   if (!CTX->Config.ABINoPF) {
-    auto EightBitMask = _Constant(0xFF);
-    auto PopCountOp = _Popcount(_And(Res, EightBitMask));
-    auto XorOp = _Xor(PopCountOp, _Constant(1));
-    COND_FLAG_SET(Src2, RFLAG_PF_LOC, XorOp);
+    // Raw PF state is selected directly, it doesn't need decoding
+    auto OldPF = _LoadFlag(FEXCore::X86State::RFLAG_PF_LOC);
+    SetRawPF(_Select(FEXCore::IR::COND_EQ, Src2, _Constant(0), OldPF, Res));
   } else {
     _InvalidateFlags(1UL << FEXCore::X86State::RFLAG_PF_LOC);
   }
@@ -741,47 +605,32 @@ void OpDispatchBuilder::CalculcateFlags_SignShiftRight(uint8_t SrcSize, OrderedN
     COND_FLAG_SET(Src2, RFLAG_AF_LOC, _Constant(0));
   }
 
+  // CF
+  // Extract the last bit shifted in to CF
+  auto ShiftAmt = _Sub(Src2, _Constant(1));
+  auto CF = _And(_Lshr(Src1, ShiftAmt), _Constant(1));
+
   // ZF
-  {
-    auto SelectOp = _Select(FEXCore::IR::COND_EQ,
-        Res, _Constant(0), _Constant(1), _Constant(0));
-    COND_FLAG_SET(Src2, RFLAG_ZF_LOC, SelectOp);
-  }
+  auto ZF = _Select(FEXCore::IR::COND_EQ,
+      Res, _Constant(0), _Constant(1), _Constant(0));
 
   // SF
-  {
-    auto SignBitConst = _Constant(SrcSize * 8 - 1);
-
-    auto LshrOp = _Lshr(Res, SignBitConst);
-    COND_FLAG_SET(Src2, RFLAG_SF_LOC, LshrOp);
-  }
+  auto SignBitConst = _Constant(SrcSize * 8 - 1);
+  auto SF = _Lshr(Res, SignBitConst);
 
   // OF
-  {
-    COND_FLAG_SET(Src2, RFLAG_OF_LOC, _Constant(0));
-  }
+  auto OF = _Constant(0);
+
+  COND_NZCV_SET(Src2, SF, ZF, CF, OF);
 }
 
 void OpDispatchBuilder::CalculcateFlags_ShiftLeftImmediate(uint8_t SrcSize, OrderedNode *Res, OrderedNode *Src1, uint64_t Shift) {
   // No flags changed if shift is zero
   if (Shift == 0) return;
 
-  // CF
-  {
-    // Extract the last bit shifted in to CF
-    auto OpSize = SrcSize * 8;
-    if (OpSize < Shift) {
-      Shift &= (OpSize - 1);
-    }
-    SetRFLAG<FEXCore::X86State::RFLAG_CF_LOC>(_Bfe(1, OpSize - Shift, Src1));
-  }
-
   // PF
   if (!CTX->Config.ABINoPF) {
-    auto EightBitMask = _Constant(0xFF);
-    auto PopCountOp = _Popcount(_And(Res, EightBitMask));
-    auto XorOp = _Xor(PopCountOp, _Constant(1));
-    SetRFLAG<FEXCore::X86State::RFLAG_PF_LOC>(XorOp);
+    SetRawPF(Res);
   } else {
     _InvalidateFlags(1UL << FEXCore::X86State::RFLAG_PF_LOC);
   }
@@ -793,44 +642,39 @@ void OpDispatchBuilder::CalculcateFlags_ShiftLeftImmediate(uint8_t SrcSize, Orde
     SetRFLAG<FEXCore::X86State::RFLAG_AF_LOC>(_Constant(0));
   }
 
-  // ZF
-  {
-    auto SelectOp = _Select(FEXCore::IR::COND_EQ,
-        Res, _Constant(0), _Constant(1), _Constant(0));
-    SetRFLAG<FEXCore::X86State::RFLAG_ZF_LOC>(SelectOp);
+  // CF
+  // Extract the last bit shifted in to CF
+  auto OpSize = SrcSize * 8;
+  if (OpSize < Shift) {
+    Shift &= (OpSize - 1);
   }
+  auto CF = _Bfe(1, OpSize - Shift, Src1);
 
-  // SF
-  {
-    auto LshrOp = _Bfe(1, SrcSize * 8 - 1, Res);
+  // ZF
+  auto ZF = _Select(FEXCore::IR::COND_EQ,
+      Res, _Constant(0), _Constant(1), _Constant(0));
 
-    SetRFLAG<FEXCore::X86State::RFLAG_SF_LOC>(LshrOp);
+  // SF
+  auto SF = _Bfe(1, SrcSize * 8 - 1, Res);
 
-    // OF
-    // In the case of left shift. OF is only set from the result of <Top Source Bit> XOR <Top Result Bit>
-    if (Shift == 1) {
-      auto SourceBit = _Bfe(1, SrcSize * 8 - 1, Src1);
-      SetRFLAG<FEXCore::X86State::RFLAG_OF_LOC>(_Xor(SourceBit, LshrOp));
-    }
+  // OF
+  // In the case of left shift. OF is only set from the result of <Top Source Bit> XOR <Top Result Bit>
+  OrderedNode *OF{};
+  if (Shift == 1) {
+    auto SourceBit = _Bfe(1, SrcSize * 8 - 1, Src1);
+    OF = _Xor(SourceBit, SF);
   }
+
+  SetNZCV(SF, ZF, CF, OF);
 }
 
 void OpDispatchBuilder::CalculcateFlags_SignShiftRightImmediate(uint8_t SrcSize, OrderedNode *Res, OrderedNode *Src1, uint64_t Shift) {
   // No flags changed if shift is zero
   if (Shift == 0) return;
 
-  // CF
-  {
-    // Extract the last bit shifted in to CF
-    SetRFLAG<FEXCore::X86State::RFLAG_CF_LOC>(_Bfe(1, Shift-1, Src1));
-  }
-
   // PF
   if (!CTX->Config.ABINoPF) {
-    auto EightBitMask = _Constant(0xFF);
-    auto PopCountOp = _Popcount(_And(Res, EightBitMask));
-    auto XorOp = _Xor(PopCountOp, _Constant(1));
-    SetRFLAG<FEXCore::X86State::RFLAG_PF_LOC>(XorOp);
+    SetRawPF(Res);
   } else {
     _InvalidateFlags(1UL << FEXCore::X86State::RFLAG_PF_LOC);
   }
@@ -842,46 +686,37 @@ void OpDispatchBuilder::CalculcateFlags_SignShiftRightImmediate(uint8_t SrcSize,
     SetRFLAG<FEXCore::X86State::RFLAG_AF_LOC>(_Constant(0));
   }
 
+  // CF
+  // Extract the last bit shifted in to CF
+  auto CF = _Bfe(1, Shift-1, Src1);
+
   // ZF
-  {
-    auto SelectOp = _Select(FEXCore::IR::COND_EQ,
-        Res, _Constant(0), _Constant(1), _Constant(0));
-    SetRFLAG<FEXCore::X86State::RFLAG_ZF_LOC>(SelectOp);
-  }
+  auto ZF = _Select(FEXCore::IR::COND_EQ,
+      Res, _Constant(0), _Constant(1), _Constant(0));
 
   // SF
-  {
-    auto SignBitConst = _Constant(SrcSize * 8 - 1);
-
-    auto LshrOp = _Lshr(Res, SignBitConst);
-    SetRFLAG<FEXCore::X86State::RFLAG_SF_LOC>(LshrOp);
+  auto SignBitConst = _Constant(SrcSize * 8 - 1);
+  auto SF = _Lshr(Res, SignBitConst);
 
-    // OF
-    // Only defined when Shift is 1 else undefined
-    // Only is set if the top bit was set to 1 when shifted
-    // So it is set to same value as SF
-    if (Shift == 1) {
-      SetRFLAG<FEXCore::X86State::RFLAG_OF_LOC>(_Constant(0));
-    }
+  // OF
+  // Only defined when Shift is 1 else undefined
+  // Only is set if the top bit was set to 1 when shifted
+  // So it is set to same value as SF
+  OrderedNode *OF{};
+  if (Shift == 1) {
+    OF = _Constant(0);
   }
+
+  SetNZCV(SF, ZF, CF, OF);
 }
 
 void OpDispatchBuilder::CalculcateFlags_ShiftRightImmediate(uint8_t SrcSize, OrderedNode *Res, OrderedNode *Src1, uint64_t Shift) {
   // No flags changed if shift is zero
   if (Shift == 0) return;
 
-  // CF
-  {
-    // Extract the last bit shifted in to CF
-    SetRFLAG<FEXCore::X86State::RFLAG_CF_LOC>(_Bfe(1, Shift-1, Src1));
-  }
-
   // PF
   if (!CTX->Config.ABINoPF) {
-    auto EightBitMask = _Constant(0xFF);
-    auto PopCountOp = _Popcount(_And(Res, EightBitMask));
-    auto XorOp = _Xor(PopCountOp, _Constant(1));
-    SetRFLAG<FEXCore::X86State::RFLAG_PF_LOC>(XorOp);
+    SetRawPF(Res);
   } else {
     _InvalidateFlags(1UL << FEXCore::X86State::RFLAG_PF_LOC);
   }
@@ -893,114 +728,80 @@ void OpDispatchBuilder::CalculcateFlags_ShiftRightImmediate(uint8_t SrcSize, Ord
     SetRFLAG<FEXCore::X86State::RFLAG_AF_LOC>(_Constant(0));
   }
 
+  // CF
+  // Extract the last bit shifted in to CF
+  auto CF = _Bfe(1, Shift-1, Src1);
+
   // ZF
-  {
-    auto SelectOp = _Select(FEXCore::IR::COND_EQ,
-        Res, _Constant(0), _Constant(1), _Constant(0));
-    SetRFLAG<FEXCore::X86State::RFLAG_ZF_LOC>(SelectOp);
-  }
+  auto ZF = _Select(FEXCore::IR::COND_EQ,
+      Res, _Constant(0), _Constant(1), _Constant(0));
 
   // SF
-  {
-    auto SignBitConst = _Constant(SrcSize * 8 - 1);
-
-    auto LshrOp = _Lshr(Res, SignBitConst);
-    SetRFLAG<FEXCore::X86State::RFLAG_SF_LOC>(LshrOp);
-  }
+  auto SignBitConst = _Constant(SrcSize * 8 - 1);
+  auto SF = _Lshr(Res, SignBitConst);
 
   // OF
-  {
-    // Only defined when Shift is 1 else undefined
-    // Is set to the MSB of the original value
-    if (Shift == 1) {
-      SetRFLAG<FEXCore::X86State::RFLAG_OF_LOC>(_Bfe(1, SrcSize * 8 - 1, Src1));
-    }
+  // Only defined when Shift is 1 else undefined
+  // Is set to the MSB of the original value
+  OrderedNode *OF{};
+  if (Shift == 1) {
+    OF = _Bfe(1, SrcSize * 8 - 1, Src1);
   }
+
+  SetNZCV(SF, ZF, CF, OF);
 }
 
 void OpDispatchBuilder::CalculcateFlags_RotateRight(uint8_t SrcSize, OrderedNode *Res, OrderedNode *Src1, OrderedNode *Src2) {
   auto OpSize = SrcSize * 8;
 
+  // CF
   // Extract the last bit shifted in to CF
   auto NewCF = _Bfe(1, OpSize - 1, Res);
 
-  // CF
-  {
-    auto OldCF = GetRFLAG(FEXCore::X86State::RFLAG_CF_LOC);
-    auto CF = _Select(FEXCore::IR::COND_EQ, Src2, _Constant(0), OldCF, NewCF);
-
-    // Extract the last bit shifted in to CF
-    SetRFLAG<FEXCore::X86State::RFLAG_CF_LOC>(CF);
-  }
-
   // OF
-  {
-    auto OldOF = GetRFLAG(FEXCore::X86State::RFLAG_OF_LOC);
-
-    // OF is set to the XOR of the new CF bit and the most significant bit of the result
-    // OF is architecturally only defined for 1-bit rotate, which is why this only happens when the shift is one.
-    auto NewOF = _Xor(_Bfe(1, OpSize - 2, Res), NewCF);
+  // OF is set to the XOR of the new CF bit and the most significant bit of the result
+  // OF is architecturally only defined for 1-bit rotate, which is why this only happens when the shift is one.
+  auto NewOF = _Xor(_Bfe(1, OpSize - 2, Res), NewCF);
 
-    // If shift == 0, don't update flags
-    auto OF = _Select(FEXCore::IR::COND_EQ, Src2, _Constant(0), OldOF, NewOF);
-
-    SetRFLAG<FEXCore::X86State::RFLAG_OF_LOC>(OF);
-  }
+  // If shift == 0, don't update flags
+  COND_NZCV_SET(Src2, nullptr, nullptr, NewCF, NewOF);
 }
 
 void OpDispatchBuilder::CalculcateFlags_RotateLeft(uint8_t SrcSize, OrderedNode *Res, OrderedNode *Src1, OrderedNode *Src2) {
   auto OpSize = SrcSize * 8;
 
+  // CF
   // Extract the last bit shifted in to CF
-  //auto Size = _Constant(GetSrcSize(Res) * 8);
-  //auto ShiftAmt = _Sub(Size, Src2);
   auto NewCF = _Bfe(1, 0, Res);
 
-  // CF
-  {
-    auto OldCF = GetRFLAG(FEXCore::X86State::RFLAG_CF_LOC);
-    auto CF = _Select(FEXCore::IR::COND_EQ, Src2, _Constant(0), OldCF, NewCF);
-
-    // Extract the last bit shifted in to CF
-    SetRFLAG<FEXCore::X86State::RFLAG_CF_LOC>(CF);
-  }
-
   // OF
-  {
-    auto OldOF = GetRFLAG(FEXCore::X86State::RFLAG_OF_LOC);
-    // OF is the LSB and MSB XOR'd together.
-    // OF is set to the XOR of the new CF bit and the most significant bit of the result.
-    // OF is architecturally only defined for 1-bit rotate, which is why this only happens when the shift is one.
-    auto NewOF = _Xor(_Bfe(1, OpSize - 1, Res), NewCF);
-
-    auto OF = _Select(FEXCore::IR::COND_EQ, Src2, _Constant(0), OldOF, NewOF);
+  // OF is the LSB and MSB XOR'd together.
+  // OF is set to the XOR of the new CF bit and the most significant bit of the result.
+  // OF is architecturally only defined for 1-bit rotate, which is why this only happens when the shift is one.
+  auto NewOF = _Xor(_Bfe(1, OpSize - 1, Res), NewCF);
 
-    // If shift == 0, don't update flags
-    SetRFLAG<FEXCore::X86State::RFLAG_OF_LOC>(OF);
-  }
+  // If shift == 0, don't update flags
+  COND_NZCV_SET(Src2, nullptr, nullptr, NewCF, NewOF);
 }
 
 void OpDispatchBuilder::CalculcateFlags_RotateRightImmediate(uint8_t SrcSize, OrderedNode *Res, OrderedNode *Src1, uint64_t Shift) {
   if (Shift == 0) return;
 
   auto OpSize = SrcSize * 8;
-  auto NewCF = _Bfe(1, OpSize - 1, Res);
 
   // CF
-  {
-    // Extract the last bit shifted in to CF
-    SetRFLAG<FEXCore::X86State::RFLAG_CF_LOC>(NewCF);
-  }
+  // Extract the last bit shifted in to CF
+  auto NewCF = _Bfe(1, OpSize - 1, Res);
 
   // OF
-  {
-    if (Shift == 1) {
-      // OF is the top two MSBs XOR'd together
-      // OF is architecturally only defined for 1-bit rotate, which is why this only happens when the shift is one.
-      auto NewOF = _Xor(_Bfe(1, OpSize - 2, Res), NewCF);
-      SetRFLAG<FEXCore::X86State::RFLAG_OF_LOC>(NewOF);
-    }
+  OrderedNode *NewOF{};
+  if (Shift == 1) {
+    // OF is the top two MSBs XOR'd together
+    // OF is architecturally only defined for 1-bit rotate, which is why this only happens when the shift is one.
+    NewOF = _Xor(_Bfe(1, OpSize - 2, Res), NewCF);
   }
+
+  SetNZCV(nullptr, nullptr, NewCF, NewOF);
 }
 
 void OpDispatchBuilder::CalculcateFlags_RotateLeftImmediate(uint8_t SrcSize, OrderedNode *Res, OrderedNode *Src1, uint64_t Shift) {
@@ -1008,24 +809,20 @@ void OpDispatchBuilder::CalculcateFlags_RotateLeftImmediate(uint8_t SrcSize, Ord
 
   auto OpSize = SrcSize * 8;
 
-  auto NewCF = _Bfe(1, 0, Res);
   // CF
-  {
-    // Extract the last bit shifted in to CF
-    SetRFLAG<FEXCore::X86State::RFLAG_CF_LOC>(NewCF);
-  }
+  // Extract the last bit shifted in to CF
+  auto NewCF = _Bfe(1, 0, Res);
 
   // OF
-  {
-    if (Shift == 1) {
-      // OF is the LSB and MSB XOR'd together.
-      // OF is set to the XOR of the new CF bit and the most significant bit of the result.
-      // OF is architecturally only defined for 1-bit rotate, which is why this only happens when the shift is one.
-      auto NewOF = _Xor(_Bfe(1, OpSize - 1, Res), NewCF);
-
-      SetRFLAG<FEXCore::X86State::RFLAG_OF_LOC>(NewOF);
-    }
+  OrderedNode *NewOF{};
+  if (Shift == 1) {
+    // OF is the LSB and MSB XOR'd together.
+    // OF is set to the XOR of the new CF bit and the most significant bit of the result.
+    // OF is architecturally only defined for 1-bit rotate, which is why this only happens when the shift is one.
+    NewOF = _Xor(_Bfe(1, OpSize - 1, Res), NewCF);
   }
+
+  SetNZCV(nullptr, nullptr, NewCF, NewOF);
 }
 
 void OpDispatchBuilder::CalculcateFlags_FCMP(uint8_t SrcSize, OrderedNode *Res, OrderedNode *Src1, OrderedNode *Src2) {
@@ -1033,14 +830,11 @@ void OpDispatchBuilder::CalculcateFlags_FCMP(uint8_t SrcSize, OrderedNode *Res,
   OrderedNode *HostFlag_ZF = _GetHostFlag(Res, FCMP_FLAG_EQ);
   OrderedNode *HostFlag_Unordered  = _GetHostFlag(Res, FCMP_FLAG_UNORDERED);
 
-  SetRFLAG<FEXCore::X86State::RFLAG_CF_LOC>(HostFlag_CF);
-  SetRFLAG<FEXCore::X86State::RFLAG_ZF_LOC>(HostFlag_ZF);
   SetRFLAG<FEXCore::X86State::RFLAG_PF_LOC>(HostFlag_Unordered);
 
   auto ZeroConst = _Constant(0);
   SetRFLAG<FEXCore::X86State::RFLAG_AF_LOC>(ZeroConst);
-  SetRFLAG<FEXCore::X86State::RFLAG_SF_LOC>(ZeroConst);
-  SetRFLAG<FEXCore::X86State::RFLAG_OF_LOC>(ZeroConst);
+  SetNZCV(ZeroConst, HostFlag_ZF, HostFlag_CF, ZeroConst);
 }
 
 void OpDispatchBuilder::CalculcateFlags_BEXTR(OrderedNode *Src) {
@@ -1051,14 +845,10 @@ void OpDispatchBuilder::CalculcateFlags_BEXTR(OrderedNode *Src) {
   //
   // CF and OF are defined as being set to zero
   //
-  SetRFLAG<X86State::RFLAG_CF_LOC>(_Constant(0));
-  SetRFLAG<X86State::RFLAG_OF_LOC>(_Constant(0));
-
   // Every other flag is considered undefined after a
   // BEXTR instruction, but we opt to reliably clear them.
   //
   SetRFLAG<X86State::RFLAG_AF_LOC>(_Constant(0));
-  SetRFLAG<X86State::RFLAG_SF_LOC>(_Constant(0));
 
   // PF
   if (CTX->Config.ABINoPF) {
@@ -1071,7 +861,7 @@ void OpDispatchBuilder::CalculcateFlags_BEXTR(OrderedNode *Src) {
   auto ZeroOp = _Select(IR::COND_EQ,
                         Src, _Constant(0),
                         _Constant(1), _Constant(0));
-  SetRFLAG<X86State::RFLAG_ZF_LOC>(ZeroOp);
+  SetNZCV(_Constant(0), ZeroOp, _Constant(0), _Constant(0));
 }
 
 void OpDispatchBuilder::CalculcateFlags_BLSI(uint8_t SrcSize, OrderedNode *Src) {
@@ -1089,7 +879,6 @@ void OpDispatchBuilder::CalculcateFlags_BLSI(uint8_t SrcSize, OrderedNode *Src)
   auto Zero = _Constant(0);
   auto One = _Constant(1);
 
-  SetRFLAG<X86State::RFLAG_OF_LOC>(Zero);
   SetRFLAG<X86State::RFLAG_AF_LOC>(Zero);
   if (CTX->Config.ABINoPF) {
     _InvalidateFlags(1UL << X86State::RFLAG_PF_LOC);
@@ -1098,28 +887,20 @@ void OpDispatchBuilder::CalculcateFlags_BLSI(uint8_t SrcSize, OrderedNode *Src)
   }
 
   // ZF
-  {
-    auto ZFOp = _Select(IR::COND_EQ,
-                        Src, Zero,
-                        One, Zero);
-    SetRFLAG<X86State::RFLAG_ZF_LOC>(ZFOp);
-  }
+  auto ZFOp = _Select(IR::COND_EQ,
+                      Src, Zero,
+                      One, Zero);
 
   // CF
-  {
-    auto CFOp = _Select(IR::COND_EQ,
-                        Src, Zero,
-                        Zero, One);
-    SetRFLAG<X86State::RFLAG_CF_LOC>(CFOp);
-  }
+  auto CFOp = _Select(IR::COND_EQ,
+                      Src, Zero,
+                      Zero, One);
 
   // SF
-  {
-    auto SignBit = _Constant(SrcSize * 8 - 1);
-    auto SFOp = _Lshr(Src, SignBit);
+  auto SignBit = _Constant(SrcSize * 8 - 1);
+  auto SFOp = _Lshr(Src, SignBit);
 
-    SetRFLAG<X86State::RFLAG_SF_LOC>(SFOp);
-  }
+  SetNZCV(SFOp, ZFOp, CFOp, Zero);
 }
 
 void OpDispatchBuilder::CalculcateFlags_BLSMSK(OrderedNode *Src) {
@@ -1128,8 +909,6 @@ void OpDispatchBuilder::CalculcateFlags_BLSMSK(OrderedNode *Src) {
   auto Zero = _Constant(0);
   auto One = _Constant(1);
 
-  SetRFLAG<X86State::RFLAG_ZF_LOC>(Zero);
-  SetRFLAG<X86State::RFLAG_OF_LOC>(Zero);
   SetRFLAG<X86State::RFLAG_AF_LOC>(Zero);
   if (CTX->Config.ABINoPF) {
     _InvalidateFlags(1UL << X86State::RFLAG_PF_LOC);
@@ -1140,7 +919,9 @@ void OpDispatchBuilder::CalculcateFlags_BLSMSK(OrderedNode *Src) {
   auto CFOp = _Select(IR::COND_EQ,
                       Src, Zero,
                       Zero, One);
-  SetRFLAG<X86State::RFLAG_CF_LOC>(CFOp);
+
+  // SF isn't defined, leave it alone
+  SetNZCV(nullptr, Zero, CFOp, Zero);
 }
 
 void OpDispatchBuilder::CalculcateFlags_BLSR(uint8_t SrcSize, OrderedNode *Result, OrderedNode *Src) {
@@ -1148,7 +929,6 @@ void OpDispatchBuilder::CalculcateFlags_BLSR(uint8_t SrcSize, OrderedNode *Resul
   auto Zero = _Constant(0);
   auto One = _Constant(1);
 
-  SetRFLAG<X86State::RFLAG_OF_LOC>(Zero);
   SetRFLAG<X86State::RFLAG_AF_LOC>(Zero);
   if (CTX->Config.ABINoPF) {
     _InvalidateFlags(1UL << X86State::RFLAG_PF_LOC);
@@ -1157,28 +937,20 @@ void OpDispatchBuilder::CalculcateFlags_BLSR(uint8_t SrcSize, OrderedNode *Resul
   }
 
   // ZF
-  {
-    auto ZFOp = _Select(IR::COND_EQ,
-                        Result, Zero,
-                        One, Zero);
-    SetRFLAG<X86State::RFLAG_ZF_LOC>(ZFOp);
-  }
+  auto ZFOp = _Select(IR::COND_EQ,
+                      Result, Zero,
+                      One, Zero);
 
   // CF
-  {
-    auto CFOp = _Select(IR::COND_EQ,
-                        Src, Zero,
-                        Zero, One);
-    SetRFLAG<X86State::RFLAG_CF_LOC>(CFOp);
-  }
+  auto CFOp = _Select(IR::COND_EQ,
+                      Src, Zero,
+                      Zero, One);
 
   // SF
-  {
-    auto SignBit = _Constant(SrcSize * 8 - 1);
-    auto SFOp = _Lshr(Result, SignBit);
+  auto SignBit = _Constant(SrcSize * 8 - 1);
+  auto SFOp = _Lshr(Result, SignBit);
 
-    SetRFLAG<X86State::RFLAG_SF_LOC>(SFOp);
-  }
+  SetNZCV(SFOp, ZFOp, CFOp, Zero);
 }
 
 void OpDispatchBuilder::CalculcateFlags_POPCOUNT(OrderedNode *Src) {
@@ -1189,12 +961,9 @@ void OpDispatchBuilder::CalculcateFlags_POPCOUNT(OrderedNode *Src) {
       _Constant(1), Zero);
 
   // Set flags
-  SetRFLAG<FEXCore::X86State::RFLAG_CF_LOC>(Zero);
   SetRFLAG<FEXCore::X86State::RFLAG_PF_LOC>(Zero);
   SetRFLAG<FEXCore::X86State::RFLAG_AF_LOC>(Zero);
-  SetRFLAG<FEXCore::X86State::RFLAG_ZF_LOC>(ZFResult);
-  SetRFLAG<FEXCore::X86State::RFLAG_SF_LOC>(Zero);
-  SetRFLAG<FEXCore::X86State::RFLAG_OF_LOC>(Zero);
+  SetNZCV(Zero, ZFResult, Zero, Zero);
 }
 
 void OpDispatchBuilder::CalculcateFlags_BZHI(uint8_t SrcSize, OrderedNode *Result, OrderedNode *Src) {
@@ -1204,7 +973,6 @@ void OpDispatchBuilder::CalculcateFlags_BZHI(uint8_t SrcSize, OrderedNode *Resul
   auto Zero = _Constant(0);
   auto One = _Constant(1);
 
-  SetRFLAG<X86State::RFLAG_OF_LOC>(Zero);
   SetRFLAG<X86State::RFLAG_AF_LOC>(Zero);
   if (CTX->Config.ABINoPF) {
     _InvalidateFlags(1UL << X86State::RFLAG_PF_LOC);
@@ -1213,27 +981,19 @@ void OpDispatchBuilder::CalculcateFlags_BZHI(uint8_t SrcSize, OrderedNode *Resul
   }
 
   // ZF
-  {
-    auto ZFOp = _Select(IR::COND_EQ,
-                        Result, Zero,
-                        One, Zero);
-    SetRFLAG<X86State::RFLAG_ZF_LOC>(ZFOp);
-  }
+  auto ZFOp = _Select(IR::COND_EQ,
+                      Result, Zero,
+                      One, Zero);
 
   // CF
-  {
-    auto CFOp = _Select(IR::COND_UGT,
-                        Src, Bounds,
-                        One, Zero);
-    SetRFLAG<X86State::RFLAG_CF_LOC>(CFOp);
-  }
+  auto CFOp = _Select(IR::COND_UGT,
+                      Src, Bounds,
+                      One, Zero);
 
   // SF
-  {
-    auto SFOp = _Lshr(Result, Bounds);
+  auto SFOp = _Lshr(Result, Bounds);
 
-    SetRFLAG<X86State::RFLAG_SF_LOC>(SFOp);
-  }
+  SetNZCV(SFOp, ZFOp, CFOp, Zero);
 }
 
 void OpDispatchBuilder::CalculcateFlags_TZCNT(OrderedNode *Src) {
@@ -1244,8 +1004,7 @@ void OpDispatchBuilder::CalculcateFlags_TZCNT(OrderedNode *Src) {
       _Constant(1), Zero);
 
   // Set flags
-  SetRFLAG<FEXCore::X86State::RFLAG_CF_LOC>(ZFResult);
-  SetRFLAG<FEXCore::X86State::RFLAG_ZF_LOC>(_Bfe(1, 0, Src));
+  SetNZCV(nullptr, _Bfe(1, 0, Src), ZFResult, nullptr);
 }
 
 void OpDispatchBuilder::CalculcateFlags_LZCNT(uint8_t SrcSize, OrderedNode *Src) {
@@ -1257,8 +1016,7 @@ void OpDispatchBuilder::CalculcateFlags_LZCNT(uint8_t SrcSize, OrderedNode *Src)
       _Constant(1), Zero);
 
   // Set flags
-  SetRFLAG<FEXCore::X86State::RFLAG_CF_LOC>(ZFResult);
-  SetRFLAG<FEXCore::X86State::RFLAG_ZF_LOC>(_Bfe(1, SrcSize * 8 - 1, Src));
+  SetNZCV(nullptr, _Bfe(1, SrcSize * 8 - 1, Src), ZFResult, nullptr);
 }
 
 void OpDispatchBuilder::CalculcateFlags_BITSELECT(OrderedNode *Src) {
@@ -1280,12 +1038,9 @@ void OpDispatchBuilder::CalculcateFlags_RDRAND(OrderedNode *Src) {
   // CF is set to the incoming source
 
   auto ZeroConst = _Constant(0);
-  SetRFLAG<X86State::RFLAG_OF_LOC>(ZeroConst);
-  SetRFLAG<X86State::RFLAG_SF_LOC>(ZeroConst);
-  SetRFLAG<X86State::RFLAG_ZF_LOC>(ZeroConst);
   SetRFLAG<X86State::RFLAG_AF_LOC>(ZeroConst);
   SetRFLAG<X86State::RFLAG_PF_LOC>(ZeroConst);
-  SetRFLAG<FEXCore::X86State::RFLAG_CF_LOC>(Src);
+  SetNZCV(ZeroConst, ZeroConst, Src, ZeroConst);
 }
 
 }
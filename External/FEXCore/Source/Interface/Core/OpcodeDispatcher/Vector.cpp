@@ -15,6 +15,7 @@ $end_info$
 #include <FEXCore/IR/IR.h>
 #include <FEXCore/Utils/LogManager.h>
 
+#include <algorithm>
 #include <array>
 #include <bit>
 #include <cstdint>
@@ -160,8 +161,13 @@ void OpDispatchBuilder::VMOVLPOp(OpcodeArgs) {
 
 void OpDispatchBuilder::MOVSHDUPOp(OpcodeArgs) {
   OrderedNode *Src = LoadSource(FPRClass, Op, Op->Src[0], Op->Flags, 8);
-  OrderedNode *Result = _VInsElement(16, 4, 2, 3, Src, Src);
-  Result = _VInsElement(16, 4, 0, 1, Result, Src);
+
+  PermuteIndices Indices{};
+  for (size_t i = 0; i < 4; ++i) {
+    SetPermuteElement(Indices, 4, i, i | 1);
+  }
+
+  OrderedNode *Result = VPermuteImpl(16, Src, Src, Indices);
   StoreResult(FPRClass, Op, Result, -1);
 }
 
@@ -185,8 +191,13 @@ void OpDispatchBuilder::VMOVSHDUPOp(OpcodeArgs) {
 
 void OpDispatchBuilder::MOVSLDUPOp(OpcodeArgs) {
   OrderedNode *Src = LoadSource(FPRClass, Op, Op->Src[0], Op->Flags, 8);
-  OrderedNode *Result = _VInsElement(16, 4, 3, 2, Src, Src);
-  Result = _VInsElement(16, 4, 1, 0, Result, Src);
+
+  PermuteIndices Indices{};
+  for (size_t i = 0; i < 4; ++i) {
+    SetPermuteElement(Indices, 4, i, i & ~1);
+  }
+
+  OrderedNode *Result = VPermuteImpl(16, Src, Src, Indices);
   StoreResult(FPRClass, Op, Result, -1);
 }
 
@@ -933,6 +944,31 @@ void OpDispatchBuilder::PUNPCKHOp<4>(OpcodeArgs);
 template
 void OpDispatchBuilder::PUNPCKHOp<8>(OpcodeArgs);
 
+OpDispatchBuilder::PermuteIndices OpDispatchBuilder::IdentityPermute() {
+  PermuteIndices Indices{};
+  for (size_t i = 0; i < Indices.size(); ++i) {
+    Indices[i] = i;
+  }
+  return Indices;
+}
+
+void OpDispatchBuilder::SetPermuteElement(PermuteIndices &Indices, size_t ElementSize, size_t DestElement, size_t SrcElement) {
+  for (size_t i = 0; i < ElementSize; ++i) {
+    Indices[DestElement * ElementSize + i] = SrcElement * ElementSize + i;
+  }
+}
+
+OrderedNode* OpDispatchBuilder::VPermuteImpl(uint8_t Size, OrderedNode *Lower, OrderedNode *Upper, PermuteIndices const &Indices) {
+  uint64_t IndicesLow{};
+  uint64_t IndicesHigh{};
+  for (size_t i = 0; i < 8; ++i) {
+    IndicesLow |= static_cast<uint64_t>(Indices[i]) << (i * 8);
+    IndicesHigh |= static_cast<uint64_t>(Indices[i + 8]) << (i * 8);
+  }
+
+  return _VPermute(Size, Lower, Upper, IndicesLow, IndicesHigh);
+}
+
 void OpDispatchBuilder::PSHUFBOp(OpcodeArgs) {
   auto Size = GetSrcSize(Op);
   OrderedNode *Dest = LoadSource(FPRClass, Op, Op->Dest, Op->Flags, -1);
@@ -977,12 +1013,13 @@ void OpDispatchBuilder::PSHUFDOp(OpcodeArgs) {
 
   uint8_t BaseElement = Low ? 0 : NumElements;
 
-  auto Dest = Src;
+  auto Indices = IdentityPermute();
   for (uint8_t Element = 0; Element < NumElements; ++Element) {
-    Dest = _VInsElement(Size, ElementSize, BaseElement + Element, BaseElement + (Shuffle & 0b11), Dest, Src);
+    SetPermuteElement(Indices, ElementSize, BaseElement + Element, BaseElement + (Shuffle & 0b11));
     Shuffle >>= 2;
   }
 
+  OrderedNode *Dest = VPermuteImpl(Size, Src, Src, Indices);
   StoreResult(FPRClass, Op, Dest, -1);
 }
 
@@ -1006,18 +1043,6 @@ void OpDispatchBuilder::SHUFOp(OpcodeArgs) {
 
   uint8_t NumElements = Size / ElementSize;
 
-  auto Dest = Src1;
-  std::array<OrderedNode*, 4> Srcs = {
-  };
-
-  for (int i = 0; i < (NumElements >> 1); ++i) {
-    Srcs[i] = Src1;
-  }
-
-  for (int i = (NumElements >> 1); i < NumElements; ++i) {
-    Srcs[i] = Src2;
-  }
-
   // 32bit:
   // [31:0]   = Src1[Selection]
   // [63:32]  = Src1[Selection]
@@ -1028,11 +1053,15 @@ void OpDispatchBuilder::SHUFOp(OpcodeArgs) {
   // [127:64] = Src2[Selection]
   uint8_t SelectionMask = NumElements - 1;
   uint8_t ShiftAmount = std::popcount(SelectionMask);
+  PermuteIndices Indices{};
   for (uint8_t Element = 0; Element < NumElements; ++Element) {
-    Dest = _VInsElement(Size, ElementSize, Element, Shuffle & SelectionMask, Dest, Srcs[Element]);
+    // Src2 elements start after the Src1 elements in the table
+    const uint8_t SrcBase = Element < (NumElements >> 1) ? 0 : NumElements;
+    SetPermuteElement(Indices, ElementSize, Element, SrcBase + (Shuffle & SelectionMask));
     Shuffle >>= ShiftAmount;
   }
 
+  OrderedNode *Dest = VPermuteImpl(Size, Src1, Src2, Indices);
   StoreResult(FPRClass, Op, Dest, -1);
 }
 
@@ -1167,6 +1196,8 @@ void OpDispatchBuilder::InsertPSOp(OpcodeArgs) {
     Dest = LoadSource_WithOpSize(FPRClass, Op, Op->Dest, GetDstSize(Op), Op->Flags, -1);
   }
 
+  auto Indices = IdentityPermute();
+  OrderedNode *Upper = Dest;
   if (!(ZMask & (1 << CountD))) {
     // In the case that ZMask overwrites the destination element, then don't even insert
     OrderedNode *Src{};
@@ -1179,20 +1210,21 @@ void OpDispatchBuilder::InsertPSOp(OpcodeArgs) {
       Src = LoadSource_WithOpSize(FPRClass, Op, Op->Src[0], 4, Op->Flags, -1);
     }
 
-    Dest = _VInsElement(GetDstSize(Op), 4, CountD, CountS, Dest, Src);
+    SetPermuteElement(Indices, 4, CountD, 4 + CountS);
+    Upper = Src;
   }
 
   // ZMask happens after insert
   if (ZMask == 0xF) {
     Dest = _VectorImm(16, 4, 0);
   }
-  else if (ZMask) {
-    auto Zero = _VectorImm(16, 4, 0);
+  else {
     for (size_t i = 0; i < 4; ++i) {
       if (ZMask & (1 << i)) {
-        Dest = _VInsElement(GetDstSize(Op), 4, i, 0, Dest, Zero);
+        std::fill_n(&Indices[i * 4], 4, PERMUTE_ZERO);
       }
     }
+    Dest = VPermuteImpl(GetDstSize(Op), Dest, Upper, Indices);
   }
 
   StoreResult(FPRClass, Op, Dest, -1);
@@ -3309,13 +3341,17 @@ void OpDispatchBuilder::VectorBlend(OpcodeArgs) {
 
   OrderedNode *Dest = LoadSource(FPRClass, Op, Op->Dest, Op->Flags, -1);
   OrderedNode *Src = LoadSource(FPRClass, Op, Op->Src[0], Op->Flags, -1);
-  for (size_t i = 0; i < (16 / ElementSize); ++i) {
+
+  constexpr size_t NumElements = 16 / ElementSize;
+  auto Indices = IdentityPermute();
+  for (size_t i = 0; i < NumElements; ++i) {
     if (Select & (1 << i)) {
-      // This could be optimized if it becomes costly
-      Dest = _VInsElement(16, ElementSize, i, i, Dest, Src);
+      SetPermuteElement(Indices, ElementSize, i, NumElements + i);
     }
   }
-  StoreResult(FPRClass, Op, Dest, -1);
+
+  OrderedNode *Result = VPermuteImpl(16, Dest, Src, Indices);
+  StoreResult(FPRClass, Op, Result, -1);
 }
 
 template
@@ -3457,11 +3493,19 @@ void OpDispatchBuilder::DPPOp(OpcodeArgs) {
   // First step is to do an FMUL
   OrderedNode *Temp = _VFMul(16, ElementSize, Dest, Src);
 
+  constexpr size_t NumElements = 16 / ElementSize;
+  constexpr uint8_t AllElements = (1 << NumElements) - 1;
+
   // Now we zero out elements based on src mask
-  for (size_t i = 0; i < (16 / ElementSize); ++i) {
-    if ((SrcMask & (1 << i)) == 0) {
-      Temp = _VInsElement(16, ElementSize, i, 0, Temp, ZeroVec);
+  if ((SrcMask & AllElements) != AllElements) {
+    PermuteIndices Indices{};
+    Indices.fill(PERMUTE_ZERO);
+    for (size_t i = 0; i < NumElements; ++i) {
+      if (SrcMask & (1 << i)) {
+        SetPermuteElement(Indices, ElementSize, i, i);
+      }
     }
+    Temp = VPermuteImpl(16, Temp, Temp, Indices);
   }
 
   // Now we need to do a horizontal add of the elements
@@ -3475,14 +3519,16 @@ void OpDispatchBuilder::DPPOp(OpcodeArgs) {
 
   // Now using the destination mask we choose where the result ends up
   // It can duplicate and zero results
-  auto Result = ZeroVec;
-
-  for (size_t i = 0; i < (16 / ElementSize); ++i) {
+  PermuteIndices Indices{};
+  Indices.fill(PERMUTE_ZERO);
+  for (size_t i = 0; i < NumElements; ++i) {
     if (DstMask & (1 << i)) {
-      Result = _VInsElement(16, ElementSize, i, 0, Result, Temp);
+      SetPermuteElement(Indices, ElementSize, i, 0);
     }
   }
 
+  OrderedNode *Result = VPermuteImpl(16, Temp, Temp, Indices);
+
   StoreResult(FPRClass, Op, Result, -1);
 }
 
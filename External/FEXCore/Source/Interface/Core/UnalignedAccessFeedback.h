@@ -0,0 +1,53 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <set>
+#include <shared_mutex>
+
+namespace FEXCore {
+/**
+ * @brief Guest RIPs of TSO accesses that were backpatched after an unaligned access SIGBUS
+ *
+ * The Arm64 SIGBUS handler rewrites a faulting acquire/release access in to a DMB wrapped plain access.
+ * That only fixes the one copy of the code, so the handler also records the guest RIP in the thread's pending list
+ * and the thread merges it in here on its next block compile.
+ *
+ * The OpcodeDispatcher consults this set and emits the fenced plain access up front for these RIPs,
+ * so recompiles, other threads and (through the AOTIR cache) later processes don't take the SIGBUS again.
+ */
+class UnalignedAccessFeedback final {
+public:
+  void Insert(uint64_t GuestRIP) {
+    std::unique_lock lk(Mutex);
+    RIPs.emplace(GuestRIP);
+    HasRIPs.store(true, std::memory_order_relaxed);
+  }
+
+  bool Contains(uint64_t GuestRIP) const {
+    if (!HasRIPs.load(std::memory_order_relaxed)) {
+      return false;
+    }
+
+    std::shared_lock lk(Mutex);
+    return RIPs.contains(GuestRIP);
+  }
+
+  // Returns true if any recorded RIP is in [Start, Start + Length)
+  bool ContainsRange(uint64_t Start, uint64_t Length) const {
+    if (!HasRIPs.load(std::memory_order_relaxed)) {
+      return false;
+    }
+
+    std::shared_lock lk(Mutex);
+    auto it = RIPs.lower_bound(Start);
+    return it != RIPs.end() && *it < (Start + Length);
+  }
+
+private:
+  mutable std::shared_mutex Mutex;
+  std::set<uint64_t> RIPs;
+  std::atomic<bool> HasRIPs{};
+};
+}
@@ -14,13 +14,19 @@ $end_info$
 namespace FEXCore::X86Tables {
 using namespace InstFlags;
 
-void InitializeXOPTables() {
+namespace {
+struct XOPTables {
+  std::array<X86InstInfo, MAX_XOP_TABLE_SIZE> Ops;
+  std::array<X86InstInfo, MAX_XOP_GROUP_TABLE_SIZE> GroupOps;
+};
+
+consteval XOPTables GenerateXOPTables() {
 #define OPD(group, pp, opcode) ( (group << 10) | (pp << 8) | (opcode))
   constexpr uint16_t XOP_GROUP_8 = 0;
   constexpr uint16_t XOP_GROUP_9 = 1;
   constexpr uint16_t XOP_GROUP_A = 2;
 
-  static constexpr U16U8InfoStruct XOPTable[] = {
+  constexpr U16U8InfoStruct XOPTable[] = {
     // Group 8
     {OPD(XOP_GROUP_8, 0, 0x85), 1, X86InstInfo{"VPMAXSSWW",  TYPE_UNDEC, FLAGS_NONE, 0, nullptr}},
     {OPD(XOP_GROUP_8, 0, 0x86), 1, X86InstInfo{"VPMACSSWD",  TYPE_UNDEC, FLAGS_NONE, 0, nullptr}},
@@ -106,7 +112,7 @@ void InitializeXOPTables() {
 #undef OPD
 
 #define OPD(subgroup, opcode)  (((subgroup - 1) << 3) | (opcode))
-  static constexpr U8U8InfoStruct XOPGroupTable[] = {
+  constexpr U8U8InfoStruct XOPGroupTable[] = {
     // Group 1
     {OPD(1, 1), 1, X86InstInfo{"BLCFILL",     TYPE_UNDEC, FLAGS_NONE, 0, nullptr}},
     {OPD(1, 2), 1, X86InstInfo{"BLSFILL",     TYPE_UNDEC, FLAGS_NONE, 0, nullptr}},
@@ -130,7 +136,15 @@ void InitializeXOPTables() {
   };
 #undef OPD
 
-  GenerateTable(&XOPTableOps.at(0), XOPTable, std::size(XOPTable));
-  GenerateTable(&XOPTableGroupOps.at(0), XOPGroupTable, std::size(XOPGroupTable));
+  XOPTables Tables{};
+  GenerateTable(Tables.Ops.data(), XOPTable, std::size(XOPTable));
+  GenerateTable(Tables.GroupOps.data(), XOPGroupTable, std::size(XOPGroupTable));
+  return Tables;
+}
+
+constexpr XOPTables GeneratedTables = GenerateXOPTables();
 }
+
+constinit std::array<X86InstInfo, MAX_XOP_TABLE_SIZE> XOPTableOps = GeneratedTables.Ops;
+constinit std::array<X86InstInfo, MAX_XOP_GROUP_TABLE_SIZE> XOPTableGroupOps = GeneratedTables.GroupOps;
 }
@@ -5,6 +5,7 @@
 #include <FEXCore/IR/RegisterAllocationData.h>
 #include <FEXCore/Utils/Allocator.h>
 #include <FEXCore/HLE/SyscallHandler.h>
+#include <Interface/Core/DebugMetadataStore.h>
 #include <Interface/Core/LookupCache.h>
 #include <Interface/GDBJIT/GDBJIT.h>
 
@@ -16,6 +17,7 @@
 #include <sys/mman.h>
 #include <sys/stat.h>
 #include <unistd.h>
+#include <vector>
 #include <xxhash.h>
 
 
@@ -59,6 +61,8 @@ namespace FEXCore::IR {
     auto Inserted = Index.emplace(GuestRIP, Stream->tellp());
 
     if (Inserted.second) {
+      GuestRanges.emplace(GuestRIP, std::make_pair(Start, Length));
+
       //GuestHash
       Stream->write((const char*)&Hash, sizeof(Hash));
 
@@ -90,6 +94,7 @@ namespace FEXCore::IR {
     std::string Module;
     uint64_t ModSize;
     uint64_t IndexSize;
+    uint64_t UnalignedCount;
 
     lseek(streamfd, -sizeof(ModSize), SEEK_END);
 
@@ -112,12 +117,30 @@ namespace FEXCore::IR {
     if (!readAll(streamfd,  (char*)&IndexSize, sizeof(IndexSize)))
       return false;
 
+    lseek(streamfd, -sizeof(ModSize) - ModSize - sizeof(IndexSize) - sizeof(UnalignedCount), SEEK_END);
+
+    if (!readAll(streamfd,  (char*)&UnalignedCount, sizeof(UnalignedCount)))
+      return false;
+
     struct stat fileinfo;
     if (fstat(streamfd, &fileinfo) < 0)
       return false;
     size_t Size = (fileinfo.st_size + 4095) & ~4095;
 
-    size_t IndexOffset = fileinfo.st_size - IndexSize -sizeof(ModSize) - ModSize - sizeof(IndexSize);
+    const size_t UnalignedSize = UnalignedCount * sizeof(uint64_t);
+    const size_t TrailerSize = UnalignedSize + sizeof(UnalignedCount) + sizeof(IndexSize) + ModSize + sizeof(ModSize);
+    if (UnalignedCount > static_cast<size_t>(fileinfo.st_size) / sizeof(uint64_t) ||
+        TrailerSize + IndexSize > static_cast<size_t>(fileinfo.st_size)) {
+      return false;
+    }
+
+    std::vector<uint64_t> UnalignedAccesses(UnalignedCount);
+    lseek(streamfd, -static_cast<off_t>(TrailerSize), SEEK_END);
+
+    if (!readAll(streamfd, (char*)UnalignedAccesses.data(), UnalignedSize))
+      return false;
+
+    size_t IndexOffset = fileinfo.st_size - IndexSize - TrailerSize;
 
     void *FilePtr = FEXCore::Allocator::mmap(nullptr, Size, PROT_READ, MAP_SHARED, streamfd, 0);
 
@@ -131,8 +154,9 @@ namespace FEXCore::IR {
     Entry->Array = Array;
     Entry->FilePtr = FilePtr;
     Entry->Size = Size;
+    Entry->UnalignedAccesses.insert(UnalignedAccesses.begin(), UnalignedAccesses.end());
 
-    LogMan::Msg::DFmt("AOTIR: Module {} has {} functions", Module, Array->Count);
+    LogMan::Msg::DFmt("AOTIR: Module {} has {} functions and {} unaligned accesses", Module, Array->Count, UnalignedCount);
 
     return true;
   }
@@ -150,19 +174,46 @@ namespace FEXCore::IR {
       const auto ModSize = String.size();
       auto &stream = Entry.Stream;
 
+      // Unaligned accesses recorded in this run might have been captured as TSO accesses
+      // Leave those functions out of the index so the next run regenerates them with the fenced access
+      std::set<uint64_t> UnalignedAccesses;
+      std::set<uint64_t> const *NewUnalignedAccesses{};
+      if (auto CacheEntry = AOTIRCache.find(String); CacheEntry != AOTIRCache.end()) {
+        UnalignedAccesses = CacheEntry->second.UnalignedAccesses;
+        UnalignedAccesses.insert(CacheEntry->second.NewUnalignedAccesses.begin(), CacheEntry->second.NewUnalignedAccesses.end());
+        NewUnalignedAccesses = &CacheEntry->second.NewUnalignedAccesses;
+      }
+
+      const auto IsStale = [&](uint64_t GuestStart) {
+        if (!NewUnalignedAccesses || NewUnalignedAccesses->empty()) {
+          return false;
+        }
+
+        const auto &[Start, Length] = Entry.GuestRanges[GuestStart];
+        auto it = NewUnalignedAccesses->lower_bound(Start);
+        return it != NewUnalignedAccesses->end() && *it < (Start + Length);
+      };
+
       // pad to 32 bytes
       constexpr char Zero = 0;
       while(stream->tellp() & 31)
         stream->write(&Zero, 1);
 
       // AOTIRInlineIndex
-      const auto FnCount = Entry.Index.size();
+      size_t FnCount{};
+      for (const auto& [GuestStart, DataOffset] : Entry.Index) {
+        FnCount += !IsStale(GuestStart);
+      }
       const size_t DataBase = -stream->tellp();
 
       stream->write((const char*)&FnCount, sizeof(FnCount));
       stream->write((const char*)&DataBase, sizeof(DataBase));
 
       for (const auto& [GuestStart, DataOffset] : Entry.Index) {
+        if (IsStale(GuestStart)) {
+          continue;
+        }
+
         //AOTIRInlineIndexEntry
 
         // GuestStart
@@ -172,6 +223,13 @@ namespace FEXCore::IR {
         stream->write((const char*)&DataOffset, sizeof(DataOffset));
       }
 
+      // Unaligned access offsets
+      const uint64_t UnalignedCount = UnalignedAccesses.size();
+      for (const auto Offset : UnalignedAccesses) {
+        stream->write((const char*)&Offset, sizeof(Offset));
+      }
+      stream->write((const char*)&UnalignedCount, sizeof(UnalignedCount));
+
       // End of file header
       const auto IndexSize = FnCount * sizeof(FEXCore::IR::AOTIRInlineIndexEntry) + sizeof(DataBase) + sizeof(FnCount);
       stream->write((const char*)&IndexSize, sizeof(IndexSize));
@@ -249,6 +307,7 @@ namespace FEXCore::IR {
 
     if (AOTIRCacheEntry.Entry) {
       AOTIRCacheEntry.Entry->ContainsCode = true;
+      ImportUnalignedAccesses(AOTIRCacheEntry.Entry, AOTIRCacheEntry.VAFileStart);
 
       if (IRList == nullptr && CTX->Config.AOTIRLoad()) {
         auto Mod = AOTIRCacheEntry.Entry->Array;
@@ -257,7 +316,10 @@ namespace FEXCore::IR {
         {
           auto AOTEntry = Mod->Find(GuestRIP - AOTIRCacheEntry.VAFileStart);
 
-          if (AOTEntry) {
+          if (AOTEntry && HasNewUnalignedAccess(AOTIRCacheEntry.Entry, GuestRIP - AOTIRCacheEntry.VAFileStart, AOTEntry->GuestLength)) {
+            // Cached IR still has a TSO access that has since been backpatched, regenerate it instead
+          }
+          else if (AOTEntry) {
             // verify hash
             auto MappedStart = GuestRIP;
             auto hash = XXH3_64bits((void*)MappedStart, AOTEntry->GuestLength);
@@ -299,6 +361,14 @@ namespace FEXCore::IR {
 
       auto AOTIRCacheEntry = CTX->SyscallHandler->LookupAOTIRCacheEntry(GuestRIP);
 
+      // Keep the debug metadata before the IR can get handed off to the AOTIR writeout queue
+      if (GeneratedIR && CTX->GetGdbServerStatus()) {
+        std::lock_guard<std::recursive_mutex> lk(Thread->LookupCache->WriteLock);
+        Thread->DebugStore->Insert(GuestRIP, StartAddr, Length, DebugData, IRList);
+      }
+
+      bool IRListTransferred = false;
+
       if (AOTIRCacheEntry.Entry) {
         if (DebugData && CTX->Config.LibraryJITNaming()) {
           CTX->Symbols.RegisterNamedRegion(CodePtr, DebugData->HostCodeSize, AOTIRCacheEntry.Entry->Filename);
@@ -317,13 +387,15 @@ namespace FEXCore::IR {
           auto LocalRIP = GuestRIP - AOTIRCacheEntry.VAFileStart;
           auto LocalStartAddr = StartAddr - AOTIRCacheEntry.VAFileStart;
           auto FileId = AOTIRCacheEntry.Entry->FileId;
+          // Nothing else needs the IR or RA data past this point, so they are handed to the writeout queue rather than copied.
+          // IR loaded from an AOTIR file points in to the mapping and still needs a copy.
           // The underlying pointer and the unique_ptr deleter for RAData must
           // be marshalled separately to the lambda below. Otherwise, the
           // lambda can't be used as an std::function due to being non-copyable
-          auto RADataCopy = RAData->CreateCopy();
-          auto RADataCopyDeleter = RADataCopy.get_deleter();
-          auto IRListCopy = IRList->CreateCopy();
-          AOTIRCaptureCacheWriteoutQueue_Append([this, LocalRIP, LocalStartAddr, Length, hash, IRListCopy, RADataCopy=RADataCopy.release(), RADataCopyDeleter, FileId]() {
+          auto RADataDeleter = RAData.get_deleter();
+          auto IRListOwned = IRList->IsCopy() ? IRList : IRList->CreateCopy();
+          IRListTransferred = true;
+          AOTIRCaptureCacheWriteoutQueue_Append([this, LocalRIP, LocalStartAddr, Length, hash, IRListOwned, RAData=RAData.release(), RADataDeleter, FileId]() {
 
             // It is guaranteed via AOTIRCaptureCacheWriteoutLock and AOTIRCaptureCacheWriteoutFlusing that this will not run concurrently
             // Memory coherency is guaranteed via AOTIRCaptureCacheWriteoutLock
@@ -335,33 +407,24 @@ namespace FEXCore::IR {
               uint64_t tag = FEXCore::IR::AOTIR_COOKIE;
               AotFile->Stream->write((char*)&tag, sizeof(tag));
             }
-            AotFile->AppendAOTIRCaptureCache(LocalRIP, LocalStartAddr, Length, hash, IRListCopy, RADataCopy);
-            RADataCopyDeleter(RADataCopy);
-            delete IRListCopy;
+            AotFile->AppendAOTIRCaptureCache(LocalRIP, LocalStartAddr, Length, hash, IRListOwned, RAData);
+            RADataDeleter(RAData);
+            delete IRListOwned;
           });
 
           if (CTX->Config.AOTIRGenerate()) {
             // cleanup memory and early exit here -- we're not running the application
+            delete DebugData;
             Thread->CPUBackend->ClearCache();
             return true;
           }
         }
       }
 
-      // Insert to caches if we generated IR
+      // The DebugStore keeps its own compact copy, so neither needs to be retained
       if (GeneratedIR) {
-        if (CTX->GetGdbServerStatus()) {
-          // Add to thread local ir cache
-          Core::LocalIREntry Entry = {StartAddr, Length, decltype(Entry.IR)(IRList), std::move(RAData), decltype(Entry.DebugData)(DebugData)};
-          
-          std::lock_guard<std::recursive_mutex> lk(Thread->LookupCache->WriteLock);
-          Thread->DebugStore.insert({GuestRIP, std::move(Entry)});
-        }
-        else {
-          // If the IR doesn't need to be retained then we can just delete it now
-          delete DebugData;
-          if (IRList->IsCopy()) delete IRList;
-        }
+        delete DebugData;
+        if (!IRListTransferred && IRList->IsCopy()) delete IRList;
       }
     }
 
@@ -381,6 +444,7 @@ namespace FEXCore::IR {
       fileid += CTX->Config.TSOEnabled ? "T" : "t";
       fileid += CTX->Config.ABILocalFlags ? "L" : "l";
       fileid += CTX->Config.ABINoPF ? "p" : "P";
+      fileid += CTX->Config.SafepointPolling ? "Q" : "q";
 
       std::unique_lock lk(AOTIRCacheLock);
 
@@ -402,6 +466,44 @@ namespace FEXCore::IR {
     return nullptr;
   }
 
+  void AOTIRCaptureCache::RecordUnalignedAccess(uint64_t GuestRIP) {
+    auto AOTIRCacheEntry = CTX->SyscallHandler->LookupAOTIRCacheEntry(GuestRIP);
+
+    if (AOTIRCacheEntry.Entry) {
+      std::unique_lock lk(AOTIRCacheLock);
+      const auto Offset = GuestRIP - AOTIRCacheEntry.VAFileStart;
+      if (!AOTIRCacheEntry.Entry->UnalignedAccesses.contains(Offset)) {
+        AOTIRCacheEntry.Entry->NewUnalignedAccesses.emplace(Offset);
+      }
+    }
+  }
+
+  void AOTIRCaptureCache::ImportUnalignedAccesses(AOTIRCacheEntry *Entry, uint64_t VAFileStart) {
+    {
+      std::shared_lock lk(AOTIRCacheLock);
+      if (Entry->UnalignedAccessesImported) {
+        return;
+      }
+    }
+
+    std::unique_lock lk(AOTIRCacheLock);
+    if (Entry->UnalignedAccessesImported) {
+      return;
+    }
+
+    for (const auto Offset : Entry->UnalignedAccesses) {
+      CTX->UnalignedAccesses.Insert(VAFileStart + Offset);
+    }
+
+    Entry->UnalignedAccessesImported = true;
+  }
+
+  bool AOTIRCaptureCache::HasNewUnalignedAccess(AOTIRCacheEntry *Entry, uint64_t Start, uint64_t Length) {
+    std::shared_lock lk(AOTIRCacheLock);
+    auto it = Entry->NewUnalignedAccesses.lower_bound(Start);
+    return it != Entry->NewUnalignedAccesses.end() && *it < (Start + Length);
+  }
+
   void AOTIRCaptureCache::UnloadAOTIRCacheEntry(AOTIRCacheEntry *Entry) {
     LOGMAN_THROW_AA_FMT(Entry != nullptr, "Removing not existing entry");
 
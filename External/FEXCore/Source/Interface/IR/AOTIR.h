@@ -9,6 +9,7 @@
 #include <fstream>
 #include <memory>
 #include <map>
+#include <set>
 #include <unordered_map>
 #include <shared_mutex>
 #include <queue>
@@ -37,7 +38,7 @@ namespace FEXCore::IR {
 
     return Cookie;
   };
-  constexpr static uint32_t AOTIR_VERSION = 0x0000'00004;
+  constexpr static uint32_t AOTIR_VERSION = 0x0000'00007;
   constexpr static uint64_t AOTIR_COOKIE = COOKIE_VERSION("FEXI", AOTIR_VERSION);
 
   struct AOTIRInlineEntry {
@@ -68,6 +69,8 @@ namespace FEXCore::IR {
   struct AOTIRCaptureCacheEntry {
     std::unique_ptr<std::ofstream> Stream;
     std::map<uint64_t, uint64_t> Index;
+    // Guest Start and Length of each entry in Index
+    std::map<uint64_t, std::pair<uint64_t, uint64_t>> GuestRanges;
 
     void AppendAOTIRCaptureCache(uint64_t GuestRIP, uint64_t Start, uint64_t Length, uint64_t Hash, FEXCore::IR::IRListView *IRList, FEXCore::IR::RegisterAllocationData *RAData);
   };
@@ -80,6 +83,12 @@ namespace FEXCore::IR {
     std::string FileId;
     std::string Filename;
     bool ContainsCode;
+
+    // File offsets of TSO accesses that needed an unaligned access backpatch
+    // UnalignedAccesses is loaded from the cache and already reflected in its IR, NewUnalignedAccesses were recorded in this run
+    std::set<uint64_t> UnalignedAccesses;
+    std::set<uint64_t> NewUnalignedAccesses;
+    bool UnalignedAccessesImported;
   };
 
   using AOTCacheType = std::unordered_map<std::string, FEXCore::IR::AOTIRCacheEntry>;
@@ -117,6 +126,9 @@ namespace FEXCore::IR {
       AOTIRCacheEntry *LoadAOTIRCacheEntry(const std::string &filename);
       void UnloadAOTIRCacheEntry(AOTIRCacheEntry *Entry);
 
+      // Records a backpatched unaligned access against the file it belongs to, so FinalizeAOTIRCache persists it
+      void RecordUnalignedAccess(uint64_t GuestRIP);
+
       // Callbacks
       void SetAOTIRLoader(std::function<int(const std::string&)> CacheReader) {
         AOTIRLoader = CacheReader;
@@ -131,6 +143,9 @@ namespace FEXCore::IR {
       }
 
     private:
+      void ImportUnalignedAccesses(AOTIRCacheEntry *Entry, uint64_t VAFileStart);
+      bool HasNewUnalignedAccess(AOTIRCacheEntry *Entry, uint64_t Start, uint64_t Length);
+
       FEXCore::Context::Context *CTX;
 
       std::shared_mutex AOTIRCacheLock;
@@ -12,8 +12,11 @@ $end_info$
 #include "Interface/IR/Passes/RegisterAllocationPass.h"
 
 #include <FEXCore/Config/Config.h>
+#include <FEXCore/Debug/InternalThreadState.h>
 #include <FEXCore/Utils/Profiler.h>
 
+#include <chrono>
+
 namespace FEXCore::IR {
 class IREmitter;
 
@@ -21,27 +24,27 @@ void PassManager::AddDefaultPasses(FEXCore::Context::Context *ctx, bool InlineCo
   FEX_CONFIG_OPT(DisablePasses, O0);
 
   if (!DisablePasses()) {
-    InsertPass(CreateContextLoadStoreElimination(ctx->HostFeatures.SupportsAVX));
+    InsertPass(CreateContextLoadStoreElimination(ctx->HostFeatures.SupportsAVX), "RCLSE");
 
     if (Is64BitMode()) {
       // This needs to run after RCLSE
       // This only matters for 64-bit code since these instructions don't exist in 32-bit
-      InsertPass(CreateLongDivideEliminationPass());
+      InsertPass(CreateLongDivideEliminationPass(), "LDE");
     }
 
-    InsertPass(CreateDeadStoreElimination(ctx->HostFeatures.SupportsAVX));
-    InsertPass(CreatePassDeadCodeElimination());
-    InsertPass(CreateConstProp(InlineConstants, ctx->HostFeatures.SupportsTSOImm9));
+    InsertPass(CreateDeadStoreElimination(ctx->HostFeatures.SupportsAVX), "DSE");
+    InsertPass(CreatePassDeadCodeElimination(), "DCE");
+    InsertPass(CreateConstProp(InlineConstants, ctx->HostFeatures.SupportsTSOImm9, &ctx->CPUID), "ConstProp");
 
     ////// InsertPass(CreateDeadFlagCalculationEliminination());
 
-    InsertPass(CreateSyscallOptimization());
-    InsertPass(CreatePassDeadCodeElimination());
+    InsertPass(CreateSyscallOptimization(), "SyscallOpt");
+    InsertPass(CreatePassDeadCodeElimination(), "DCE2");
   }
 
   // If the IR is compacted post-RA then the node indexing gets messed up and the backend isn't able to find the register assigned to a node
   // Compact before IR, don't worry about RA generating spills/fills
-  InsertPass(CreateIRCompaction(ctx->OpDispatcherAllocator), "Compaction");
+  InsertPass(CreateIRCompaction(), "Compaction");
 }
 
 void PassManager::AddDefaultValidationPasses() {
@@ -57,12 +60,28 @@ void PassManager::InsertRegisterAllocationPass(bool OptimizeSRA, bool SupportsAV
   InsertPass(IR::CreateRegisterAllocationPass(GetPass("Compaction"), OptimizeSRA, SupportsAVX), "RA");
 }
 
-bool PassManager::Run(IREmitter *IREmit) {
+bool PassManager::Run(IREmitter *IREmit, FEXCore::Core::CompileTimingStats *Stats) {
   FEXCORE_PROFILE_SCOPED("PassManager::Run");
 
   bool Changed = false;
-  for (auto const &Pass : Passes) {
-    Changed |= Pass->Run(IREmit);
+  if (Stats) {
+    if (Stats->Passes.size() != Passes.size()) {
+      Stats->Passes.resize(Passes.size());
+      for (size_t i = 0; i < Passes.size(); ++i) {
+        Stats->Passes[i].Name = PassNames[i];
+      }
+    }
+
+    for (size_t i = 0; i < Passes.size(); ++i) {
+      const auto PassStart = std::chrono::steady_clock::now();
+      Changed |= Passes[i]->Run(IREmit);
+      Stats->Passes[i].TimeNS += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - PassStart).count();
+    }
+  }
+  else {
+    for (auto const &Pass : Passes) {
+      Changed |= Pass->Run(IREmit);
+    }
   }
 
 #if defined(ASSERTIONS_ENABLED) && ASSERTIONS_ENABLED
@@ -14,6 +14,10 @@ $end_info$
 #include <utility>
 #include <vector>
 
+namespace FEXCore::Core {
+struct CompileTimingStats;
+}
+
 namespace FEXCore::HLE {
 class SyscallHandler;
 }
@@ -49,12 +53,14 @@ public:
     if (!Name.empty()) {
       NameToPassMaping[Name] = PassPtr;
     }
+    PassNames.emplace_back(std::move(Name));
     return PassPtr;
   }
 
   void InsertRegisterAllocationPass(bool OptimizeSRA, bool SupportsAVX);
 
-  bool Run(IREmitter *IREmit);
+  // Stats is optional, each pass gets timed when it is provided
+  bool Run(IREmitter *IREmit, FEXCore::Core::CompileTimingStats *Stats = nullptr);
 
   void RegisterExitHandler(ShouldExitHandler Handler) {
     ExitHandler = std::move(Handler);
@@ -83,6 +89,8 @@ protected:
 
 private:
   std::vector<std::unique_ptr<Pass>> Passes;
+  // Matches Passes, only used for reporting so names don't need to be unique
+  std::vector<std::string> PassNames;
   std::unordered_map<std::string, Pass*> NameToPassMaping;
 
 #if defined(ASSERTIONS_ENABLED) && ASSERTIONS_ENABLED
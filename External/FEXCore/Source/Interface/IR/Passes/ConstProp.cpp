@@ -14,6 +14,7 @@ $end_info$
 #include "aarch64/assembler-aarch64.h"
 #endif
 
+#include "Interface/Core/CPUID.h"
 #include "Interface/IR/PassManager.h"
 
 #include <FEXCore/IR/IR.h>
@@ -26,6 +27,7 @@ $end_info$
 #include <cstdint>
 #include <map>
 #include <memory>
+#include <optional>
 #include <string.h>
 #include <tuple>
 #include <unordered_map>
@@ -177,9 +179,10 @@ static bool IsBfeAlreadyDone(IREmitter *IREmit, OrderedNodeWrapper src, uint64_t
 
 class ConstProp final : public FEXCore::IR::Pass {
 public:
-  explicit ConstProp(bool DoInlineConstants, bool SupportsTSOImm9)
+  explicit ConstProp(bool DoInlineConstants, bool SupportsTSOImm9, FEXCore::CPUIDEmu const *CPUID)
     : InlineConstants(DoInlineConstants)
-    , SupportsTSOImm9 {SupportsTSOImm9} { }
+    , SupportsTSOImm9 {SupportsTSOImm9}
+    , CPUID {CPUID} { }
 
   bool Run(IREmitter *IREmit) override;
 
@@ -199,6 +202,7 @@ private:
   std::unordered_map<uint64_t, OrderedNode*> ConstPool;
   std::map<OrderedNode*, uint64_t> AddressgenConsts;
   bool SupportsTSOImm9{};
+  FEXCore::CPUIDEmu const *CPUID;
 };
 
 bool ConstProp::HandleConstantPools(IREmitter *IREmit, const IRListView& CurrentIR) {
@@ -786,6 +790,39 @@ bool ConstProp::ConstantPropagation(IREmitter *IREmit, const IRListView& Current
       break;
     }
 
+    case OP_EXTRACTELEMENTPAIR: {
+      auto Op = IROp->C<IR::IROp_ExtractElementPair>();
+      auto PairOp = IREmit->GetOpHeader(Op->Pair);
+
+      // CPUID results that don't vary per CPU are folded once the function is known
+      if (PairOp->Op == OP_CPUID) {
+        auto CPUIDOp = PairOp->C<IR::IROp_CPUID>();
+
+        uint64_t Function{};
+        uint64_t Leaf{};
+        if (!IREmit->IsValueConstant(CPUIDOp->Function, &Function)) {
+          break;
+        }
+
+        std::optional<uint32_t> ConstantLeaf{};
+        if (IREmit->IsValueConstant(CPUIDOp->Leaf, &Leaf)) {
+          ConstantLeaf = Leaf;
+        }
+
+        FEXCore::CPUID::FunctionResults Results{};
+        if (CPUID->GetConstantResult(Function, ConstantLeaf, &Results)) {
+          // Matches the register pair layout the CPUID op returns
+          uint64_t Elements[2];
+          static_assert(sizeof(Elements) == sizeof(Results));
+          memcpy(Elements, &Results, sizeof(Elements));
+
+          IREmit->ReplaceWithConstant(CodeNode, Elements[Op->Element]);
+          Changed = true;
+        }
+      }
+      break;
+    }
+
     case OP_CONDJUMP: {
       auto Op = IROp->CW<IR::IROp_CondJump>();
 
@@ -1060,8 +1097,8 @@ bool ConstProp::Run(IREmitter *IREmit) {
   return Changed;
 }
 
-std::unique_ptr<FEXCore::IR::Pass> CreateConstProp(bool InlineConstants, bool SupportsTSOImm9) {
-  return std::make_unique<ConstProp>(InlineConstants, SupportsTSOImm9);
+std::unique_ptr<FEXCore::IR::Pass> CreateConstProp(bool InlineConstants, bool SupportsTSOImm9, FEXCore::CPUIDEmu const *CPUID) {
+  return std::make_unique<ConstProp>(InlineConstants, SupportsTSOImm9, CPUID);
 }
 
 }
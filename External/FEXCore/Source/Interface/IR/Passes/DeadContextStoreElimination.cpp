@@ -8,6 +8,7 @@ $end_info$
 #include "Interface/IR/Passes.h"
 #include "Interface/IR/PassManager.h"
 #include <FEXCore/Core/CoreState.h>
+#include <FEXCore/Core/X86Enums.h>
 
 #include <FEXCore/IR/IR.h>
 #include <FEXCore/IR/IREmitter.h>
@@ -16,6 +17,7 @@ $end_info$
 #include <FEXCore/Utils/Profiler.h>
 
 #include <array>
+#include <bitset>
 #include <memory>
 #include <stddef.h>
 #include <stdint.h>
@@ -70,8 +72,18 @@ namespace {
     uint8_t AccessSize;
     FEXCore::IR::OrderedNode *Node;
     FEXCore::IR::OrderedNode *StoreNode;
+    // StoreNode is in the block being walked and can be removed once overwritten
+    // Stores forwarded from a predecessor might still be read on another path
+    bool LocalStore;
   };
 
+  // Flags that share the packed NZCV member
+  constexpr uint32_t NZCVFlagMask =
+    (1U << FEXCore::X86State::RFLAG_CF_LOC) |
+    (1U << FEXCore::X86State::RFLAG_ZF_LOC) |
+    (1U << FEXCore::X86State::RFLAG_SF_LOC) |
+    (1U << FEXCore::X86State::RFLAG_OF_LOC);
+
   struct ContextInfo {
     std::vector<ContextMemberInfo*> Lookup;
     std::vector<ContextMemberInfo> ClassificationInfo;
@@ -260,14 +272,20 @@ namespace {
     }
 
     for (size_t i = 0; i < FEXCore::Core::CPUState::NUM_FLAGS; ++i) {
+      // CF/ZF/SF/OF are packed in to one 32-bit member
+      const bool IsNZCV = i == FEXCore::X86State::RFLAG_NZCV_LOC;
       ContextClassification->emplace_back(ContextMemberInfo{
         ContextMemberClassification {
           offsetof(FEXCore::Core::CPUState, flags[0]) + sizeof(FEXCore::Core::CPUState::flags[0]) * i,
-          FEXCore::Core::CPUState::FLAG_SIZE,
+          IsNZCV ? FEXCore::Core::CPUState::NZCV_SIZE : FEXCore::Core::CPUState::FLAG_SIZE,
         },
         ACCESS_NONE,
         FEXCore::IR::InvalidClass,
       });
+
+      if (IsNZCV) {
+        i += FEXCore::Core::CPUState::NZCV_SIZE - 1;
+      }
     }
 
     for (size_t i = 0; i < FEXCore::Core::CPUState::NUM_MMS; ++i) {
@@ -341,6 +359,7 @@ namespace {
       ContextClassification->at(Offset).AccessRegClass = FEXCore::IR::InvalidClass;
       ContextClassification->at(Offset).AccessOffset = 0;
       ContextClassification->at(Offset).StoreNode = nullptr;
+      ContextClassification->at(Offset).LocalStore = false;
     };
     size_t Offset = 0;
     SetAccess(Offset++, ACCESS_NONE);
@@ -394,17 +413,30 @@ namespace {
     SetAccess(Offset++, ACCESS_NONE);
   }
 
+  // One bit per member of ContextInfo::ClassificationInfo
+  using ContextMemberSet = std::bitset<256>;
+
   struct BlockInfo {
     std::vector<FEXCore::IR::OrderedNode *> Predecessors;
     std::vector<FEXCore::IR::OrderedNode *> Successors;
-    ContextInfo IncomingClassifiedStruct;
-    ContextInfo OutgoingClassifiedStruct;
+
+    // Accesses tracked at the end of the block, empty until the block was walked
+    std::vector<ContextMemberInfo> OutgoingAccesses;
+
+    // Members read before being fully written in the block
+    ContextMemberSet Uses;
+    // Members fully written before being read in the block
+    ContextMemberSet Kills;
+    // Members whose value might still be read once the block is entered or left
+    ContextMemberSet LiveIn;
+    ContextMemberSet LiveOut;
   };
 
 class RCLSE final : public FEXCore::IR::Pass {
 public:
   explicit RCLSE(bool SupportsAVX_) : SupportsAVX{SupportsAVX_} {
     ClassifyContextStruct(&ClassifiedStruct, SupportsAVX);
+    LOGMAN_THROW_A_FMT(ClassifiedStruct.ClassificationInfo.size() <= ContextMemberSet().size(), "Too many context members for ContextMemberSet");
     DCE = FEXCore::IR::CreatePassDeadCodeElimination();
   }
   bool Run(FEXCore::IR::IREmitter *IREmit) override;
@@ -420,9 +452,17 @@ private:
   ContextMemberInfo *RecordAccess(ContextMemberInfo *Info, FEXCore::IR::RegisterClassType RegClass, uint32_t Offset, uint8_t Size, LastAccessType AccessType, FEXCore::IR::OrderedNode *Node, FEXCore::IR::OrderedNode *StoreNode = nullptr);
   ContextMemberInfo *RecordAccess(ContextInfo *ClassifiedInfo, FEXCore::IR::RegisterClassType RegClass, uint32_t Offset, uint8_t Size, LastAccessType AccessType, FEXCore::IR::OrderedNode *Node, FEXCore::IR::OrderedNode *StoreNode = nullptr);
   void CalculateControlFlowInfo(FEXCore::IR::IREmitter *IREmit);
+  bool InvalidateFlagStore(FEXCore::IR::IREmitter *IREmit, ContextInfo *LocalInfo, FEXCore::IR::OrderedNode *CodeNode, uint32_t Flag, uint8_t Size);
 
-  // Block local Passes
+  size_t MemberIndex(uint32_t Offset, uint8_t Size) {
+    return FindMemberInfo(&ClassifiedStruct, Offset, Size) - ClassifiedStruct.ClassificationInfo.data();
+  }
+  ContextMemberSet TransferLiveness(FEXCore::IR::IREmitter *IREmit, FEXCore::IR::OrderedNode *BlockNode, ContextMemberSet Live, bool RemoveDeadStores, bool *Changed);
+
+  // Forwards values from single predecessors, otherwise block local
   bool RedundantStoreLoadElimination(FEXCore::IR::IREmitter *IREmit);
+  // Liveness of each context member over the CFG
+  bool DeadStoreElimination(FEXCore::IR::IREmitter *IREmit);
 };
 
 ContextMemberInfo *RCLSE::FindMemberInfo(ContextInfo *ContextClassificationInfo, uint32_t Offset, uint8_t Size) {
@@ -446,8 +486,10 @@ ContextMemberInfo *RCLSE::RecordAccess(ContextMemberInfo *Info, FEXCore::IR::Reg
   Info->AccessOffset = Offset;
   Info->AccessSize = Size;
   Info->Node = Node;
-  if (StoreNode != nullptr)
+  if (StoreNode != nullptr) {
     Info->StoreNode = StoreNode;
+    Info->LocalStore = true;
+  }
   return Info;
 }
 
@@ -456,6 +498,22 @@ ContextMemberInfo *RCLSE::RecordAccess(ContextInfo *ClassifiedInfo, FEXCore::IR:
   return RecordAccess(Info, RegClass, Offset, Size, AccessType, Node, StoreNode);
 }
 
+bool RCLSE::InvalidateFlagStore(FEXCore::IR::IREmitter *IREmit, ContextInfo *LocalInfo, FEXCore::IR::OrderedNode *CodeNode, uint32_t Flag, uint8_t Size) {
+  const uint32_t Offset = offsetof(FEXCore::Core::CPUState, flags[0]) + Flag;
+  auto Info = FindMemberInfo(LocalInfo, Offset, Size);
+  auto LastStoreNode = Info->StoreNode;
+
+  // Flags don't alias, so we can take the simple route here. Kill any flags that have been invalidated without a read.
+  if (LastStoreNode != nullptr && Info->LocalStore) {
+    IREmit->SetWriteCursor(CodeNode);
+    RecordAccess(LocalInfo, FEXCore::IR::GPRClass, Offset, Size, ACCESS_WRITE, IREmit->_Constant(0), CodeNode);
+
+    IREmit->Remove(LastStoreNode);
+    return true;
+  }
+  return false;
+}
+
 void RCLSE::CalculateControlFlowInfo(FEXCore::IR::IREmitter *IREmit) {
   using namespace FEXCore;
   using namespace FEXCore::IR;
@@ -547,16 +605,29 @@ bool RCLSE::RedundantStoreLoadElimination(FEXCore::IR::IREmitter *IREmit) {
   auto CurrentIR = IREmit->ViewIR();
   auto OriginalWriteCursor = IREmit->GetWriteCursor();
 
-  // XXX: Walk the list and calculate the control flow
-
   ContextInfo &LocalInfo = ClassifiedStruct;
 
+  for (auto &[ID, Block] : OffsetToBlockMap) {
+    Block.OutgoingAccesses.clear();
+  }
+
   for (auto [BlockNode, BlockHeader] : CurrentIR.GetBlocks()) {
     auto BlockOp = BlockHeader->CW<FEXCore::IR::IROp_CodeBlock>();
     auto BlockEnd = IREmit->GetIterator(BlockOp->Last);
+    auto &Block = OffsetToBlockMap[CurrentIR.GetID(BlockNode)];
 
     ResetClassificationAccesses(&LocalInfo, SupportsAVX);
 
+    // A single predecessor dominates the block, so whatever it had tracked at its end is available here
+    if (Block.Predecessors.size() == 1) {
+      auto &Predecessor = OffsetToBlockMap[CurrentIR.GetID(Block.Predecessors[0])];
+
+      for (size_t i = 0; i < Predecessor.OutgoingAccesses.size(); ++i) {
+        LocalInfo.ClassificationInfo[i] = Predecessor.OutgoingAccesses[i];
+        LocalInfo.ClassificationInfo[i].LocalStore = false;
+      }
+    }
+
     for (auto [CodeNode, IROp] : CurrentIR.GetCode(BlockNode)) {
       if (IROp->Op == OP_STORECONTEXT) {
         auto Op = IROp->CW<IR::IROp_StoreContext>();
@@ -566,9 +637,11 @@ bool RCLSE::RedundantStoreLoadElimination(FEXCore::IR::IREmitter *IREmit) {
         uint8_t LastSize = Info->AccessSize;
         LastAccessType LastAccess = Info->Accessed;
         OrderedNode *LastStoreNode = Info->StoreNode;
+        bool LastLocalStore = Info->LocalStore;
         RecordAccess(Info, Op->Class, Op->Offset, IROp->Size, ACCESS_WRITE, CurrentIR.GetNode(Op->Value), CodeNode);
 
         if (IsWriteAccess(LastAccess) &&
+            LastLocalStore &&
             LastClass == Op->Class &&
             LastOffset == Op->Offset &&
             LastSize <= IROp->Size) {
@@ -682,10 +755,11 @@ bool RCLSE::RedundantStoreLoadElimination(FEXCore::IR::IREmitter *IREmit) {
         auto Op = IROp->CW<IR::IROp_StoreFlag>();
         auto Info = FindMemberInfo(&LocalInfo, offsetof(FEXCore::Core::CPUState, flags[0]) + Op->Flag, 1);
         auto LastStoreNode = Info->StoreNode;
+        auto LastLocalStore = Info->LocalStore;
         RecordAccess(&LocalInfo, FEXCore::IR::GPRClass, offsetof(FEXCore::Core::CPUState, flags[0]) + Op->Flag, 1, ACCESS_WRITE, CurrentIR.GetNode(Op->Header.Args[0]), CodeNode);
 
         // Flags don't alias, so we can take the simple route here. Kill any flags that have been overwritten
-        if (LastStoreNode != nullptr)
+        if (LastStoreNode != nullptr && LastLocalStore)
         {
           IREmit->Remove(LastStoreNode);
           Changed = true;
@@ -700,18 +774,17 @@ bool RCLSE::RedundantStoreLoadElimination(FEXCore::IR::IREmitter *IREmit) {
             continue;
           }
 
-          auto Info = FindMemberInfo(&LocalInfo, offsetof(FEXCore::Core::CPUState, flags[0]) + F, 1);
-          auto LastStoreNode = Info->StoreNode;
+          if (F >= X86State::RFLAG_NZCV_LOC && F < X86State::RFLAG_NZCV_LOC + Core::CPUState::NZCV_SIZE) {
+            // The packed flags are handled below
+            continue;
+          }
 
-          // Flags don't alias, so we can take the simple route here. Kill any flags that have been invalidated without a read.
-          if (LastStoreNode != nullptr)
-          {
-            IREmit->SetWriteCursor(CodeNode);
-            RecordAccess(&LocalInfo, FEXCore::IR::GPRClass, offsetof(FEXCore::Core::CPUState, flags[0]) + F, 1, ACCESS_WRITE, IREmit->_Constant(0), CodeNode);
+          Changed |= InvalidateFlagStore(IREmit, &LocalInfo, CodeNode, F, 1);
+        }
 
-            IREmit->Remove(LastStoreNode);
-            Changed = true;
-          }
+        // The packed flags can only be dropped once all of them are invalid
+        if ((Op->Flags & NZCVFlagMask) == NZCVFlagMask) {
+          Changed |= InvalidateFlagStore(IREmit, &LocalInfo, CodeNode, X86State::RFLAG_NZCV_LOC, Core::CPUState::NZCV_SIZE);
         }
       }
       else if (IROp->Op == OP_LOADFLAG) {
@@ -752,11 +825,14 @@ bool RCLSE::RedundantStoreLoadElimination(FEXCore::IR::IREmitter *IREmit) {
       }
       else if (IROp->Op == OP_STORECONTEXTINDEXED ||
                IROp->Op == OP_LOADCONTEXTINDEXED ||
-               IROp->Op == OP_BREAK) {
+               IROp->Op == OP_BREAK ||
+               IROp->Op == OP_SAFEPOINT) {
         // We can't track through these
         ResetClassificationAccesses(&LocalInfo, SupportsAVX);
       }
     }
+
+    Block.OutgoingAccesses = LocalInfo.ClassificationInfo;
   }
 
   IREmit->SetWriteCursor(OriginalWriteCursor);
@@ -764,10 +840,164 @@ bool RCLSE::RedundantStoreLoadElimination(FEXCore::IR::IREmitter *IREmit) {
   return Changed;
 }
 
+/**
+ * @brief Walks a block backwards, turning the members live at its end in to the members live at its start
+ *
+ * With RemoveDeadStores, context and flag stores to members that aren't live get removed on the way.
+ * Partial writes keep the rest of the member live, so only full writes end liveness.
+ */
+ContextMemberSet RCLSE::TransferLiveness(FEXCore::IR::IREmitter *IREmit, FEXCore::IR::OrderedNode *BlockNode, ContextMemberSet Live, bool RemoveDeadStores, bool *Changed) {
+  using namespace FEXCore;
+  using namespace FEXCore::IR;
+
+  auto CurrentIR = IREmit->ViewIR();
+
+  std::vector<std::pair<OrderedNode*, IROp_Header const*>> Code;
+  for (auto [CodeNode, IROp] : CurrentIR.GetCode(BlockNode)) {
+    Code.emplace_back(CodeNode, IROp);
+  }
+
+  auto Store = [&](OrderedNode *CodeNode, size_t Member, bool FullWrite) {
+    if (!Live[Member]) {
+      if (RemoveDeadStores) {
+        IREmit->Remove(CodeNode);
+        *Changed = true;
+      }
+    }
+    else if (FullWrite) {
+      Live.reset(Member);
+    }
+  };
+
+  for (auto it = Code.rbegin(); it != Code.rend(); ++it) {
+    auto [CodeNode, IROp] = *it;
+
+    switch (IROp->Op) {
+      case OP_STORECONTEXT: {
+        auto Op = IROp->C<IR::IROp_StoreContext>();
+        auto Info = FindMemberInfo(&ClassifiedStruct, Op->Offset, IROp->Size);
+        Store(CodeNode, MemberIndex(Op->Offset, IROp->Size), Op->Offset == Info->Class.Offset && IROp->Size >= Info->Class.Size);
+        break;
+      }
+      case OP_STOREFLAG: {
+        auto Op = IROp->C<IR::IROp_StoreFlag>();
+        Store(CodeNode, MemberIndex(offsetof(FEXCore::Core::CPUState, flags[0]) + Op->Flag, 1), true);
+        break;
+      }
+      case OP_INVALIDATEFLAGS: {
+        auto Op = IROp->C<IR::IROp_InvalidateFlags>();
+        // Nothing may depend on an invalidated value
+        for (size_t F = 0; F < Core::CPUState::NUM_EFLAG_BITS; F++) {
+          if (F >= X86State::RFLAG_NZCV_LOC && F < X86State::RFLAG_NZCV_LOC + Core::CPUState::NZCV_SIZE) {
+            continue;
+          }
+          if (Op->Flags & (1ULL << F)) {
+            Live.reset(MemberIndex(offsetof(FEXCore::Core::CPUState, flags[0]) + F, 1));
+          }
+        }
+
+        if ((Op->Flags & NZCVFlagMask) == NZCVFlagMask) {
+          Live.reset(MemberIndex(offsetof(FEXCore::Core::CPUState, flags[0]) + X86State::RFLAG_NZCV_LOC, Core::CPUState::NZCV_SIZE));
+        }
+        break;
+      }
+      case OP_LOADCONTEXT: {
+        auto Op = IROp->C<IR::IROp_LoadContext>();
+        Live.set(MemberIndex(Op->Offset, IROp->Size));
+        break;
+      }
+      case OP_LOADFLAG: {
+        auto Op = IROp->C<IR::IROp_LoadFlag>();
+        Live.set(MemberIndex(offsetof(FEXCore::Core::CPUState, flags[0]) + Op->Flag, 1));
+        break;
+      }
+      case OP_SYSCALL:
+      case OP_INLINESYSCALL: {
+        FEXCore::IR::SyscallFlags Flags = IROp->Op == OP_SYSCALL ? IROp->C<IR::IROp_Syscall>()->Flags : IROp->C<IR::IROp_InlineSyscall>()->Flags;
+
+        if ((Flags & FEXCore::IR::SyscallFlags::OPTIMIZETHROUGH) != FEXCore::IR::SyscallFlags::OPTIMIZETHROUGH) {
+          Live.set();
+        }
+        break;
+      }
+      case OP_LOADCONTEXTINDEXED:
+      case OP_STORECONTEXTINDEXED:
+      // These leave the JIT or call out, which might read anything from the context
+      case OP_EXITFUNCTION:
+      case OP_BREAK:
+      case OP_SAFEPOINT:
+      case OP_SIGNALRETURN:
+      case OP_CALLBACKRETURN:
+      case OP_THUNK:
+      case OP_THREADREMOVECODEENTRY:
+        Live.set();
+        break;
+      default: break;
+    }
+  }
+
+  return Live;
+}
+
+/**
+ * @brief Removes context and flag stores that are overwritten on every path before being read
+ *
+ * Standard backwards liveness over the Jump/CondJump edges of the multiblock, to a fixed point.
+ * Leaving the multiblock makes everything live.
+ */
+bool RCLSE::DeadStoreElimination(FEXCore::IR::IREmitter *IREmit) {
+  auto CurrentIR = IREmit->ViewIR();
+  bool Changed = false;
+
+  ContextMemberSet AllMembers;
+  AllMembers.set();
+
+  std::vector<FEXCore::IR::OrderedNode*> Blocks;
+  for (auto [BlockNode, BlockHeader] : CurrentIR.GetBlocks()) {
+    auto &Block = OffsetToBlockMap[CurrentIR.GetID(BlockNode)];
+    Block.Uses = TransferLiveness(IREmit, BlockNode, {}, false, &Changed);
+    Block.Kills = ~TransferLiveness(IREmit, BlockNode, AllMembers, false, &Changed);
+    Block.LiveIn = Block.Uses;
+    Blocks.emplace_back(BlockNode);
+  }
+
+  // Most edges go forwards, so walking backwards converges in few rounds
+  bool LivenessChanged;
+  do {
+    LivenessChanged = false;
+
+    for (auto it = Blocks.rbegin(); it != Blocks.rend(); ++it) {
+      auto &Block = OffsetToBlockMap[CurrentIR.GetID(*it)];
+
+      ContextMemberSet LiveOut;
+      if (Block.Successors.empty()) {
+        LiveOut = AllMembers;
+      }
+
+      for (auto Successor : Block.Successors) {
+        LiveOut |= OffsetToBlockMap[CurrentIR.GetID(Successor)].LiveIn;
+      }
+
+      auto LiveIn = Block.Uses | (LiveOut & ~Block.Kills);
+      if (LiveIn != Block.LiveIn) {
+        LivenessChanged = true;
+      }
+
+      Block.LiveIn = LiveIn;
+      Block.LiveOut = LiveOut;
+    }
+  } while (LivenessChanged);
+
+  for (auto BlockNode : Blocks) {
+    TransferLiveness(IREmit, BlockNode, OffsetToBlockMap[CurrentIR.GetID(BlockNode)].LiveOut, true, &Changed);
+  }
+
+  return Changed;
+}
+
 bool RCLSE::Run(FEXCore::IR::IREmitter *IREmit) {
   FEXCORE_PROFILE_SCOPED("PassManager::RCLSE");
-  // XXX: We don't do cross-block optimizations yet
-  //CalculateControlFlowInfo(IREmit);
+  CalculateControlFlowInfo(IREmit);
   bool Changed = false;
 
   // Run up to 5 times
@@ -776,6 +1006,11 @@ bool RCLSE::Run(FEXCore::IR::IREmitter *IREmit) {
     DCE->Run(IREmit);
   }
 
+  if (DeadStoreElimination(IREmit)) {
+    Changed = true;
+    DCE->Run(IREmit);
+  }
+
   return Changed;
 }
 
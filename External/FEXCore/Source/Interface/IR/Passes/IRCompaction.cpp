@@ -6,7 +6,6 @@ $end_info$
 */
 
 #include "Interface/IR/PassManager.h"
-#include "Interface/Core/OpcodeDispatcher.h"
 
 #include <FEXCore/IR/IR.h>
 #include <FEXCore/IR/IREmitter.h>
@@ -19,6 +18,7 @@ $end_info$
 #include <cstdint>
 #include <cstring>
 #include <memory>
+#include <utility>
 #include <vector>
 
 namespace FEXCore::IR {
@@ -30,53 +30,48 @@ struct RemapNode {
 
 static_assert(sizeof(RemapNode) == 4);
 
+// Remap entry of a node that is dead, or that has already been moved
+constexpr uint32_t UnmappedNode = UINT32_MAX;
+
 class IRCompaction final : public FEXCore::IR::Pass {
 public:
-  IRCompaction(FEXCore::Utils::IntrusivePooledAllocator &Allocator);
+  IRCompaction();
   bool Run(IREmitter *IREmit) override;
 
 private:
   static constexpr size_t AlignSize = 0x2000;
-  OpDispatchBuilder LocalBuilder;
   std::vector<RemapNode> OldToNewRemap;
-  struct CodeBlockData {
-    OrderedNode *OldNode;
-    OrderedNode *NewNode;
-  };
+  // New IDs of the first node of each linked chain, the header's block chain then each block's code
+  std::vector<uint32_t> ChainBegins{};
 
-  std::vector<CodeBlockData> GeneratedCodeBlocks{};
+  struct LiveOp {
+    uint32_t DataOffset;
+    uint32_t OldID;
+  };
+  // Live ops ordered by where their data currently is
+  std::vector<LiveOp> LiveOps{};
 };
 
-IRCompaction::IRCompaction(FEXCore::Utils::IntrusivePooledAllocator &Allocator)
-  : LocalBuilder {Allocator} {
+IRCompaction::IRCompaction() {
   OldToNewRemap.resize(AlignSize);
 }
 
 bool IRCompaction::Run(IREmitter *IREmit) {
   FEXCORE_PROFILE_SCOPED("PassManager::IRCompaction");
 
-  LocalBuilder.ReownOrClaimBuffer();
-
   auto CurrentIR = IREmit->ViewIR();
-  uint32_t NodeCount = CurrentIR.GetSSACount();
+  const uint32_t NodeCount = CurrentIR.GetSSACount();
 
   if (OldToNewRemap.size() < NodeCount) {
     OldToNewRemap.resize(std::max(OldToNewRemap.size() * 2U, AlignUp(NodeCount, AlignSize)));
   }
-  #ifndef NDEBUG
-    memset(&OldToNewRemap.at(0), 0xFF, NodeCount * sizeof(RemapNode));
-  #endif
-
-  GeneratedCodeBlocks.clear();
-
-  // Reset our local working list
-  LocalBuilder.ResetWorkingList();
-  auto LocalIR = LocalBuilder.ViewIR();
+  // Nodes that never get a new ID are dead and get dropped
+  memset(&OldToNewRemap.at(0), 0xFF, NodeCount * sizeof(RemapNode));
 
-  uintptr_t LocalListBegin = LocalIR.GetListData();
-  uintptr_t LocalDataBegin = LocalIR.GetData();
+  ChainBegins.clear();
 
-  uintptr_t ListBegin = CurrentIR.GetListData();
+  const uintptr_t ListBegin = CurrentIR.GetListData();
+  const uintptr_t DataBegin = CurrentIR.GetData();
 
   auto HeaderNode = CurrentIR.GetHeaderNode();
   auto HeaderOp = CurrentIR.GetHeader();
@@ -90,138 +85,128 @@ bool IRCompaction::Run(IREmitter *IREmit) {
   //
   // Additionally there may be some dead ops hanging out in the IR list that are orphaned.
   // These can also be dropped during this pass
-
-  // First thing is first, we need to do some housekeeping
-  // Create the IRHeader op
-  // Create the codeblocks
-  // Then create all the ops inside the code blocks
+  //
+  // This all happens in place in the emitter's buffers:
+  // 1) Walk the IR in program order handing out dense IDs: IRHeader, the codeblocks, then the ops inside each block
+  // 2) Slide each live op's data down over the dead ones, in the order the data is in, and remap its arguments
+  // 3) Permute the list nodes in to their new IDs and relink them
 
   // Zero is always zero(invalid)
-  OldToNewRemap[0].NodeID.Invalidate();
-  auto LocalHeaderOp = LocalBuilder._IRHeader(OrderedNodeWrapper::WrapOffset(0).GetNode(ListBegin), HeaderOp->BlockCount);
-  OldToNewRemap[CurrentIR.GetID(HeaderNode).Value].NodeID = LocalIR.GetID(LocalHeaderOp.Node);
-
-  {
-    // Generate our codeblocks and link them together
-    for (auto [BlockNode, BlockHeader] : CurrentIR.GetBlocks()) {
-      LOGMAN_THROW_AA_FMT(BlockHeader->Op == OP_CODEBLOCK, "IR type failed to be a code block");
-
-      auto LocalBlockIRNode = LocalBuilder._CodeBlock(LocalHeaderOp, LocalHeaderOp); // Use LocalHeaderOp as a dummy arg for now
-      OldToNewRemap[CurrentIR.GetID(BlockNode).Value].NodeID = LocalIR.GetID(LocalBlockIRNode.Node);
-      GeneratedCodeBlocks.emplace_back(CodeBlockData{BlockNode, LocalBlockIRNode});
-    }
+  OldToNewRemap[0].NodeID = IR::NodeID{0};
+  uint32_t NewID = 1;
 
-    // Link the IRHeader to the first code block
-    LocalHeaderOp.first->Blocks = GeneratedCodeBlocks[0].NewNode->Wrapped(LocalListBegin);
+  OldToNewRemap[CurrentIR.GetID(HeaderNode).Value].NodeID = IR::NodeID{NewID++};
+  ChainBegins.emplace_back(1);
+
+  for (auto [BlockNode, BlockHeader] : CurrentIR.GetBlocks()) {
+    LOGMAN_THROW_AA_FMT(BlockHeader->Op == OP_CODEBLOCK, "IR type failed to be a code block");
+    OldToNewRemap[CurrentIR.GetID(BlockNode).Value].NodeID = IR::NodeID{NewID++};
   }
 
-  {
-    // Copy all of our IR ops over to the new location
-    for (auto &Block : GeneratedCodeBlocks) {
+  for (auto [BlockNode, BlockHeader] : CurrentIR.GetBlocks()) {
+    // Block contents are isolated from any previous headers/blocks
+    ChainBegins.emplace_back(NewID);
 
-      // Isolate block contents from any previous headers/blocks
-      LocalBuilder.SetWriteCursor(nullptr);
+    for (auto [CodeNode, IROp] : CurrentIR.GetCode(BlockNode)) {
+      // Even nodes that don't have a destination need to be in this map
+      // Need to be able to remap branch targets any other bits
+      OldToNewRemap[CurrentIR.GetID(CodeNode).Value].NodeID = IR::NodeID{NewID++};
+    }
+  }
 
-      CodeBlockData FirstNode{};
-      CodeBlockData LastNode{};
-      uint32_t i {};
-      for (auto [CodeNode, IROp] : CurrentIR.GetCode(Block.OldNode)) {
-        const size_t OpSize = FEXCore::IR::GetSize(IROp->Op);
-        const auto CodeID = CurrentIR.GetID(CodeNode);
+  const uint32_t NewNodeCount = NewID;
 
-        // Allocate the ops locally for our local dispatch
-        auto LocalPair = LocalBuilder.AllocateRawOp(OpSize);
+  // Data offsets only increase with the old IDs when every op was appended in order.
+  // Ops inserted mid-block (RA's spills and fills) and earlier compactions break that, so sort by data offset.
+  // Walking the data in that order only ever moves it down, never over an op that hasn't been moved yet.
+  LiveOps.clear();
+  bool InDataOrder = true;
+  for (uint32_t OldID = 1; OldID < NodeCount; ++OldID) {
+    if (OldToNewRemap[OldID].NodeID.Value == UnmappedNode) {
+      continue;
+    }
 
-        // Copy usage infomation
-        LocalPair.Node->NumUses = CodeNode->GetUses();
+    auto Node = OrderedNodeWrapper::WrapOffset(OldID * sizeof(OrderedNode)).GetNode(ListBegin);
+    const uint32_t Offset = Node->Header.Value.NodeOffset;
+    InDataOrder &= LiveOps.empty() || LiveOps.back().DataOffset < Offset;
+    LiveOps.emplace_back(LiveOp{Offset, OldID});
+  }
 
-        // Copy over the op
-        memcpy(LocalPair.first, IROp, OpSize);
+  if (!InDataOrder) {
+    std::sort(LiveOps.begin(), LiveOps.end(), [](LiveOp const &lhs, LiveOp const &rhs) {
+      return lhs.DataOffset < rhs.DataOffset;
+    });
+  }
 
-        // Set our map remapper to map the new location
-        // Even nodes that don't have a destination need to be in this map
-        // Need to be able to remap branch targets any other bits
-        OldToNewRemap[CodeID.Value].NodeID = LocalIR.GetID(LocalPair.Node);
+  size_t DataOffset = 0;
+  for (auto [OldOffset, OldID] : LiveOps) {
+    auto Node = OrderedNodeWrapper::WrapOffset(OldID * sizeof(OrderedNode)).GetNode(ListBegin);
 
-        if (i == 0) {
-          FirstNode.OldNode = CodeNode;
-          FirstNode.NewNode = LocalPair.Node;
-        }
+    auto IROp = reinterpret_cast<IROp_Header*>(DataBegin + DataOffset);
+    const size_t OpSize = FEXCore::IR::GetSize(reinterpret_cast<IROp_Header*>(DataBegin + OldOffset)->Op);
+    if (OldOffset != DataOffset) {
+      memmove(IROp, reinterpret_cast<void*>(DataBegin + OldOffset), OpSize);
+      Node->Header.Value.NodeOffset = DataOffset;
+    }
+    DataOffset += OpSize;
 
-        if (IROp->Op == OP_ENDBLOCK) {
-          LastNode.OldNode = CodeNode;
-          LastNode.NewNode = LocalPair.Node;
-        }
+    // Now that we have the op in its final location, we need to modify SSA values to point to the new correct locations
+    // This doesn't use IR::GetArgs(Op) because we need to remap all SSA nodes
+    // Including ones that we don't RA, and the header and codeblock links
+    const uint8_t NumArgs = IROp->NumArgs;
+    for (uint8_t i = 0; i < NumArgs; ++i) {
+      const auto OldArg = IROp->Args[i].ID();
+      const auto NewArg = OldToNewRemap[OldArg.Value].NodeID;
 
-        ++i;
-      }
+      LOGMAN_THROW_A_FMT(NewArg.Value != UnmappedNode, "Tried remapping unfound node %ssa{}", OldArg);
 
-      // Set the code block's begin and end correctly
-      auto NewBlockIROp = Block.NewNode->Op(LocalDataBegin)->CW<FEXCore::IR::IROp_CodeBlock>();
-      NewBlockIROp->Begin = FirstNode.NewNode->Wrapped(LocalListBegin);
-      NewBlockIROp->Last = LastNode.NewNode->Wrapped(LocalListBegin);
+      IROp->Args[i].NodeOffset = NewArg.Value * sizeof(OrderedNode);
     }
   }
 
-  {
-    // Fixup the arguments of all the IROps
-    for (auto &Block : GeneratedCodeBlocks) {
-#if defined(ASSERTIONS_ENABLED) && ASSERTIONS_ENABLED
-      auto BlockIROp = LocalIR.GetOp<FEXCore::IR::IROp_CodeBlock>(Block.NewNode);
-      LOGMAN_THROW_AA_FMT(BlockIROp->Header.Op == OP_CODEBLOCK, "IR type failed to be a code block");
-#endif
-
-      for (auto [LocalNode, LocalIROp] : LocalIR.GetCode(Block.NewNode)) {
-
-        // Now that we have the op copied over, we need to modify SSA values to point to the new correct locations
-        // This doesn't use IR::GetArgs(Op) because we need to remap all SSA nodes
-        // Including ones that we don't RA
-        const uint8_t NumArgs = LocalIROp->NumArgs;
-        for (uint8_t i = 0; i < NumArgs; ++i) {
-          const auto OldArg = LocalIROp->Args[i].ID();
-          const auto NewArg = OldToNewRemap[OldArg.Value].NodeID;
-
-          #ifndef NDEBUG
-            LOGMAN_THROW_A_FMT(NewArg.Value != UINT32_MAX,
-                               "Tried remapping unfound node %ssa{}", OldArg);
-          #endif
-
-          LocalIROp->Args[i].NodeOffset = NewArg.Value * sizeof(OrderedNode);
-        }
-      }
+  // Move every live node to its new ID by following the permutation's cycles.
+  // A node's remap entry is cleared once it has been picked up, a slot that is dead or already vacated can just be overwritten.
+  auto List = reinterpret_cast<OrderedNode*>(ListBegin);
+  for (uint32_t OldID = 1; OldID < NodeCount; ++OldID) {
+    const uint32_t Target = OldToNewRemap[OldID].NodeID.Value;
+    if (Target == UnmappedNode) {
+      continue;
     }
-  }
-
-  // uintptr_t OldListSize = CurrentIR.GetListSize();
-  // uintptr_t OldDataSize = CurrentIR.GetDataSize();
 
-  // uintptr_t NewListSize = LocalIR.GetListSize();
-  // uintptr_t NewDataSize = LocalIR.GetDataSize();
-
-  // if (NewListSize < OldListSize ||
-  //     NewDataSize < OldDataSize) {
-  //   if (NewListSize < OldListSize) {
-  //     LogMan::Msg::DFmt("Shaved {} bytes off the list size", OldListSize - NewListSize);
-  //   }
-  //   if (NewDataSize < OldDataSize) {
-  //     LogMan::Msg::DFmt("Shaved {} bytes off the data size", OldDataSize - NewDataSize);
-  //   }
-  // }
+    OldToNewRemap[OldID].NodeID.Value = UnmappedNode;
+    if (Target == OldID) {
+      continue;
+    }
 
-  // if (NewListSize > OldListSize ||
-  //     NewDataSize > OldDataSize) {
-  //   LOGMAN_MSG_A_FMT("Whoa. Compaction made the IR a different size when it shouldn't have. 0x{:x} > 0x{:x} or 0x{:x} > 0x{:x}",
-  //                    NewListSize, OldListSize, NewDataSize, OldDataSize);
-  // }
+    OrderedNode Carry = List[OldID];
+    uint32_t Dest = Target;
+    while (OldToNewRemap[Dest].NodeID.Value != UnmappedNode) {
+      const uint32_t NextDest = OldToNewRemap[Dest].NodeID.Value;
+      OldToNewRemap[Dest].NodeID.Value = UnmappedNode;
+      std::swap(Carry, List[Dest]);
+      Dest = NextDest;
+    }
+    List[Dest] = Carry;
+  }
 
-  IREmit->CopyData(LocalBuilder);
+  // Relink the nodes, each chain is now a contiguous run of IDs
+  memset(&List[0], 0, sizeof(OrderedNode));
+  ChainBegins.emplace_back(NewNodeCount);
+  for (size_t Chain = 0; Chain + 1 < ChainBegins.size(); ++Chain) {
+    const uint32_t Begin = ChainBegins[Chain];
+    const uint32_t End = ChainBegins[Chain + 1];
+    for (uint32_t ID = Begin; ID < End; ++ID) {
+      List[ID].Header.Previous.NodeOffset = ID == Begin ? 0 : (ID - 1) * sizeof(OrderedNode);
+      List[ID].Header.Next.NodeOffset = ID + 1 == End ? 0 : (ID + 1) * sizeof(OrderedNode);
+    }
+  }
 
-  LocalBuilder.DelayedDisownBuffer();
+  IREmit->ShrinkCompactedData(DataOffset, NewNodeCount * sizeof(OrderedNode));
   return true;
 }
 
-std::unique_ptr<FEXCore::IR::Pass> CreateIRCompaction(FEXCore::Utils::IntrusivePooledAllocator &Allocator) {
-  return std::make_unique<IRCompaction>(Allocator);
+std::unique_ptr<FEXCore::IR::Pass> CreateIRCompaction() {
+  return std::make_unique<IRCompaction>();
 }
 
 }
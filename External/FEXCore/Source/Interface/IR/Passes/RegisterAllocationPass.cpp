@@ -253,6 +253,14 @@ namespace {
     return FEXCore::IR::InvalidClass;
   };
 
+  // GPR pairs are made of GPRs, so they interfere with each other
+  uint32_t GetInterferenceClass(PhysicalRegister PhyReg) {
+    if (PhyReg.Class == IR::GPRPairClass.Val)
+      return IR::GPRClass.Val;
+    else
+      return (uint32_t)PhyReg.Class;
+  }
+
   // Walk the IR and set the node classes
   void FindNodeClasses(RegisterGraph *Graph, FEXCore::IR::IRListView *IR) {
     for (auto [CodeNode, IROp] : IR->GetAllCode()) {
@@ -323,6 +331,7 @@ namespace {
       void CalculateBlockNodeInterference(FEXCore::IR::IRListView *IR);
       void CalculateNodeInterference(FEXCore::IR::IRListView *IR);
       void AllocateVirtualRegisters();
+      void LinearScanAllocateVirtualRegisters();
       void CalculatePredecessors(FEXCore::IR::IRListView *IR);
       void RecursiveLiveRangeExpansion(FEXCore::IR::IRListView *IR,
                                        IR::NodeID Node, IR::NodeID DefiningBlockID,
@@ -900,13 +909,6 @@ namespace {
 
     // Now that we have all the live ranges calculated we need to add them to our interference graph
 
-    const auto GetClass = [](PhysicalRegister PhyReg) {
-      if (PhyReg.Class == IR::GPRPairClass.Val)
-        return IR::GPRClass.Val;
-      else
-        return (uint32_t)PhyReg.Class;
-    };
-
     // SpanStart/SpanEnd assume SSA id will fit in 24bits
     LOGMAN_THROW_AA_FMT(NodeCount <= 0xff'ffff, "Block too large for Spans");
 
@@ -918,7 +920,7 @@ namespace {
       if (NodeLiveRange.Begin.Value != UINT32_MAX) {
         LOGMAN_THROW_A_FMT(NodeLiveRange.Begin < NodeLiveRange.End , "Span must Begin before Ending");
 
-        const auto Class = GetClass(Graph->AllocData->Map[i]);
+        const auto Class = GetInterferenceClass(Graph->AllocData->Map[i]);
         SpanStart[NodeLiveRange.Begin.Value].Append(InfoMake(i, Class));
         SpanEnd[NodeLiveRange.End.Value]    .Append(InfoMake(i, Class));
       }
@@ -1030,6 +1032,84 @@ namespace {
     }
   }
 
+  void ConstrainedRAPass::LinearScanAllocateVirtualRegisters() {
+    // Ranges only start before their definition when the value is live across blocks
+    std::vector<IR::NodeID> Order;
+    Order.reserve(LiveRanges.size());
+    for (uint32_t i = 0; i < LiveRanges.size(); ++i) {
+      if (Graph->AllocData->Map[i] != PhysicalRegister::Invalid() &&
+          LiveRanges[i].Begin.Value != UINT32_MAX) {
+        Order.emplace_back(i);
+      }
+    }
+
+    std::sort(Order.begin(), Order.end(), [this](IR::NodeID Lhs, IR::NodeID Rhs) {
+      const auto LhsBegin = LiveRanges[Lhs.Value].Begin;
+      const auto RhsBegin = LiveRanges[Rhs.Value].Begin;
+      return LhsBegin != RhsBegin ? LhsBegin < RhsBegin : Lhs < Rhs;
+    });
+
+    std::vector<IR::NodeID> Active;
+
+    for (auto Node : Order) {
+      auto &CurrentRegAndClass = Graph->AllocData->Map[Node.Value];
+      const auto &NodeLiveRange = LiveRanges[Node.Value];
+      const FEXCore::IR::RegisterClassType RegClass {CurrentRegAndClass.Class};
+      const auto InterferenceClass = GetInterferenceClass(CurrentRegAndClass);
+
+      // Same interval semantics as the interference graph, a range ending where this one begins doesn't interfere
+      std::erase_if(Active, [&](IR::NodeID ActiveNode) {
+        return LiveRanges[ActiveNode.Value].End <= NodeLiveRange.Begin;
+      });
+
+      auto RegAndClass = PhysicalRegister::Invalid();
+
+      if (!NodeLiveRange.PrefferedRegister.IsInvalid()) {
+        RegAndClass = NodeLiveRange.PrefferedRegister;
+      } else {
+        uint32_t RegisterConflicts = 0;
+        for (auto ActiveNode : Active) {
+          const auto ActiveRegAndClass = Graph->AllocData->Map[ActiveNode.Value];
+          if (GetInterferenceClass(ActiveRegAndClass) == InterferenceClass) {
+            RegisterConflicts |= GetConflicts(Graph, ActiveRegAndClass, RegClass);
+          }
+        }
+
+        RegisterConflicts = (~RegisterConflicts) & Graph->Set.Classes[RegClass].CountMask;
+        int Reg = ffs(RegisterConflicts);
+        if (Reg != 0) {
+          RegAndClass = PhysicalRegister(RegClass, Reg-1);
+        }
+      }
+
+      if (RegAndClass.IsInvalid()) {
+        CurrentRegAndClass = IR::PhysicalRegister(RegClass, INVALID_REG);
+        HadFullRA = false;
+        SpillPointId = Node;
+
+        // SpillOne picks what to spill from the interference list, only the failing node needs one
+        auto &Interferences = Graph->Nodes[Node.Value].Interferences;
+        for (uint32_t i = 0; i < LiveRanges.size(); ++i) {
+          const auto &OtherLiveRange = LiveRanges[i];
+          if (i != Node.Value &&
+              OtherLiveRange.Begin.Value != UINT32_MAX &&
+              Graph->AllocData->Map[i] != PhysicalRegister::Invalid() &&
+              GetInterferenceClass(Graph->AllocData->Map[i]) == InterferenceClass &&
+              OtherLiveRange.Begin < NodeLiveRange.End &&
+              NodeLiveRange.Begin < OtherLiveRange.End) {
+            Interferences.Append(IR::NodeID{i});
+          }
+        }
+
+        // Must spill and restart
+        return;
+      }
+
+      CurrentRegAndClass = RegAndClass;
+      Active.emplace_back(Node);
+    }
+  }
+
   FEXCore::IR::AllNodesIterator ConstrainedRAPass::FindFirstUse(FEXCore::IR::IREmitter *IREmit, FEXCore::IR::OrderedNode* Node, FEXCore::IR::AllNodesIterator Begin, FEXCore::IR::AllNodesIterator End) {
     using namespace FEXCore::IR;
     const auto SearchID = IREmit->ViewIR().GetID(Node);
@@ -1501,10 +1581,13 @@ namespace {
       CalculateBlockInterferences(&IR);
       CalculateBlockNodeInterference(&IR);
     }
-    else*/ {
+    else*/ if (LinearScan) {
+      LinearScanAllocateVirtualRegisters();
+    }
+    else {
       CalculateNodeInterference(&IR);
+      AllocateVirtualRegisters();
     }
-    AllocateVirtualRegisters();
 
     return Changed;
   }
@@ -19,6 +19,13 @@ class RegisterAllocationPass : public FEXCore::IR::Pass {
   public:
     bool HasFullRA() const { return HadFullRA; }
 
+    /**
+     * @brief Selects a single pass linear scan over the live ranges instead of graph coloring
+     *
+     * Much cheaper to run but allocates less tightly, meant for code that isn't expected to run often.
+     */
+    void SetLinearScan(bool Enable) { LinearScan = Enable; }
+
     virtual void AllocateRegisterSet(uint32_t RegisterCount, uint32_t ClassCount) = 0;
     virtual void AddRegisters(FEXCore::IR::RegisterClassType Class, uint32_t RegisterCount) = 0;
 
@@ -58,6 +65,7 @@ class RegisterAllocationPass : public FEXCore::IR::Pass {
     constexpr static bool ReuseSpillSlots {true};
     uint32_t SpillSlotCount {};
     bool HadFullRA {};
+    bool LinearScan {};
 };
 
 }
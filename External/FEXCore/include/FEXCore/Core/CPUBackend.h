@@ -44,11 +44,16 @@ namespace CPU {
       size_t Size;
     };
 
+    // A code buffer that can't grow any further is split in to this many regions
+    // Running out of space then only evicts the oldest region instead of the whole code cache
+    constexpr static size_t CODE_REGION_COUNT = 8;
+
     /**
      * @param InitialCodeSize - Initial size for the code buffers
      * @param MaxCodeSize - Max size for the code buffers
+     * @param UseCodeRegions - Split code buffers at MaxCodeSize in to regions, the backend must emit in to CurrentCodeRegion
     */
-    CPUBackend(FEXCore::Core::InternalThreadState *ThreadState, size_t InitialCodeSize, size_t MaxCodeSize);
+    CPUBackend(FEXCore::Core::InternalThreadState *ThreadState, size_t InitialCodeSize, size_t MaxCodeSize, bool UseCodeRegions = false);
 
     virtual ~CPUBackend();
     /**
@@ -119,6 +124,34 @@ namespace CPU {
      */
     virtual void ClearRelocations() {}
 
+    /**
+     * @brief Restarts code emission at the start of CurrentCodeRegion
+     *
+     * Called after every block in the region got evicted, the backend drops any metadata it has about code in the region
+     */
+    virtual void ResetCodeRegion() {}
+
+    /**
+     * @brief Moves CurrentCodeRegion to the next region of the code buffer
+     *
+     * Regions are handed out in address order, then reused oldest first.
+     * Every block compiled in to the new region must be evicted before calling ResetCodeRegion.
+     *
+     * @return false if the code buffer isn't split or signal handler code might be on the stack,
+     * the whole code cache needs to be cleared instead
+     */
+    [[nodiscard]] bool NextCodeRegion();
+
+    CodeBuffer const &GetCurrentCodeRegion() const { return CurrentCodeRegion; }
+
+    // For when the LookupCache got cleared while keeping the code, links between the old blocks aren't tracked anymore.
+    // NextCodeRegion fails until the next full clear
+    void DisableCodeRegionEviction() { CanEvictCodeRegions = false; }
+
+    // Index of the region that contains Address, 0 if the code buffer isn't split
+    // Doesn't allocate, safe to call from signal handlers
+    [[nodiscard]] size_t GetCodeRegionIndex(uintptr_t Address) const;
+
     bool IsAddressInCodeBuffer(uintptr_t Address) const;
 
   protected:
@@ -134,7 +167,17 @@ namespace CPU {
     // This is the current code buffer that we are tracking
     CodeBuffer *CurrentCodeBuffer{};
 
+    // Part of CurrentCodeBuffer that code is emitted in to
+    // All of it unless the buffer is split in to regions
+    CodeBuffer CurrentCodeRegion{};
+    size_t CurrentCodeRegionIndex{};
+
   private:
+    const bool UseCodeRegions;
+    // Size of each region when CurrentCodeBuffer is split, otherwise 0
+    size_t CodeRegionSize{};
+    bool CanEvictCodeRegions{};
+
     CodeBuffer AllocateNewCodeBuffer(size_t Size);
     void FreeCodeBuffer(CodeBuffer Buffer);
 
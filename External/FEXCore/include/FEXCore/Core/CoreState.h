@@ -3,9 +3,12 @@
 #include <FEXCore/HLE/Linux/ThreadManagement.h>
 #include <FEXCore/Utils/CompilerDefs.h>
 #include <FEXCore/Core/CPUBackend.h>
+#include <FEXCore/Core/X86Enums.h>
 
 #include <atomic>
+#include <bit>
 #include <cstddef>
+#include <cstring>
 #include <stdint.h>
 #include <string_view>
 
@@ -50,6 +53,7 @@ namespace FEXCore::Core {
     uint16_t FTW;
 
     static constexpr size_t FLAG_SIZE = sizeof(flags[0]);
+    static constexpr size_t NZCV_SIZE = sizeof(uint32_t);
     static constexpr size_t GDT_SIZE = sizeof(gdt[0]);
     static constexpr size_t GPR_REG_SIZE = sizeof(gregs[0]);
     static constexpr size_t XMM_AVX_REG_SIZE = sizeof(xmm.avx.data[0]);
@@ -63,9 +67,75 @@ namespace FEXCore::Core {
     static constexpr size_t NUM_GPRS = sizeof(gregs) / GPR_REG_SIZE;
     static constexpr size_t NUM_XMMS = sizeof(xmm) / XMM_AVX_REG_SIZE;
     static constexpr size_t NUM_MMS = sizeof(mm) / MM_REG_SIZE;
+
+    // PF and AF are stored lazily by JIT code.
+    // PF's slot holds a byte with the parity of the result, AF's slot holds AF in bit 4.
+    // CF, ZF, SF and OF are packed in the NZCV word at RFLAG_NZCV_LOC rather than their own slots.
+    // Anything outside of the JIT that reads or writes EFLAGS needs to go through these.
+    uint32_t GetNZCV() const {
+      uint32_t NZCV;
+      memcpy(&NZCV, &flags[X86State::RFLAG_NZCV_LOC], sizeof(NZCV));
+      return NZCV;
+    }
+
+    void SetNZCV(uint32_t NZCV) {
+      memcpy(&flags[X86State::RFLAG_NZCV_LOC], &NZCV, sizeof(NZCV));
+    }
+
+    uint8_t GetEFLAGBit(size_t Bit) const {
+      if (Bit == X86State::RFLAG_PF_LOC) {
+        return (std::popcount(flags[Bit]) & 1) ^ 1;
+      }
+      else if (Bit == X86State::RFLAG_AF_LOC) {
+        return (flags[Bit] >> 4) & 1;
+      }
+      else if (X86State::IsNZCVFlag(Bit)) {
+        return (GetNZCV() >> X86State::GetNZCVLoc(Bit)) & 1;
+      }
+      else if (Bit >= X86State::RFLAG_NZCV_LOC && Bit < X86State::RFLAG_NZCV_LOC + NZCV_SIZE) {
+        // Reserved EFLAGS bits whose slots hold the NZCV word
+        return 0;
+      }
+      return flags[Bit];
+    }
+
+    void SetEFLAGBit(size_t Bit, bool Value) {
+      if (Bit == X86State::RFLAG_PF_LOC) {
+        flags[Bit] = Value ? 0 : 1;
+      }
+      else if (Bit == X86State::RFLAG_AF_LOC) {
+        flags[Bit] = Value ? (1U << 4) : 0;
+      }
+      else if (X86State::IsNZCVFlag(Bit)) {
+        const uint32_t Mask = 1U << X86State::GetNZCVLoc(Bit);
+        SetNZCV(Value ? (GetNZCV() | Mask) : (GetNZCV() & ~Mask));
+      }
+      else if (Bit >= X86State::RFLAG_NZCV_LOC && Bit < X86State::RFLAG_NZCV_LOC + NZCV_SIZE) {
+        // Reserved, don't clobber the NZCV word
+      }
+      else {
+        flags[Bit] = Value;
+      }
+    }
+
+    uint32_t GetEFLAGS() const {
+      uint32_t EFLAGS{};
+      for (size_t i = 0; i < NUM_EFLAG_BITS; ++i) {
+        EFLAGS |= static_cast<uint32_t>(GetEFLAGBit(i)) << i;
+      }
+      return EFLAGS;
+    }
+
+    void SetEFLAGS(uint32_t EFLAGS) {
+      SetNZCV(0);
+      for (size_t i = 0; i < NUM_EFLAG_BITS; ++i) {
+        SetEFLAGBit(i, EFLAGS & (1U << i));
+      }
+    }
   };
   static_assert(offsetof(CPUState, xmm) % 32 == 0, "xmm needs to be 256-bit aligned!");
   static_assert(offsetof(CPUState, mm) % 16 == 0, "mm needs to be 128-bit aligned!");
+  static_assert((offsetof(CPUState, flags) + X86State::RFLAG_NZCV_LOC) % 4 == 0, "NZCV needs to be 32-bit aligned!");
 
   struct InternalThreadState;
 
@@ -125,6 +195,22 @@ namespace FEXCore::Core {
     OPINDEX_F64FPREM,
     OPINDEX_F64FPREM1,
     OPINDEX_F64SCALE,
+
+    // Crypto, for hosts without the matching extension
+    OPINDEX_VAESIMC,
+    OPINDEX_VAESENC,
+    OPINDEX_VAESENCLAST,
+    OPINDEX_VAESDEC,
+    OPINDEX_VAESDECLAST,
+    OPINDEX_VAESKEYGENASSIST,
+    OPINDEX_PCLMUL_00,
+    OPINDEX_PCLMUL_01,
+    OPINDEX_PCLMUL_10,
+    OPINDEX_PCLMUL_11,
+    OPINDEX_CRC32_1,
+    OPINDEX_CRC32_2,
+    OPINDEX_CRC32_4,
+    OPINDEX_CRC32_8,
     // Maximum
     OPINDEX_MAX,
   };
@@ -142,6 +228,7 @@ namespace FEXCore::Core {
       uint64_t SyscallHandlerObj{};
       uint64_t SyscallHandlerFunc{};
       uint64_t ExitFunctionLink{};
+      uint64_t IndirectBranchLink{};
 
       uint64_t FallbackHandlerPointers[FallbackHandlerIndex::OPINDEX_MAX];
 
@@ -152,6 +239,7 @@ namespace FEXCore::Core {
       uint64_t DispatcherLoopTop{};
       uint64_t DispatcherLoopTopFillSRA{};
       uint64_t ExitFunctionLinker{};
+      uint64_t IndirectBranchLinker{};
       uint64_t ThreadStopHandlerSpillSRA{};
       uint64_t ThreadPauseHandlerSpillSRA{};
       uint64_t UnimplementedInstructionHandler{};
@@ -218,6 +306,14 @@ namespace FEXCore::Core {
 
     uint32_t SignalHandlerRefCounter{};
 
+    /**
+     * @brief Nonzero when another thread wants this one to pause or stop at its next safepoint
+     *
+     * Only used with SafepointPolling. The JIT polls it at each guest block entry and the dispatcher handles it.
+     * The reason is stored in the thread's SignalReason before this is set.
+     */
+    std::atomic<uint32_t> SafepointRequest{};
+
     struct alignas(8) SynchronousFaultDataStruct {
       bool FaultToTopAndGeneratedException{};
       uint8_t Signal;
@@ -227,6 +323,26 @@ namespace FEXCore::Core {
       uint32_t _pad : 16;
     } SynchronousFaultData;
 
+    /**
+     * @brief Counts how blocks leave JIT code
+     *
+     * Syscalls and signals are always counted.
+     * Dispatcher lookups and fallback handler calls are only counted when the GuestProfiler is enabled.
+     */
+    struct ExitCountersStruct {
+      uint64_t DispatcherLookup;
+      uint64_t Syscall;
+      uint64_t Fallback;
+      uint64_t Signal;
+    } ExitCounters{};
+
+    /**
+     * @brief Host FCW value for the guest precision and rounding control, used by the F80 ops the x86-64 JIT runs on the host x87
+     *
+     * Written by F80LoadFCW with every exception masked, only loaded in to the host FCW around those ops.
+     */
+    uint16_t F80GuestFCW{0x37F};
+
     InternalThreadState* Thread;
 
     // Pointers that the JIT needs to load to remove relocations
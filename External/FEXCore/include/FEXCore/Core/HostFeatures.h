@@ -29,6 +29,11 @@ class HostFeatures final {
     bool SupportsBMI2{};
     bool SupportsPMULL_128Bit{};
 
+    // Missing extensions that are still exposed through the software fallbacks
+    bool EmulateAES{};
+    bool EmulateCRC{};
+    bool EmulatePMULL_128Bit{};
+
     // Float exception behaviour
     bool SupportsFlushInputsToZero{};
     bool SupportsFloatExceptions{};
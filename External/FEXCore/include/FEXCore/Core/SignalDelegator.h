@@ -83,6 +83,9 @@ namespace Core {
     // 64 is used internally by Valgrind
     constexpr static size_t SIGNAL_FOR_PAUSE {63};
 
+    // Sampling timer for the GuestProfiler, only installed when it is enabled
+    constexpr static size_t SIGNAL_FOR_PROFILER {62};
+
   protected:
     FEXCore::Core::InternalThreadState *GetTLSThread();
     virtual void HandleGuestSignal(FEXCore::Core::InternalThreadState *Thread, int Signal, void *info, void *ucontext) = 0;
@@ -73,6 +73,10 @@ enum X86RegLocation : uint32_t {
   RFLAG_VIP_LOC   = 20,
   RFLAG_ID_LOC    = 21,
 
+// CF, ZF, SF and OF don't use their own slots.
+// They are packed in to a 32-bit word at this flag offset, using AArch64's NZCV layout.
+  RFLAG_NZCV_LOC  = 24,
+
 // So we can share flag handling logic, we put x87 flags after RFLAGS
   X87FLAG_BASE    = 32,
   X87FLAG_IE_LOC  = 32,
@@ -91,6 +95,33 @@ enum X86RegLocation : uint32_t {
   X87FLAG_B_LOC   = 47,
 };
 
+/**
+ * @name Bit locations of the flags packed at RFLAG_NZCV_LOC
+ * @{ */
+enum X86NZCVLocation : uint32_t {
+  NZCV_OF_LOC = 28,
+  NZCV_CF_LOC = 29,
+  NZCV_ZF_LOC = 30,
+  NZCV_SF_LOC = 31,
+};
+
+constexpr bool IsNZCVFlag(uint32_t Flag) {
+  return Flag == RFLAG_CF_LOC ||
+         Flag == RFLAG_ZF_LOC ||
+         Flag == RFLAG_SF_LOC ||
+         Flag == RFLAG_OF_LOC;
+}
+
+constexpr uint32_t GetNZCVLoc(uint32_t Flag) {
+  switch (Flag) {
+    case RFLAG_CF_LOC: return NZCV_CF_LOC;
+    case RFLAG_ZF_LOC: return NZCV_ZF_LOC;
+    case RFLAG_SF_LOC: return NZCV_SF_LOC;
+    default:           return NZCV_OF_LOC;
+  }
+}
+/**  @} */
+
 // X86 trap number definitions
 enum X86TrapNo : uint32_t {
   X86_TRAPNO_DE       = 0,  // Divide-by-zero
@@ -21,8 +21,9 @@ namespace Debug {
 
   bool GetDebugDataForRIP(FEXCore::Context::Context *CTX, uint64_t RIP, FEXCore::Core::DebugData *Data);
   bool FindHostCodeForRIP(FEXCore::Context::Context *CTX, uint64_t RIP, uint8_t **Code);
+  // Decompresses the IR kept for the block in to Storage, IR points in to Storage
+  bool FindIRForRIP(FEXCore::Context::Context *CTX, uint64_t RIP, std::vector<uint8_t> *Storage, FEXCore::IR::IRListView **IR);
 	// XXX:
-  // bool FindIRForRIP(FEXCore::Context::Context *CTX, uint64_t RIP, FEXCore::IR::IntrusiveIRList **ir);
   // void SetIRForRIP(FEXCore::Context::Context *CTX, uint64_t RIP, FEXCore::IR::IntrusiveIRList *const ir);
 }
 }
@@ -10,9 +10,15 @@
 
 #include <tsl/robin_map.h>
 
+#include <array>
 #include <shared_mutex>
+#include <string>
+#include <vector>
 
 namespace FEXCore {
+  class BlockTierData;
+  class DebugMetadataStore;
+  class GuestProfiler;
   class LookupCache;
   class CompileService;
 }
@@ -41,6 +47,29 @@ namespace FEXCore::Core {
     std::atomic_uint64_t BlocksCompiled;
   };
 
+  /**
+   * @brief Time spent in each stage of compiling a block
+   *
+   * Only collected while InternalThreadState::CompileStats is set, FEXBench uses this to track compile latency
+   */
+  struct CompileTimingStats {
+    struct PassTime {
+      std::string Name;
+      uint64_t TimeNS;
+    };
+
+    uint64_t BlocksCompiled;
+    uint64_t GuestInstructions;
+    uint64_t HostCodeBytes;
+
+    uint64_t DecodeNS;
+    uint64_t DispatchNS;
+    uint64_t BackendNS;
+
+    // In the order the PassManager runs them, RA is the last pass
+    std::vector<PassTime> Passes;
+  };
+
   struct DebugDataSubblock {
     uint32_t HostCodeOffset;
     uint32_t HostCodeSize;
@@ -70,14 +99,6 @@ namespace FEXCore::Core {
     Return,
   };
 
-  struct LocalIREntry {
-    uint64_t StartAddr;
-    uint64_t Length;
-    std::unique_ptr<FEXCore::IR::IRListView, FEXCore::IR::IRListViewDeleter> IR;
-    FEXCore::IR::RegisterAllocationData::UniquePtr RAData;
-    std::unique_ptr<FEXCore::Core::DebugData> DebugData;
-  };
-
   struct InternalThreadState {
     FEXCore::Core::CpuStateFrame* const CurrentFrame = &BaseFrameState;
 
@@ -101,14 +122,24 @@ namespace FEXCore::Core {
     std::unique_ptr<FEXCore::CPU::CPUBackend> CPUBackend;
     std::unique_ptr<FEXCore::LookupCache> LookupCache;
 
-    tsl::robin_map<uint64_t, LocalIREntry> DebugStore;
+    std::unique_ptr<FEXCore::DebugMetadataStore> DebugStore;
 
     std::unique_ptr<FEXCore::Frontend::Decoder> FrontendDecoder;
     std::unique_ptr<FEXCore::IR::PassManager> PassManager;
+    std::unique_ptr<FEXCore::BlockTierData> TierData;
+    std::unique_ptr<FEXCore::GuestProfiler> Profiler;
     FEXCore::HLE::ThreadManagement ThreadManager;
 
     RuntimeStats Stats{};
 
+    // Guest RIPs of accesses backpatched by the SIGBUS handler, merged in to the Context on the next block compile
+    // Written from the signal handler so this must never allocate, RIPs past the capacity are dropped and will fault again
+    struct {
+      std::array<uint64_t, 64> RIPs;
+      uint32_t Count;
+    } PendingUnalignedAccesses{};
+    std::unique_ptr<CompileTimingStats> CompileStats;
+
     int StatusCode{};
     FEXCore::Context::ExitReason ExitReason {FEXCore::Context::ExitReason::EXIT_WAITING};
     std::shared_ptr<FEXCore::CompileService> CompileService;
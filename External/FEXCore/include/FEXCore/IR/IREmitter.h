@@ -87,13 +87,13 @@ friend class FEXCore::IR::PassManager;
     return _LoadMem(Class, Size, ssa0, Invalid(), Align, MEM_OFFSET_SXTX, 1);
   }
   IRPair<IROp_LoadMemTSO> _LoadMemTSO(FEXCore::IR::RegisterClassType Class, uint8_t Size, OrderedNode *ssa0, uint8_t Align = 1) {
-    return _LoadMemTSO(Class, Size, ssa0, Invalid(), Align, MEM_OFFSET_SXTX, 1);
+    return _LoadMemTSO(Class, Size, ssa0, Invalid(), Align, MEM_OFFSET_SXTX, 1, 0);
   }
   IRPair<IROp_StoreMem> _StoreMem(FEXCore::IR::RegisterClassType Class, uint8_t Size, OrderedNode *Addr, OrderedNode *Value, uint8_t Align = 1) {
     return _StoreMem(Class, Size, Value, Addr, Invalid(), Align, MEM_OFFSET_SXTX, 1);
   }
   IRPair<IROp_StoreMemTSO> _StoreMemTSO(FEXCore::IR::RegisterClassType Class, uint8_t Size, OrderedNode *Addr, OrderedNode *Value, uint8_t Align = 1) {
-    return _StoreMemTSO(Class, Size, Value, Addr, Invalid(), Align, MEM_OFFSET_SXTX, 1);
+    return _StoreMemTSO(Class, Size, Value, Addr, Invalid(), Align, MEM_OFFSET_SXTX, 1, 0);
   }
   OrderedNode *Invalid() {
     return InvalidNode;
@@ -255,6 +255,17 @@ friend class FEXCore::IR::PassManager;
     }
   }
 
+  /**
+   * @brief Drops the tail of the IR buffers after they were compacted in place
+   *
+   * Compaction renumbers every node, so the code block list and write cursor are reset like CopyData would.
+   */
+  void ShrinkCompactedData(size_t DataSize, size_t ListSize) {
+    DualListData.Shrink(DataSize, ListSize);
+    CurrentWriteCursor = nullptr;
+    CodeBlocks.clear();
+  }
+
   void SetWriteCursor(OrderedNode *Node) {
     CurrentWriteCursor = Node;
   }
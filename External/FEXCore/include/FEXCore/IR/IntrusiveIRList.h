@@ -62,6 +62,13 @@ class DualIntrusiveAllocator {
 
     void Reset() { DataCurrentOffset = 0; ListCurrentOffset = 0; }
 
+    void Shrink(size_t NewDataSize, size_t NewListSize) {
+      assert(NewDataSize <= DataCurrentOffset && NewListSize <= ListCurrentOffset &&
+        "Can only shrink DualIntrusiveAllocator");
+      DataCurrentOffset = NewDataSize;
+      ListCurrentOffset = NewListSize;
+    }
+
     void CopyData(DualIntrusiveAllocator const &rhs) {
       DataCurrentOffset = rhs.DataCurrentOffset;
       ListCurrentOffset = rhs.ListCurrentOffset;
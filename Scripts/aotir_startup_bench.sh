@@ -0,0 +1,26 @@
+#!/bin/bash
+# Times short lived process startup under FEX, `sh -c true` run back to back
+# Runs once with AOTIR loading and once without, compare the output between builds
+# Args: [FEXInterpreter, default FEXInterpreter] [Iterations, default 1000]
+FEX=${1:-FEXInterpreter}
+ITERATIONS=${2:-1000}
+
+run() {
+	local start end
+	start=$(date +%s%N)
+	for ((i = 0; i < ITERATIONS; i++)); do
+		"$FEX" /bin/sh -c true || exit 1
+	done
+	end=$(date +%s%N)
+
+	local total_ms=$(( (end - start) / 1000000 ))
+	echo "$1: ${total_ms} ms total, $(( total_ms * 1000 / ITERATIONS )) us per run"
+}
+
+echo Using $FEX, $ITERATIONS iterations
+
+# First run populates the page cache and the FEXServer's AOTIR images
+"$FEX" /bin/sh -c true || exit 1
+
+FEX_AOTIRLOAD=1 run "AOTIR load"
+FEX_AOTIRLOAD=0 run "No AOTIR"
@@ -0,0 +1,68 @@
+#!/usr/bin/python3
+import json
+import sys
+
+# Args: <Baseline FEXBench.json> <New FEXBench.json> [Threshold percent, default 5]
+# Prints the per stage totals and the entries that regressed the most
+# Returns 1 if any stage total regressed by more than the threshold
+
+if (len(sys.argv) < 3):
+    print("Usage: {} <Baseline.json> <New.json> [Threshold percent]".format(sys.argv[0]))
+    sys.exit(-1)
+
+with open(sys.argv[1]) as f:
+    baseline = json.load(f)
+
+with open(sys.argv[2]) as f:
+    new = json.load(f)
+
+threshold = float(sys.argv[3]) if len(sys.argv) > 3 else 5.0
+
+if baseline["Config"] != new["Config"]:
+    print("Warning: Configs differ {} vs {}".format(baseline["Config"], new["Config"]))
+
+def percent(old, new):
+    if old == 0:
+        return 0.0 if new == 0 else 100.0
+    return (new - old) * 100.0 / old
+
+regressed = False
+
+print("{:<16} {:>14} {:>14} {:>9}".format("Stage", "Baseline ns", "New ns", "Change"))
+base_stages = baseline["Total"]["Stages"]
+new_stages = new["Total"]["Stages"]
+for stage in list(base_stages) + [s for s in new_stages if s not in base_stages]:
+    old_ns = base_stages.get(stage, 0)
+    new_ns = new_stages.get(stage, 0)
+    change = percent(old_ns, new_ns)
+    marker = ""
+    if change > threshold:
+        marker = " <- regressed"
+        regressed = True
+    print("{:<16} {:>14} {:>14} {:>8.2f}%{}".format(stage, old_ns, new_ns, change, marker))
+
+old_total = baseline["Total"]["TotalNS"]
+new_total = new["Total"]["TotalNS"]
+print("{:<16} {:>14} {:>14} {:>8.2f}%".format("Total", old_total, new_total, percent(old_total, new_total)))
+
+for key in ["Blocks", "GuestInstructions", "HostCodeBytes"]:
+    if baseline["Total"][key] != new["Total"][key]:
+        print("{} changed: {} -> {}".format(key, baseline["Total"][key], new["Total"][key]))
+
+# Entries only count if they exist in both runs
+base_entries = {entry["Name"]: entry for entry in baseline["Entries"]}
+changes = []
+for entry in new["Entries"]:
+    if entry["Name"] in base_entries:
+        old_ns = base_entries[entry["Name"]]["TotalNS"]
+        changes.append((entry["TotalNS"] - old_ns, entry["Name"], old_ns, entry["TotalNS"]))
+
+changes.sort(reverse=True)
+if len(changes) > 0 and changes[0][0] > 0:
+    print("\nLargest regressions:")
+    for delta, name, old_ns, new_ns in changes[:20]:
+        if delta <= 0:
+            break
+        print("  {:<60} {:>10} -> {:>10} ({:+.2f}%)".format(name, old_ns, new_ns, percent(old_ns, new_ns)))
+
+sys.exit(1 if regressed else 0)
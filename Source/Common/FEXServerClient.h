@@ -4,6 +4,7 @@
 #include <FEXHeaderUtils/Syscalls.h>
 
 #include <string>
+#include <string_view>
 
 namespace FEXServerClient {
   enum class PacketType {
@@ -16,6 +17,10 @@ namespace FEXServerClient {
     // Result only
     TYPE_SUCCESS,
     TYPE_ERROR,
+
+    // Request and Result
+    // New types go at the end so the values of the ones above don't change
+    TYPE_GET_AOTIR_FD,
   };
 
   union FEXServerRequestPacket {
@@ -26,6 +31,13 @@ namespace FEXServerClient {
     struct {
       struct Header Header;
     } BasicRequest;
+
+    // Followed by the FileId string, not null terminated
+    struct {
+      struct Header Header;
+      size_t Length;
+      char FileId[0];
+    } AOTIRRequest;
   };
 
   union FEXServerResultPacket {
@@ -104,6 +116,20 @@ namespace FEXServerClient {
    */
   int RequestPIDFD(int ServerSocket);
 
+  /**
+   * @brief Request a read-only FD to an AOTIR cache file from the FEXServer
+   *
+   * The server opens the cache file itself, so every process maps the same page cache pages.
+   * Each returned FD has its own file offset.
+   *
+   * Every request uses its own connection, the main server socket is shared with forked children.
+   *
+   * @param FileId - AOTIR FileId of the library
+   *
+   * @return FD to the cache file or -1 if there isn't one
+   */
+  int RequestAOTIRFD(std::string_view FileId);
+
   /**  @} */
 
   /**
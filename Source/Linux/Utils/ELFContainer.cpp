@@ -6,16 +6,22 @@ $end_info$
 */
 
 #include "Linux/Utils/ELFContainer.h"
+#include <FEXCore/Utils/Allocator.h>
 #include <FEXCore/Utils/LogManager.h>
 #include <FEXCore/Utils/MathUtils.h>
 
 #include <algorithm>
 #include <cstring>
 #include <elf.h>
+#include <fcntl.h>
 #include <filesystem>
 #include <fstream>
+#include <iterator>
 #include <memory>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include <system_error>
+#include <unistd.h>
 #include <vector>
 
 namespace ELFLoader {
@@ -85,7 +91,8 @@ ELFContainer::ELFContainer(std::string const &Filename, std::string const &RootF
     // If we we are dynamic application then we have an interpreter program header
     // We need to load that ELF instead if it exists
     // We are no longer dynamic since we are executing the interpreter
-    const char *RawString{};
+    // Copy the path out, loading the interpreter replaces the current mapping
+    std::string RawString{};
     if (Mode == MODE_32BIT) {
       RawString = &RawFile.at(InterpreterHeader._32->p_offset);
     }
@@ -122,7 +129,6 @@ ELFContainer::ELFContainer(std::string const &Filename, std::string const &RootF
 
 
   CalculateMemoryLayouts();
-  CalculateSymbols();
 
   // Print Information
   // PrintHeader();
@@ -138,7 +144,7 @@ ELFContainer::ELFContainer(std::string const &Filename, std::string const &RootF
 
 ELFContainer::~ELFContainer() {
   NecessaryLibs.clear();
-  SymbolMapByAddress.clear();
+  SymbolsByAddress.clear();
   SymbolMap.clear();
   Symbols.clear();
   ProgramHeaders.clear();
@@ -146,19 +152,71 @@ ELFContainer::~ELFContainer() {
   RawFile.clear();
 }
 
-bool ELFContainer::LoadELF(std::string const &Filename) {
-  std::fstream ELFFile(Filename, std::fstream::in | std::fstream::binary);
+bool MappedFile::Open(std::string const &Filename) {
+  int FD = open(Filename.c_str(), O_RDONLY | O_CLOEXEC);
+  if (FD == -1) {
+    return false;
+  }
 
-  if (!ELFFile.is_open())
+  struct stat Stat{};
+  if (fstat(FD, &Stat) == -1 || Stat.st_size == 0) {
+    close(FD);
     return false;
+  }
 
-  ELFFile.seekg(0, ELFFile.end);
-  size_t FileSize = ELFFile.tellg();
-  ELFFile.seekg(0, ELFFile.beg);
+  // Private and writable so it behaves like the copy we used to read in, pages only get copied if written
+  void *Ptr = FEXCore::Allocator::mmap(nullptr, Stat.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, FD, 0);
+  close(FD);
 
-  RawFile.resize(FileSize);
-  ELFFile.read(RawFile.data(), FileSize);
-  ELFFile.close();
+  if (Ptr == MAP_FAILED) {
+    return false;
+  }
+
+  clear();
+  Data = static_cast<char*>(Ptr);
+  Size = Stat.st_size;
+  return true;
+}
+
+void MappedFile::clear() {
+  if (Data) {
+    FEXCore::Allocator::munmap(Data, Size);
+  }
+  Data = nullptr;
+  Size = 0;
+}
+
+void SortSymbolsByAddress(std::vector<ELFSymbol *> *Table) {
+  std::stable_sort(Table->begin(), Table->end(), [](ELFSymbol const *Lhs, ELFSymbol const *Rhs) {
+    return Lhs->Address < Rhs->Address;
+  });
+
+  // Multiple symbols can share an address, the last one added wins
+  auto Out = Table->begin();
+  for (auto It = Table->begin(); It != Table->end(); ++It) {
+    auto Next = std::next(It);
+    if (Next == Table->end() || (*Next)->Address != (*It)->Address) {
+      *Out++ = *It;
+    }
+  }
+  Table->erase(Out, Table->end());
+}
+
+ELFSymbol *FindSymbolBeforeAddress(std::vector<ELFSymbol *> const &Table, uint64_t Address) {
+  // Last symbol starting at or before the address, or the first symbol if there is none
+  auto Sym = std::upper_bound(Table.begin(), Table.end(), Address, [](uint64_t Address, ELFSymbol const *Symbol) {
+    return Address < Symbol->Address;
+  });
+  if (Sym != Table.begin())
+    --Sym;
+  if (Sym == Table.end())
+    return nullptr;
+  return *Sym;
+}
+
+bool ELFContainer::LoadELF(std::string const &Filename) {
+  if (!RawFile.Open(Filename))
+    return false;
 
   InterpreterHeader._64 = nullptr;
 
@@ -297,28 +355,29 @@ void ELFContainer::WriteLoadableSections(MemoryWriter Writer, uint64_t Offset) {
 }
 
 ELFSymbol const *ELFContainer::GetSymbol(char const *Name) {
+  CalculateSymbols();
   auto Sym = SymbolMap.find(Name);
   if (Sym == SymbolMap.end())
     return nullptr;
   return Sym->second;
 }
 ELFSymbol const *ELFContainer::GetSymbol(uint64_t Address) {
-  auto Sym = SymbolMapByAddress.find(Address);
-  if (Sym == SymbolMapByAddress.end())
+  CalculateSymbols();
+  auto Sym = FindSymbolBeforeAddress(SymbolsByAddress, Address);
+  if (!Sym || Sym->Address != Address)
     return nullptr;
-  return Sym->second;
+  return Sym;
 }
 ELFSymbol const *ELFContainer::GetSymbolInRange(RangeType Address) {
-  auto Sym = SymbolMapByAddress.upper_bound(Address.first);
-  if (Sym != SymbolMapByAddress.begin())
-    --Sym;
-  if (Sym == SymbolMapByAddress.end())
+  CalculateSymbols();
+  auto Sym = FindSymbolBeforeAddress(SymbolsByAddress, Address.first);
+  if (!Sym)
     return nullptr;
 
-  if ((Sym->second->Address + Sym->second->Size) < Address.first)
+  if ((Sym->Address + Sym->Size) < Address.first)
     return nullptr;
 
-  return Sym->second;
+  return Sym;
 }
 
 void ELFContainer::CalculateMemoryLayouts() {
@@ -369,6 +428,11 @@ void ELFContainer::CalculateMemoryLayouts() {
 }
 
 void ELFContainer::CalculateSymbols() {
+  if (SymbolsCalculated) {
+    return;
+  }
+  SymbolsCalculated = true;
+
   // Find the symbol table
   if (Mode == MODE_32BIT) {
     Elf32_Shdr const *SymTabHeader{nullptr};
@@ -427,6 +491,8 @@ void ELFContainer::CalculateSymbols() {
     uint64_t NumSymbols = NumSymTabSymbols + NumDynSymSymbols;
 
     Symbols.resize(NumSymbols);
+    SymbolMap.reserve(NumSymbols);
+    SymbolsByAddress.reserve(NumSymbols);
     for (uint64_t i = 0; i < NumSymTabSymbols; ++i) {
       uint64_t offset = SymTabHeader->sh_offset + i * SymTabHeader->sh_entsize;
       Elf32_Sym const *Symbol =
@@ -445,7 +511,7 @@ void ELFContainer::CalculateSymbols() {
           DefinedSymbol->SectionIndex = Symbol->st_shndx;
 
           SymbolMap[DefinedSymbol->Name] = DefinedSymbol;
-          SymbolMapByAddress[DefinedSymbol->Address] = DefinedSymbol;
+          SymbolsByAddress.emplace_back(DefinedSymbol);
         }
       }
     }
@@ -468,38 +534,8 @@ void ELFContainer::CalculateSymbols() {
           DefinedSymbol->SectionIndex = Symbol->st_shndx;
 
           SymbolMap[DefinedSymbol->Name] = DefinedSymbol;
-          SymbolMapByAddress[DefinedSymbol->Address] = DefinedSymbol;
-        }
-      }
-    }
-
-    Elf32_Shdr const *StrHeader = SectionHeaders.at(Header._32.e_shstrndx)._32;
-    char const *SHStrings = &RawFile.at(StrHeader->sh_offset);
-    for (uint32_t i = 0; i < SectionHeaders.size(); ++i) {
-      Elf32_Shdr const *hdr = SectionHeaders.at(i)._32;
-      if (strcmp(&SHStrings[hdr->sh_name], ".eh_frame_hdr") == 0) {
-        auto eh_frame_hdr = &RawFile.at(hdr->sh_offset);
-        // we only handle this specific unwind table encoding
-        if (eh_frame_hdr[0] == 1 && eh_frame_hdr[1] == 0x1B && eh_frame_hdr[2] == 0x3 && eh_frame_hdr[3] == 0x3b) {
-          // ptr enc : 4 bytes, signed, pcrel
-          // fde count : 4 bytes udata
-          // table enc : 4 bytes, signed, datarel
-          int fde_count = *(int*)(eh_frame_hdr + 8);
-          UnwindEntries.clear();
-          UnwindEntries.reserve(fde_count);
-
-          struct entry {
-            int32_t pc;
-            int32_t fde;
-          };
-
-          entry *Table = (entry*)(eh_frame_hdr+12);
-          for (int f = 0; f < fde_count; f++) {
-            uintptr_t Entry = (uintptr_t)(Table[f].pc + hdr->sh_offset);
-            UnwindEntries.push_back(Entry);
-          }
+          SymbolsByAddress.emplace_back(DefinedSymbol);
         }
-        break;
       }
     }
   }
@@ -560,6 +596,8 @@ void ELFContainer::CalculateSymbols() {
     uint64_t NumSymbols = NumSymTabSymbols + NumDynSymSymbols;
 
     Symbols.resize(NumSymbols);
+    SymbolMap.reserve(NumSymbols);
+    SymbolsByAddress.reserve(NumSymbols);
     for (uint64_t i = 0; i < NumSymTabSymbols; ++i) {
       uint64_t offset = SymTabHeader->sh_offset + i * SymTabHeader->sh_entsize;
       Elf64_Sym const *Symbol =
@@ -578,7 +616,7 @@ void ELFContainer::CalculateSymbols() {
           DefinedSymbol->SectionIndex = Symbol->st_shndx;
 
           SymbolMap[DefinedSymbol->Name] = DefinedSymbol;
-          SymbolMapByAddress[DefinedSymbol->Address] = DefinedSymbol;
+          SymbolsByAddress.emplace_back(DefinedSymbol);
         }
       }
     }
@@ -601,11 +639,53 @@ void ELFContainer::CalculateSymbols() {
           DefinedSymbol->SectionIndex = Symbol->st_shndx;
 
           SymbolMap[DefinedSymbol->Name] = DefinedSymbol;
-          SymbolMapByAddress[DefinedSymbol->Address] = DefinedSymbol;
+          SymbolsByAddress.emplace_back(DefinedSymbol);
         }
       }
     }
+  }
+
+  SortSymbolsByAddress(&SymbolsByAddress);
+}
+
+void ELFContainer::CalculateUnwindEntries() {
+  if (UnwindEntriesCalculated) {
+    return;
+  }
+  UnwindEntriesCalculated = true;
+
+  if (Mode == MODE_32BIT) {
+    Elf32_Shdr const *StrHeader = SectionHeaders.at(Header._32.e_shstrndx)._32;
+    char const *SHStrings = &RawFile.at(StrHeader->sh_offset);
+    for (uint32_t i = 0; i < SectionHeaders.size(); ++i) {
+      Elf32_Shdr const *hdr = SectionHeaders.at(i)._32;
+      if (strcmp(&SHStrings[hdr->sh_name], ".eh_frame_hdr") == 0) {
+        auto eh_frame_hdr = &RawFile.at(hdr->sh_offset);
+        // we only handle this specific unwind table encoding
+        if (eh_frame_hdr[0] == 1 && eh_frame_hdr[1] == 0x1B && eh_frame_hdr[2] == 0x3 && eh_frame_hdr[3] == 0x3b) {
+          // ptr enc : 4 bytes, signed, pcrel
+          // fde count : 4 bytes udata
+          // table enc : 4 bytes, signed, datarel
+          int fde_count = *(int*)(eh_frame_hdr + 8);
+          UnwindEntries.clear();
+          UnwindEntries.reserve(fde_count);
 
+          struct entry {
+            int32_t pc;
+            int32_t fde;
+          };
+
+          entry *Table = (entry*)(eh_frame_hdr+12);
+          for (int f = 0; f < fde_count; f++) {
+            uintptr_t Entry = (uintptr_t)(Table[f].pc + hdr->sh_offset);
+            UnwindEntries.push_back(Entry);
+          }
+        }
+        break;
+      }
+    }
+  }
+  else {
     Elf64_Shdr const *StrHeader = SectionHeaders.at(Header._64.e_shstrndx)._64;
     char const *SHStrings = &RawFile.at(StrHeader->sh_offset);
     for (uint32_t i = 0; i < SectionHeaders.size(); ++i) {
@@ -678,6 +758,7 @@ void ELFContainer::GetDynamicLibs() {
 }
 
 void ELFContainer::AddSymbols(SymbolAdder Adder) {
+  CalculateSymbols();
   for (auto &Sym : Symbols) {
     if (Sym.FileOffset) {
       Adder(&Sym);
@@ -685,6 +766,7 @@ void ELFContainer::AddSymbols(SymbolAdder Adder) {
   }
 }
 void ELFContainer::AddUnwindEntries(UnwindAdder Adder) {
+  CalculateUnwindEntries();
   for (auto Entry : UnwindEntries) {
     Adder(Entry);
   }
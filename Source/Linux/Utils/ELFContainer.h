@@ -3,8 +3,8 @@
 #include <cstdint>
 #include <elf.h>
 #include <functional>
-#include <map>
 #include <stddef.h>
+#include <stdexcept>
 #include <string>
 #include <tuple>
 #include <unordered_map>
@@ -31,6 +31,45 @@ struct ELFSymbol {
   char const *Name;
 };
 
+/**
+ * @brief Private, copy-on-write mapping of a file on disk
+ *
+ * Replaces reading the whole file in to memory up front.
+ * Pages are only faulted in once something touches them, so large libraries where we only
+ * look at the headers and a few sections don't pay for the rest of the file.
+ */
+class MappedFile final {
+public:
+  MappedFile() = default;
+  MappedFile(MappedFile const &) = delete;
+  MappedFile &operator=(MappedFile const &) = delete;
+  ~MappedFile() { clear(); }
+
+  bool Open(std::string const &Filename);
+  void clear();
+
+  char *data() const { return Data; }
+  size_t size() const { return Size; }
+  bool empty() const { return Size == 0; }
+
+  char &at(size_t Offset) const {
+    if (Offset >= Size) {
+      throw std::out_of_range("MappedFile offset out of range");
+    }
+    return Data[Offset];
+  }
+
+private:
+  char *Data{};
+  size_t Size{};
+};
+
+// Sorts a symbol table by address, keeping the last symbol added for any shared address
+void SortSymbolsByAddress(std::vector<ELFSymbol *> *Table);
+// Returns the closest symbol at or below the address in a table sorted with SortSymbolsByAddress
+// Falls back to the first symbol when every symbol is above the address, callers check the range
+ELFSymbol *FindSymbolBeforeAddress(std::vector<ELFSymbol *> const &Table, uint64_t Address);
+
 class ELFContainer {
 public:
   ELFContainer(std::string const &Filename, std::string const &RootFS, bool CustomInterpreter);
@@ -127,7 +166,9 @@ private:
   bool LoadELF_32();
   bool LoadELF_64();
   void CalculateMemoryLayouts();
+  // Symbols and unwind entries are only parsed the first time something asks for them
   void CalculateSymbols();
+  void CalculateUnwindEntries();
   void GetDynamicLibs();
 
   // Information functions
@@ -138,7 +179,7 @@ private:
   void PrintInitArray() const;
   void PrintDynamicTable() const;
 
-  std::vector<char> RawFile;
+  MappedFile RawFile;
   union {
     Elf32_Ehdr _32;
     Elf64_Ehdr _64;
@@ -160,7 +201,10 @@ private:
   std::vector<ELFSymbol> Symbols;
   std::vector<uintptr_t> UnwindEntries;
   std::unordered_map<std::string, ELFSymbol *> SymbolMap;
-  std::map<uint64_t, ELFSymbol *> SymbolMapByAddress;
+  // Sorted by address, one entry per address
+  std::vector<ELFSymbol *> SymbolsByAddress;
+  bool SymbolsCalculated{false};
+  bool UnwindEntriesCalculated{false};
 
   std::vector<char const*> NecessaryLibs;
 
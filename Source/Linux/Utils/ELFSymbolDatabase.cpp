@@ -230,11 +230,14 @@ void ELFSymbolDatabase::FillInitializationOrder() {
 }
 
 void ELFSymbolDatabase::FillSymbols() {
+  // Addresses get rebased on every fill, drop the previous lookup table
+  SymbolsByAddress.clear();
+
   auto LocalSymbolFiller = [this](ELFLoader::ELFSymbol *Symbol) {
     Symbols.emplace_back(Symbol);
     Symbol->Address += LocalInfo.GuestBase;
     SymbolMap[Symbol->Name] = Symbol;
-    SymbolMapByAddress[Symbol->Address] = Symbol;
+    SymbolsByAddress.emplace_back(Symbol);
     if (Symbol->Bind == STB_GLOBAL) {
       SymbolMapGlobalOnly[Symbol->Name] = Symbol;
     }
@@ -253,7 +256,7 @@ void ELFSymbolDatabase::FillSymbols() {
       Symbol->Address += ELF->GuestBase;
       SymbolMap[Symbol->Name] = Symbol;
       SymbolMapNoMain[Symbol->Name] = Symbol;
-      SymbolMapByAddress[Symbol->Address] = Symbol;
+      SymbolsByAddress.emplace_back(Symbol);
       if (Symbol->Bind == STB_GLOBAL) {
         SymbolMapGlobalOnly[Symbol->Name] = Symbol;
       }
@@ -266,6 +269,7 @@ void ELFSymbolDatabase::FillSymbols() {
     ELF->Container->AddSymbols(SymbolFiller);
   }
 
+  SortSymbolsByAddress(&SymbolsByAddress);
 }
 
 void ELFSymbolDatabase::MapMemoryRegions(std::function<void*(uint64_t, uint64_t, bool)> Mapper) {
@@ -330,19 +334,17 @@ uint64_t ELFSymbolDatabase::DefaultRIP() const {
 }
 
 ELFSymbol const *ELFSymbolDatabase::GetSymbolInRange(RangeType Address) {
-  auto Sym = SymbolMapByAddress.upper_bound(Address.first);
-  if (Sym != SymbolMapByAddress.begin())
-    --Sym;
-  if (Sym == SymbolMapByAddress.end())
+  auto Sym = FindSymbolBeforeAddress(SymbolsByAddress, Address.first);
+  if (!Sym)
     return nullptr;
 
-  if ((Sym->second->Address + Sym->second->Size) < Address.first)
+  if ((Sym->Address + Sym->Size) < Address.first)
     return nullptr;
 
-  if (Sym->second->Address > Address.first)
+  if (Sym->Address > Address.first)
     return nullptr;
 
-  return Sym->second;
+  return Sym;
 }
 
 void ELFSymbolDatabase::GetInitLocations(std::vector<uint64_t> *Locations) {
@@ -4,7 +4,6 @@
 
 #include <cstdint>
 #include <functional>
-#include <map>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -59,7 +58,8 @@ private:
   SymbolTableType SymbolMapNoWeak;
   SymbolTableType SymbolMapNoMain;
   SymbolTableType SymbolMapNoMainNoWeak;
-  std::map<uint64_t, ELFLoader::ELFSymbol *> SymbolMapByAddress;
+  // Sorted with SortSymbolsByAddress once all symbols are filled
+  std::vector<ELFLoader::ELFSymbol *> SymbolsByAddress;
 
   bool FindLibraryFile(std::string *Result, const char *Library);
   void FillLibrarySearchPaths();
@@ -0,0 +1,434 @@
+/*
+$info$
+tags: Bin|FEXBench
+desc: Measures JIT compile time per stage over the ASM and IR test corpus
+$end_info$
+*/
+
+#include "Common/ArgumentLoader.h"
+#include "HarnessHelpers.h"
+#include "Tests/LinuxSyscalls/Syscalls.h"
+#include "Tests/LinuxSyscalls/x64/Syscalls.h"
+#include "Tests/LinuxSyscalls/SignalDelegator.h"
+
+#include <FEXCore/Config/Config.h>
+#include <FEXCore/Core/Context.h>
+#include <FEXCore/Core/CoreState.h>
+#include <FEXCore/Core/HostFeatures.h>
+#include <FEXCore/Debug/InternalThreadState.h>
+#include <FEXCore/IR/IR.h>
+#include <FEXCore/IR/IREmitter.h>
+#include <FEXCore/Utils/Allocator.h>
+#include <FEXCore/Utils/LogManager.h>
+#include <FEXCore/Utils/ThreadPoolAllocator.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <stdio.h>
+#include <string>
+#include <string_view>
+#include <sys/mman.h>
+#include <vector>
+
+#include <fmt/format.h>
+
+void MsgHandler(LogMan::DebugLevels Level, char const *Message) {
+  const char *CharLevel{nullptr};
+
+  switch (Level) {
+  case LogMan::NONE:
+    CharLevel = "NONE";
+    break;
+  case LogMan::ASSERT:
+    CharLevel = "ASSERT";
+    break;
+  case LogMan::ERROR:
+    CharLevel = "ERROR";
+    break;
+  case LogMan::DEBUG:
+    CharLevel = "DEBUG";
+    break;
+  case LogMan::INFO:
+    CharLevel = "Info";
+    break;
+  default:
+    CharLevel = "???";
+    break;
+  }
+  fmt::print(stderr, "[{}] {}\n", CharLevel, Message);
+}
+
+void AssertHandler(char const *Message) {
+  fmt::print(stderr, "[ASSERT] {}\n", Message);
+
+  // make sure buffers are flushed
+  fflush(nullptr);
+}
+
+namespace {
+  // Custom IR entrypoints don't read guest memory, they only need to not collide with each other
+  constexpr uint64_t IR_ENTRY_BASE = 0x4000'0000;
+
+  struct CorpusEntry {
+    std::string Name;
+    std::filesystem::path Path;
+    bool IsIR;
+  };
+
+  // Per iteration results for one corpus entry, every field is the median across iterations
+  struct EntryResult {
+    std::string Name;
+    uint64_t Blocks;
+    uint64_t GuestInstructions;
+    uint64_t HostCodeBytes;
+    uint64_t TotalNS;
+    std::vector<uint64_t> StageNS;
+  };
+
+  bool EndsWith(std::string_view String, std::string_view Suffix) {
+    return String.size() >= Suffix.size() && String.substr(String.size() - Suffix.size()) == Suffix;
+  }
+
+  // ASM tests get picked up from the build directory as assembled binaries, IR tests straight from the source tree
+  void GatherCorpus(std::string const &Arg, std::vector<CorpusEntry> *Corpus) {
+    auto AddFile = [Corpus](std::filesystem::path const &Path, std::filesystem::path const &Root) {
+      const auto Filename = Path.filename().string();
+      const bool IsASM = EndsWith(Filename, ".asm.bin");
+      const bool IsIR = EndsWith(Filename, ".ir");
+      if (!IsASM && !IsIR) {
+        return;
+      }
+
+      auto Name = Root.empty() ? Filename : std::filesystem::relative(Path, Root).string();
+      if (IsASM) {
+        Name.erase(Name.size() - 4);
+      }
+      Corpus->emplace_back(CorpusEntry{std::move(Name), Path, IsIR});
+    };
+
+    std::error_code ec{};
+    if (std::filesystem::is_directory(Arg, ec)) {
+      for (auto &Entry : std::filesystem::recursive_directory_iterator(Arg, ec)) {
+        if (Entry.is_regular_file()) {
+          AddFile(Entry.path(), Arg);
+        }
+      }
+    }
+    else {
+      AddFile(Arg, {});
+    }
+  }
+
+  std::string EscapeJSON(std::string_view String) {
+    std::string Result;
+    for (char c : String) {
+      if (c == '"' || c == '\\') {
+        Result += '\\';
+      }
+      Result += c;
+    }
+    return Result;
+  }
+
+  uint64_t Median(std::vector<uint64_t> &Samples) {
+    std::nth_element(Samples.begin(), Samples.begin() + Samples.size() / 2, Samples.end());
+    return Samples[Samples.size() / 2];
+  }
+
+  class Bench final {
+  public:
+    Bench(FEXCore::Core::InternalThreadState *Thread, uint32_t Iterations)
+      : Thread {Thread}
+      , Iterations {Iterations} {
+      Thread->CompileStats = std::make_unique<FEXCore::Core::CompileTimingStats>();
+    }
+
+    // Compiles the entrypoint once to warm up and then Iterations times from scratch, collecting the stage times of each compile
+    void Measure(std::string const &Name, uint64_t RIP) {
+      FEXCore::Context::CompileRIP(Thread, RIP);
+
+      auto Stats = Thread->CompileStats.get();
+      std::vector<std::vector<uint64_t>> StageSamples;
+      std::vector<uint64_t> TotalSamples;
+
+      for (uint32_t i = 0; i < Iterations; ++i) {
+        // Drop the block from the LookupCache, otherwise CompileRIP finds it and returns without compiling
+        FEXCore::Context::InvalidateGuestCodeRange(Thread->CTX, RIP, 1);
+
+        ResetStats();
+        FEXCore::Context::CompileRIP(Thread, RIP);
+
+        auto Stages = GetStages();
+        StageSamples.resize(Stages.size());
+        uint64_t Total{};
+        for (size_t Stage = 0; Stage < Stages.size(); ++Stage) {
+          StageSamples[Stage].emplace_back(Stages[Stage]);
+          Total += Stages[Stage];
+        }
+        TotalSamples.emplace_back(Total);
+      }
+
+      if (!Stats->BlocksCompiled) {
+        LogMan::Msg::EFmt("{}: Failed to compile", Name);
+        ++Failed;
+        return;
+      }
+
+      EntryResult Result {
+        .Name = Name,
+        .Blocks = Stats->BlocksCompiled,
+        .GuestInstructions = Stats->GuestInstructions,
+        .HostCodeBytes = Stats->HostCodeBytes,
+        .TotalNS = Median(TotalSamples),
+      };
+
+      for (auto &Samples : StageSamples) {
+        Result.StageNS.emplace_back(Median(Samples));
+      }
+
+      Results.emplace_back(std::move(Result));
+    }
+
+    void Skip() {
+      ++Skipped;
+    }
+
+    std::string ToJSON(std::string_view CoreName, bool Multiblock) const {
+      const auto StageNames = GetStageNames();
+      std::vector<uint64_t> TotalStageNS(StageNames.size());
+      uint64_t TotalBlocks{}, TotalInstructions{}, TotalHostCodeBytes{}, TotalNS{};
+
+      for (auto &Result : Results) {
+        TotalBlocks += Result.Blocks;
+        TotalInstructions += Result.GuestInstructions;
+        TotalHostCodeBytes += Result.HostCodeBytes;
+        TotalNS += Result.TotalNS;
+        for (size_t i = 0; i < Result.StageNS.size() && i < TotalStageNS.size(); ++i) {
+          TotalStageNS[i] += Result.StageNS[i];
+        }
+      }
+
+      auto StagesToJSON = [&StageNames](std::vector<uint64_t> const &StageNS) {
+        std::string Out = "{";
+        for (size_t i = 0; i < StageNames.size() && i < StageNS.size(); ++i) {
+          Out += fmt::format("{}\"{}\": {}", i ? ", " : "", StageNames[i], StageNS[i]);
+        }
+        return Out + "}";
+      };
+
+      // Key order is fixed and entries are sorted by name so results diff cleanly between commits
+      std::string Out;
+      Out += "{\n";
+      Out += "  \"Version\": 1,\n";
+      Out += fmt::format("  \"Config\": {{\"Core\": \"{}\", \"Multiblock\": {}, \"Iterations\": {}}},\n", CoreName, Multiblock ? "true" : "false", Iterations);
+      Out += fmt::format("  \"Skipped\": {},\n", Skipped);
+      Out += fmt::format("  \"Failed\": {},\n", Failed);
+      Out += fmt::format("  \"Total\": {{\"Entries\": {}, \"Blocks\": {}, \"GuestInstructions\": {}, \"HostCodeBytes\": {}, \"TotalNS\": {}, \"Stages\": {}}},\n",
+        Results.size(), TotalBlocks, TotalInstructions, TotalHostCodeBytes, TotalNS, StagesToJSON(TotalStageNS));
+      Out += "  \"Entries\": [\n";
+      for (size_t i = 0; i < Results.size(); ++i) {
+        auto &Result = Results[i];
+        Out += fmt::format("    {{\"Name\": \"{}\", \"Blocks\": {}, \"GuestInstructions\": {}, \"HostCodeBytes\": {}, \"TotalNS\": {}, \"Stages\": {}}}{}\n",
+          EscapeJSON(Result.Name), Result.Blocks, Result.GuestInstructions, Result.HostCodeBytes, Result.TotalNS, StagesToJSON(Result.StageNS),
+          i + 1 == Results.size() ? "" : ",");
+      }
+      Out += "  ]\n";
+      Out += "}\n";
+      return Out;
+    }
+
+  private:
+    void ResetStats() {
+      auto Stats = Thread->CompileStats.get();
+      auto Passes = std::move(Stats->Passes);
+      *Stats = {};
+      for (auto &Pass : Passes) {
+        Pass.TimeNS = 0;
+      }
+      Stats->Passes = std::move(Passes);
+    }
+
+    // Decode, Dispatch, each IR pass in order, Backend
+    std::vector<uint64_t> GetStages() const {
+      auto Stats = Thread->CompileStats.get();
+      std::vector<uint64_t> Stages;
+      Stages.emplace_back(Stats->DecodeNS);
+      Stages.emplace_back(Stats->DispatchNS);
+      for (auto &Pass : Stats->Passes) {
+        Stages.emplace_back(Pass.TimeNS);
+      }
+      Stages.emplace_back(Stats->BackendNS);
+      return Stages;
+    }
+
+    std::vector<std::string> GetStageNames() const {
+      auto Stats = Thread->CompileStats.get();
+      std::vector<std::string> Names;
+      Names.emplace_back("Decode");
+      Names.emplace_back("Dispatch");
+      for (size_t i = 0; i < Stats->Passes.size(); ++i) {
+        auto &Name = Stats->Passes[i].Name;
+        Names.emplace_back(Name.empty() ? fmt::format("Pass{}", i) : Name);
+      }
+      Names.emplace_back("Backend");
+      return Names;
+    }
+
+    FEXCore::Core::InternalThreadState *Thread;
+    uint32_t Iterations;
+
+    std::vector<EntryResult> Results;
+    uint64_t Skipped{};
+    uint64_t Failed{};
+  };
+}
+
+int main(int argc, char **argv, char **const envp) {
+  LogMan::Throw::InstallHandler(AssertHandler);
+  LogMan::Msg::InstallHandler(MsgHandler);
+  FEXCore::Config::Initialize();
+  FEXCore::Config::AddLayer(std::make_unique<FEX::ArgLoader::ArgLoader>(argc, argv));
+  FEXCore::Config::AddLayer(FEXCore::Config::CreateEnvironmentLayer(envp));
+  FEXCore::Config::Load();
+
+  auto Args = FEX::ArgLoader::Get();
+
+  if (Args.size() < 3) {
+    LogMan::Msg::EFmt("Usage: FEXBench [FEX options] <Output.json|-> <Iterations> <Test file or directory>...");
+    return -1;
+  }
+
+  const auto &OutputPath = Args[0];
+  const uint32_t Iterations = std::max(1UL, std::stoul(Args[1]));
+
+  std::vector<CorpusEntry> Corpus;
+  for (size_t i = 2; i < Args.size(); ++i) {
+    GatherCorpus(Args[i], &Corpus);
+  }
+
+  std::sort(Corpus.begin(), Corpus.end(), [](CorpusEntry const &a, CorpusEntry const &b) {
+    return a.Name < b.Name;
+  });
+
+  // Mode is baked in to the static tables, only the 64-bit corpus is measured
+  FEXCore::Config::Set(FEXCore::Config::CONFIG_IS64BIT_MODE, "1");
+
+  FEX_CONFIG_OPT(Core, CORE);
+  FEX_CONFIG_OPT(Multiblock, MULTIBLOCK);
+
+  if (Core == FEXCore::Config::CONFIG_CUSTOM) {
+    LogMan::Msg::EFmt("FEXBench needs a FEX core, not host");
+    return -1;
+  }
+
+  FEXCore::Context::InitializeStaticTables(FEXCore::Context::MODE_64BIT);
+  auto CTX = FEXCore::Context::CreateNewContext();
+  FEXCore::Context::InitializeContext(CTX);
+
+  auto HostFeatures = FEXCore::Context::GetHostFeatures(CTX);
+  auto SignalDelegation = std::make_unique<FEX::HLE::SignalDelegator>();
+  auto SyscallHandler = FEX::HLE::x64::CreateHandler(CTX, SignalDelegation.get());
+
+  FEXCore::Context::SetSignalDelegator(CTX, SignalDelegation.get());
+  FEXCore::Context::SetSyscallHandler(CTX, SyscallHandler.get());
+
+  auto Mapper = std::bind_front(&FEX::HLE::SyscallHandler::GuestMmap, SyscallHandler.get());
+  auto Unmapper = std::bind_front(&FEX::HLE::SyscallHandler::GuestMunmap, SyscallHandler.get());
+
+  // The thread never runs, it only provides the compiler state
+  auto StackPointer = reinterpret_cast<uint64_t>(FEXCore::Allocator::mmap(nullptr, FHU::FEX_PAGE_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0)) + FHU::FEX_PAGE_SIZE;
+  auto Thread = FEXCore::Context::InitCore(CTX, IR_ENTRY_BASE, StackPointer);
+  if (!Thread) {
+    LogMan::Msg::EFmt("Couldn't initialize the core");
+    return -1;
+  }
+
+  Bench Benchmark(Thread, Iterations);
+
+  FEXCore::Utils::PooledAllocatorMalloc IRAllocator;
+  std::vector<std::unique_ptr<FEXCore::IR::IREmitter>> ParsedIR;
+
+  for (auto &Entry : Corpus) {
+    if (Entry.IsIR) {
+      std::fstream fp(Entry.Path, std::fstream::binary | std::fstream::in);
+      auto IR = fp.is_open() ? FEXCore::IR::Parse(IRAllocator, &fp) : nullptr;
+      if (!IR) {
+        LogMan::Msg::EFmt("{}: Couldn't parse IR", Entry.Name);
+        Benchmark.Skip();
+        continue;
+      }
+
+      const uint64_t RIP = IR_ENTRY_BASE + ParsedIR.size() * FHU::FEX_PAGE_SIZE;
+      FEXCore::Context::AddCustomIREntrypoint(CTX, RIP, [IRPtr = IR.get()](uintptr_t Entrypoint, FEXCore::IR::IREmitter *emit) {
+        emit->CopyData(*IRPtr);
+      });
+      ParsedIR.emplace_back(std::move(IR));
+
+      Benchmark.Measure(Entry.Name, RIP);
+      continue;
+    }
+
+    auto ConfigPath = Entry.Path.string();
+    ConfigPath.erase(ConfigPath.size() - 4);
+    ConfigPath += ".config.bin";
+
+    FEX::HarnessHelper::HarnessCodeLoader Loader{Entry.Path.string(), ConfigPath.c_str()};
+
+    const bool TestUnsupported =
+      !Loader.Is64BitMode() ||
+      (!HostFeatures.Supports3DNow && Loader.Requires3DNow()) ||
+      (!HostFeatures.SupportsSSE4A && Loader.RequiresSSE4A()) ||
+      (!HostFeatures.SupportsAVX && Loader.RequiresAVX()) ||
+      (!HostFeatures.SupportsRAND && Loader.RequiresRAND()) ||
+      (!HostFeatures.SupportsSHA && Loader.RequiresSHA()) ||
+      (!HostFeatures.SupportsCLZERO && Loader.RequiresCLZERO()) ||
+      (!HostFeatures.SupportsBMI1 && Loader.RequiresBMI1()) ||
+      (!HostFeatures.SupportsBMI2 && Loader.RequiresBMI2());
+
+    if (TestUnsupported) {
+      Benchmark.Skip();
+      continue;
+    }
+
+    // Every test loads at the same address, drop whatever the previous test left behind
+    Loader.MapMemory(Mapper, Unmapper);
+    FEXCore::Context::InvalidateGuestCodeRange(CTX, Loader.DefaultRIP(), FEXCore::AlignUp(Loader.CodeSize(), FHU::FEX_PAGE_SIZE));
+
+    Benchmark.Measure(Entry.Name, Loader.DefaultRIP());
+  }
+
+  const auto CoreName = Core == FEXCore::Config::CONFIG_INTERPRETER ? "irint" : "irjit";
+  const auto Output = Benchmark.ToJSON(CoreName, Multiblock());
+
+  int Return = 0;
+  if (OutputPath == "-") {
+    fmt::print("{}", Output);
+  }
+  else {
+    std::ofstream File(OutputPath, std::ios::out | std::ios::trunc);
+    if (File) {
+      File << Output;
+    }
+    else {
+      LogMan::Msg::EFmt("Couldn't write {}", OutputPath);
+      Return = -1;
+    }
+  }
+
+  SyscallHandler.reset();
+
+  FEXCore::Context::DestroyContext(CTX);
+  FEXCore::Context::ShutdownStaticTables();
+
+  SignalDelegation.reset();
+
+  FEXCore::Config::Shutdown();
+
+  LogMan::Throw::UnInstallHandlers();
+  LogMan::Msg::UnInstallHandlers();
+
+  return Return;
+}
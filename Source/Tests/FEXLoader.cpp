@@ -10,6 +10,7 @@ $end_info$
 #include "Common/FEXServerClient.h"
 #include "ELFCodeLoader2.h"
 #include "VDSO_Emulation.h"
+#include "Tests/LinuxSyscalls/AsyncLogger.h"
 #include "Tests/LinuxSyscalls/LinuxAllocator.h"
 #include "Tests/LinuxSyscalls/Syscalls.h"
 #include "Tests/LinuxSyscalls/x32/Syscalls.h"
@@ -111,17 +112,6 @@ void AssertHandler(char const *Message) {
 
 } // Anonymous namespace
 
-namespace FEXServerLogging {
-  int FEXServerFD{};
-  void MsgHandler(LogMan::DebugLevels Level, char const *Message) {
-    FEXServerClient::MsgHandler(FEXServerFD, Level, Message);
-  }
-
-  void AssertHandler(char const *Message) {
-    FEXServerClient::AssertHandler(FEXServerFD, Message);
-  }
-}
-
 void InterpreterHandler(std::string *Filename, std::string const &RootFS, std::vector<std::string> *args) {
   // Open the file pointer to the filename and see if we need to find an interpreter
   std::fstream File(*Filename, std::fstream::in | std::fstream::binary);
@@ -272,10 +262,11 @@ int main(int argc, char **argv, char **const envp) {
       LogMan::Throw::UnInstallHandlers();
       LogMan::Msg::UnInstallHandlers();
 
-      FEXServerLogging::FEXServerFD = FEXServerClient::RequestLogFD(FEXServerClient::GetServerFD());
-      if (FEXServerLogging::FEXServerFD != -1) {
-        LogMan::Throw::InstallHandler(FEXServerLogging::AssertHandler);
-        LogMan::Msg::InstallHandler(FEXServerLogging::MsgHandler);
+      int FEXServerFD = FEXServerClient::RequestLogFD(FEXServerClient::GetServerFD());
+      if (FEXServerFD != -1) {
+        FEX::HLE::AsyncLogger::Initialize(FEXServerFD);
+        LogMan::Throw::InstallHandler(FEX::HLE::AsyncLogger::AssertHandler);
+        LogMan::Msg::InstallHandler(FEX::HLE::AsyncLogger::MsgHandler);
       }
     }
     else if (!LogFile.empty()) {
@@ -360,6 +351,9 @@ int main(int argc, char **argv, char **const envp) {
   }
 
   // System allocator is now system allocator or FEX
+  // Logging can move off the guest threads now that the drain thread's stack comes from it
+  FEX::HLE::AsyncLogger::Start();
+
   FEXCore::Context::InitializeStaticTables(Loader.Is64BitMode() ? FEXCore::Context::MODE_64BIT : FEXCore::Context::MODE_32BIT);
 
   auto CTX = FEXCore::Context::CreateNewContext();
@@ -433,6 +427,14 @@ int main(int argc, char **argv, char **const envp) {
                       "Capture doesn't work with programs that fork.");
 
     FEXCore::Context::SetAOTIRLoader(CTX, [](const std::string &fileid) -> int {
+      // Prefer an FD from the FEXServer, it validates the FileId before opening the cache file
+      if (FEXServerClient::GetServerFD() != -1) {
+        int FD = FEXServerClient::RequestAOTIRFD(fileid);
+        if (FD != -1) {
+          return FD;
+        }
+      }
+
       auto filepath = std::filesystem::path(FEXCore::Config::GetDataDirectory()) / "aotir" / (fileid + ".aotir");
 
       return open(filepath.c_str(), O_RDONLY);
@@ -500,6 +502,7 @@ int main(int argc, char **argv, char **const envp) {
 
   FEXCore::Config::Shutdown();
 
+  FEX::HLE::AsyncLogger::Shutdown();
   LogMan::Throw::UnInstallHandlers();
   LogMan::Msg::UnInstallHandlers();
 
@@ -10,6 +10,7 @@
 #include <cstring>
 #include <fcntl.h>
 #include <fstream>
+#include <map>
 #include <sys/mman.h>
 #include <sys/user.h>
 #include <vector>
@@ -138,11 +139,7 @@ namespace FEX::HarnessHelper {
     MatchMask >>= 1;
 
     auto CompactRFlags = [](auto Arg) -> uint32_t {
-      uint32_t Res = 2;
-      for (int i = 0; i < 32; ++i) {
-        Res |= Arg->flags[i] << i;
-      }
-      return Res;
+      return Arg->GetEFLAGS() | 2;
     };
 
     // FLAGS
@@ -452,6 +449,10 @@ namespace FEX::HarnessHelper {
       }
     }
 
+    ~HarnessCodeLoader() {
+      close(TestFD);
+    }
+
     uint64_t StackSize() const override {
       return STACK_SIZE;
     }
@@ -471,6 +472,10 @@ namespace FEX::HarnessHelper {
       return RIP;
     }
 
+    size_t CodeSize() const {
+      return TestFileSize;
+    }
+
     bool MapMemory(const MapperFn& Mapper, const UnmapperFn& Unmapper) override {
       bool LimitedSize = true;
       auto DoMMap = [&Mapper](uint64_t Address, size_t Size) -> void* {
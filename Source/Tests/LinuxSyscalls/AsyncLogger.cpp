@@ -0,0 +1,388 @@
+#include "Common/FEXServerClient.h"
+#include "Tests/LinuxSyscalls/AsyncLogger.h"
+
+#include <FEXCore/Utils/Event.h>
+#include <FEXCore/Utils/LogManager.h>
+#include <FEXCore/Utils/Threads.h>
+#include <FEXHeaderUtils/Syscalls.h>
+
+#include <array>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <pthread.h>
+#include <span>
+#include <sys/uio.h>
+#include <time.h>
+#include <unistd.h>
+#include <vector>
+
+namespace FEX::HLE::AsyncLogger {
+namespace {
+  using FEXServerClient::Logging::PacketMsg;
+
+  constexpr size_t RECORD_SIZE = 512;
+  constexpr size_t RECORD_COUNT = 64;
+  // Packets per writev
+  constexpr size_t MAX_BATCH = 64;
+  // How long the drain thread sleeps when no ring is filling up
+  constexpr auto DRAIN_INTERVAL = std::chrono::milliseconds(10);
+
+  // The packet exactly as FEXServer reads it, so a record is a single iovec
+  struct Record {
+    PacketMsg Msg;
+    char Message[RECORD_SIZE - sizeof(PacketMsg)];
+  };
+  static_assert(sizeof(Record) == RECORD_SIZE, "Record has padding");
+  static_assert(offsetof(Record, Message) == sizeof(PacketMsg), "Message must directly follow the packet header");
+
+  // Single producer (the owning thread) and single consumer (whoever holds DrainMutex)
+  struct ThreadRing {
+    std::atomic<uint64_t> Head{};
+    std::atomic<uint64_t> Tail{};
+    // Owning thread has exited, freed once empty
+    std::atomic<bool> Abandoned{};
+    int32_t TID{};
+    std::array<Record, RECORD_COUNT> Records;
+  };
+
+  struct ThreadRingHolder {
+    std::shared_ptr<ThreadRing> Ring;
+
+    ~ThreadRingHolder() {
+      if (Ring) {
+        Ring->Abandoned = true;
+      }
+    }
+  };
+
+  int LogFD{-1};
+  int32_t PID{};
+  std::atomic<bool> Enabled{};
+  std::atomic<bool> ShouldShutdown{};
+  std::unique_ptr<FEXCore::Threads::Thread> DrainThread{};
+  Event DrainRequested{};
+
+  std::mutex RingsMutex{};
+  std::vector<std::shared_ptr<ThreadRing>> Rings{};
+  std::mutex DrainMutex{};
+
+  // Only set for threads that went through RegisterThread, everything else writes directly
+  thread_local ThreadRingHolder LocalRing{};
+  // Set while this thread pushes to its ring, a signal handler logging in the middle can't reuse it
+  thread_local bool InPush{};
+  // Set while this thread takes or holds RingsMutex or DrainMutex, a signal handler logging in the middle can't take them again
+  thread_local bool HoldsLock{};
+
+  // writev can come back short or be interrupted by a signal, keep going until the whole batch is out
+  void WriteAll(iovec *Vecs, size_t Count) {
+    while (Count) {
+      const ssize_t Result = writev(LogFD, Vecs, Count);
+      if (Result == -1 && errno == EINTR) {
+        continue;
+      }
+
+      if (Result <= 0) {
+        // FEXServer went away, nothing left to do with these
+        return;
+      }
+
+      // Skip over what was written, the last iovec might only be partially done
+      size_t Written = Result;
+      while (Count && Written >= Vecs->iov_len) {
+        Written -= Vecs->iov_len;
+        ++Vecs;
+        --Count;
+      }
+
+      if (Count) {
+        Vecs->iov_base = static_cast<char*>(Vecs->iov_base) + Written;
+        Vecs->iov_len -= Written;
+      }
+    }
+  }
+
+  // Writes out everything queued on the rings, DrainMutex must be held
+  void WriteRings(std::span<std::shared_ptr<ThreadRing> const> CurrentRings) {
+    std::array<iovec, MAX_BATCH> Batch;
+    size_t BatchSize{};
+    // Tails can only move once the kernel is done reading the records
+    std::vector<std::pair<ThreadRing*, uint64_t>> PendingTails;
+
+    auto Submit = [&]() {
+      if (BatchSize) {
+        WriteAll(Batch.data(), BatchSize);
+        BatchSize = 0;
+      }
+
+      for (auto [Ring, Tail] : PendingTails) {
+        Ring->Tail.store(Tail, std::memory_order_release);
+      }
+      PendingTails.clear();
+    };
+
+    for (auto &Ring : CurrentRings) {
+      const uint64_t Head = Ring->Head.load(std::memory_order_acquire);
+
+      for (uint64_t Tail = Ring->Tail.load(std::memory_order_relaxed); Tail != Head; ++Tail) {
+        auto &Rec = Ring->Records[Tail % RECORD_COUNT];
+        Batch[BatchSize++] = {
+          .iov_base = &Rec,
+          .iov_len = sizeof(PacketMsg) + Rec.Msg.MessageLength,
+        };
+
+        if (BatchSize == MAX_BATCH) {
+          PendingTails.emplace_back(Ring.get(), Tail + 1);
+          Submit();
+        }
+      }
+
+      PendingTails.emplace_back(Ring.get(), Head);
+    }
+
+    Submit();
+  }
+
+  void DrainRings() {
+    std::vector<std::shared_ptr<ThreadRing>> CurrentRings;
+
+    // DrainMutex is never held while waiting on RingsMutex, so a thread blocking on DrainMutex only waits on a writev
+    HoldsLock = true;
+    {
+      std::unique_lock RingsLock {RingsMutex};
+      CurrentRings = Rings;
+    }
+
+    {
+      std::unique_lock lk {DrainMutex};
+      WriteRings(CurrentRings);
+    }
+
+    // Free the rings of threads that have exited
+    {
+      std::unique_lock RingsLock {RingsMutex};
+      std::erase_if(Rings, [](auto &Ring) {
+        return Ring->Abandoned && Ring->Head.load() == Ring->Tail.load();
+      });
+    }
+    HoldsLock = false;
+  }
+
+  // Writes a message straight to FEXServer, after anything this thread already queued so it doesn't get reordered
+  void WriteDirect(LogMan::DebugLevels Level, char const *Message) {
+    if (LocalRing.Ring && !HoldsLock) {
+      HoldsLock = true;
+      {
+        std::unique_lock lk {DrainMutex};
+        WriteRings(std::span(&LocalRing.Ring, 1));
+      }
+      HoldsLock = false;
+    }
+
+    FEXServerClient::MsgHandler(LogFD, Level, Message);
+  }
+
+  void *DrainThreadHandler(void *) {
+    // Set our thread name so we can see its relation
+    char ThreadName[16] = "FEXLogDrain\0";
+    pthread_setname_np(pthread_self(), ThreadName);
+
+    while (!ShouldShutdown) {
+      DrainRequested.WaitFor(DRAIN_INTERVAL);
+      DrainRings();
+    }
+
+    return nullptr;
+  }
+
+  void StartDrainThread() {
+    // The drain thread must never take guest signals
+    uint64_t OldMask = FEXCore::Threads::SetSignalMask(~0ULL);
+    DrainThread = FEXCore::Threads::Thread::Create(DrainThreadHandler, nullptr);
+    FEXCore::Threads::SetSignalMask(OldMask);
+  }
+}
+
+  void Initialize(int FD) {
+    LogFD = FD;
+  }
+
+  void Start() {
+    if (LogFD == -1) {
+      return;
+    }
+
+    PID = ::getpid();
+    ShouldShutdown = false;
+    StartDrainThread();
+    Enabled = true;
+  }
+
+  void Shutdown() {
+    if (!Enabled) {
+      return;
+    }
+
+    // Anything logged from here on is written directly
+    Enabled = false;
+    ShouldShutdown = true;
+    DrainRequested.NotifyOne();
+
+    if (DrainThread->joinable()) {
+      DrainThread->join(nullptr);
+    }
+    DrainThread.reset();
+
+    DrainRings();
+  }
+
+  void Flush() {
+    if (!Enabled) {
+      return;
+    }
+
+    DrainRings();
+  }
+
+  void RegisterThread() {
+    if (LogFD == -1 || LocalRing.Ring) {
+      return;
+    }
+
+    auto Ring = std::make_shared<ThreadRing>();
+    Ring->TID = FHU::Syscalls::gettid();
+
+    HoldsLock = true;
+    {
+      std::unique_lock lk {RingsMutex};
+      Rings.emplace_back(Ring);
+    }
+    HoldsLock = false;
+
+    LocalRing.Ring = std::move(Ring);
+  }
+
+  void UnregisterThread() {
+    if (!LocalRing.Ring) {
+      return;
+    }
+
+    // The drain thread writes out whatever is left and then frees it
+    LocalRing.Ring->Abandoned = true;
+    LocalRing.Ring.reset();
+  }
+
+  void MsgHandler(LogMan::DebugLevels Level, char const *Message) {
+    const size_t MsgLen = strlen(Message) + 1;
+    auto Ring = LocalRing.Ring.get();
+
+    if (!Enabled || !Ring || InPush || MsgLen > sizeof(Record::Message)) {
+      WriteDirect(Level, Message);
+      return;
+    }
+
+    InPush = true;
+
+    const uint64_t Head = Ring->Head.load(std::memory_order_relaxed);
+    const uint64_t Used = Head - Ring->Tail.load(std::memory_order_acquire);
+
+    if (Used == RECORD_COUNT) {
+      // Drain thread fell behind, write it out ourselves rather than dropping it
+      InPush = false;
+      WriteDirect(Level, Message);
+      return;
+    }
+
+    // Same header as FEXServerClient::Logging::FillHeader, without the syscalls
+    struct timespec Time{};
+    clock_gettime(CLOCK_MONOTONIC, &Time);
+
+    auto &Rec = Ring->Records[Head % RECORD_COUNT];
+    Rec.Msg.Header = FEXServerClient::Logging::PacketHeader {
+      .Timestamp = static_cast<uint64_t>(Time.tv_sec) * 1'000'000'000ULL + Time.tv_nsec,
+      .PacketType = FEXServerClient::Logging::PacketTypes::TYPE_MSG,
+      .PID = PID,
+      .TID = Ring->TID,
+    };
+    Rec.Msg.MessageLength = MsgLen;
+    Rec.Msg.Level = Level;
+    memcpy(Rec.Message, Message, MsgLen);
+
+    Ring->Head.store(Head + 1, std::memory_order_release);
+    InPush = false;
+
+    if (Used + 1 == RECORD_COUNT / 2) {
+      DrainRequested.NotifyOne();
+    }
+  }
+
+  void AssertHandler(char const *Message) {
+    // About to trap, everything before the assert needs to make it out first
+    // This can be reached from a signal handler or with the locks already held, so only drain if the locks are free right now
+    if (Enabled && !HoldsLock) {
+      HoldsLock = true;
+      {
+        std::unique_lock RingsLock {RingsMutex, std::try_to_lock};
+        std::unique_lock lk {DrainMutex, std::try_to_lock};
+        if (RingsLock.owns_lock() && lk.owns_lock()) {
+          WriteRings(Rings);
+        }
+      }
+      HoldsLock = false;
+    }
+
+    FEXServerClient::AssertHandler(LogFD, Message);
+  }
+
+  void LockBeforeFork() {
+    if (!Enabled) {
+      return;
+    }
+
+    // Same order as everything else, RingsMutex is never waited on while holding DrainMutex
+    HoldsLock = true;
+    RingsMutex.lock();
+    DrainMutex.lock();
+  }
+
+  void UnlockAfterFork(bool Child) {
+    if (!Enabled) {
+      return;
+    }
+
+    if (Child) {
+      PID = ::getpid();
+
+      // The other threads don't exist in the child and the parent writes out what was queued before the fork
+      Rings.clear();
+      if (LocalRing.Ring) {
+        LocalRing.Ring->Tail.store(LocalRing.Ring->Head.load());
+        LocalRing.Ring->TID = FHU::Syscalls::gettid();
+        Rings.emplace_back(LocalRing.Ring);
+      }
+
+      // This describes the parent's drain thread, which doesn't exist here
+      (void)DrainThread.release();
+
+      // The parent's drain thread might have been holding the event's mutex during the fork
+      new (&DrainRequested) Event{};
+    }
+
+    DrainMutex.unlock();
+    RingsMutex.unlock();
+    HoldsLock = false;
+  }
+
+  void RestartAfterFork() {
+    if (!Enabled) {
+      return;
+    }
+
+    StartDrainThread();
+  }
+}
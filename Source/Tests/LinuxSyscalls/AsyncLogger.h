@@ -0,0 +1,61 @@
+#pragma once
+
+#include <FEXCore/Utils/LogManager.h>
+
+namespace FEX::HLE::AsyncLogger {
+  /**
+   * @name Asynchronous logging to FEXServer
+   *
+   * Each registered thread pushes its messages in to its own lock-free ring of packets.
+   * A background thread drains every ring and batches them in to a single writev on the log FD.
+   * Emitting threads never wait on the socket unless their ring is full or the message doesn't fit a record,
+   * in which case their ring is written out before the message so nothing gets reordered.
+   * @{ */
+
+  /**
+   * @brief Sets the FEXServer log socket that messages get written to
+   *
+   * Messages are written directly until Start is called.
+   *
+   * @param FD - The log FD received from FEXServer
+   */
+  void Initialize(int FD);
+
+  /**
+   * @brief Starts the drain thread and queues messages from then on
+   *
+   * Needs to happen after the host allocator is set up, since the drain thread gets its own stack.
+   */
+  void Start();
+
+  /**
+   * @brief Writes out everything queued and stops the drain thread
+   */
+  void Shutdown();
+
+  /**
+   * @brief Writes out every message queued before the call
+   *
+   * Needed before anything that would lose the queues, like execve.
+   */
+  void Flush();
+
+  /**
+   * @brief Gives the calling thread its ring
+   *
+   * Called when a guest thread starts, so that nothing gets allocated when logging from a signal handler.
+   * Threads that never register write their messages directly.
+   */
+  void RegisterThread();
+  void UnregisterThread();
+
+  void MsgHandler(LogMan::DebugLevels Level, char const *Message);
+  void AssertHandler(char const *Message);
+
+  // Drain thread doesn't survive a fork, these keep the queues consistent in the child
+  void LockBeforeFork();
+  void UnlockAfterFork(bool Child);
+  // Needs to happen after FEXCore has cleaned up the parent's thread stacks
+  void RestartAfterFork();
+  /**  @} */
+}
@@ -5,7 +5,8 @@
 #include <FEXHeaderUtils/Syscalls.h>
 #include <FEXHeaderUtils/TypeDefines.h>
 
-#include <bitset>
+#include <array>
+#include <bit>
 #include <map>
 #include <linux/mman.h>
 #include <unistd.h>
@@ -18,6 +19,153 @@
 #endif
 
 namespace FEX::HLE {
+// Two level bitmap tracking which pages of the 32-bit address space are mapped.
+// The bottom level is one bit per page.
+// The top level is one bit per bottom level word, once for "every page in the word is mapped"
+// and once for "any page in the word is mapped".
+//
+// Range scans use the top level to skip fully mapped or fully free spans of 4096 pages at a time,
+// then walk the bottom level a full word at a time with ctz/clz instead of testing each page.
+// Marking a range as used or free touches each word once.
+template<size_t NumPages>
+class PageRangeBitmap final {
+public:
+  static constexpr uint64_t NOT_FOUND = ~0ULL;
+
+  // Sets the range [Page, Page + Count) to either mapped or free
+  void SetRange(uint64_t Page, size_t Count, bool Mapped) {
+    const uint64_t End = std::min<uint64_t>(Page + Count, NumPages);
+    while (Page < End) {
+      const size_t Word = Page / BITS;
+      const size_t Bit = Page % BITS;
+      const uint64_t Length = std::min<uint64_t>(BITS - Bit, End - Page);
+      const uint64_t Mask = (Length == BITS ? ~0ULL : ((1ULL << Length) - 1)) << Bit;
+
+      if (Mapped) {
+        Pages[Word] |= Mask;
+      }
+      else {
+        Pages[Word] &= ~Mask;
+      }
+      UpdateSummary(Word);
+
+      Page += Length;
+    }
+  }
+
+  // Finds the lowest page in [Page, End) that matches the Mapped state.
+  // Returns End if none was found.
+  uint64_t FindNext(bool Mapped, uint64_t Page, uint64_t End) const {
+    End = std::min<uint64_t>(End, NumPages);
+    if (Page >= End) {
+      return End;
+    }
+
+    size_t Word = Page / BITS;
+    uint64_t Bits = Pattern(Mapped, Word) & (~0ULL << (Page % BITS));
+
+    while (Bits == 0) {
+      ++Word;
+      if (Word * BITS >= End) {
+        return End;
+      }
+
+      // Skip over words that can't contain a match
+      size_t Summary = Word / BITS;
+      uint64_t Candidates = SummaryPattern(Mapped, Summary) & (~0ULL << (Word % BITS));
+      while (Candidates == 0) {
+        ++Summary;
+        if (Summary * BITS * BITS >= End) {
+          return End;
+        }
+        Candidates = SummaryPattern(Mapped, Summary);
+      }
+
+      Word = Summary * BITS + std::countr_zero(Candidates);
+      if (Word * BITS >= End) {
+        return End;
+      }
+      Bits = Pattern(Mapped, Word);
+    }
+
+    return std::min<uint64_t>(Word * BITS + std::countr_zero(Bits), End);
+  }
+
+  // Finds the highest page in [Begin, Page] that matches the Mapped state.
+  // Returns NOT_FOUND if none was found.
+  uint64_t FindPrev(bool Mapped, uint64_t Page, uint64_t Begin) const {
+    if (Page < Begin || Page >= NumPages) {
+      return NOT_FOUND;
+    }
+
+    size_t Word = Page / BITS;
+    uint64_t Bits = Pattern(Mapped, Word) & (~0ULL >> (BITS - 1 - Page % BITS));
+
+    while (Bits == 0) {
+      if (Word * BITS <= Begin) {
+        return NOT_FOUND;
+      }
+      --Word;
+
+      // Skip over words that can't contain a match
+      size_t Summary = Word / BITS;
+      uint64_t Candidates = SummaryPattern(Mapped, Summary) & (~0ULL >> (BITS - 1 - Word % BITS));
+      while (Candidates == 0) {
+        if (Summary * BITS * BITS <= Begin) {
+          return NOT_FOUND;
+        }
+        --Summary;
+        Candidates = SummaryPattern(Mapped, Summary);
+      }
+
+      Word = Summary * BITS + (BITS - 1 - std::countl_zero(Candidates));
+      Bits = Pattern(Mapped, Word);
+    }
+
+    const uint64_t Result = Word * BITS + (BITS - 1 - std::countl_zero(Bits));
+    return Result >= Begin ? Result : NOT_FOUND;
+  }
+
+private:
+  static constexpr size_t BITS = 64;
+  static constexpr size_t NUM_WORDS = NumPages / BITS;
+  static constexpr size_t NUM_SUMMARY_WORDS = NUM_WORDS / BITS;
+  static_assert((NumPages % (BITS * BITS)) == 0, "Page count must fill the summary level");
+
+  // Bits set where the page matches the requested state
+  uint64_t Pattern(bool Mapped, size_t Word) const {
+    return Mapped ? Pages[Word] : ~Pages[Word];
+  }
+
+  // Bits set where the word contains at least one page matching the requested state
+  uint64_t SummaryPattern(bool Mapped, size_t Summary) const {
+    return Mapped ? AnyMappedWords[Summary] : ~FullWords[Summary];
+  }
+
+  void UpdateSummary(size_t Word) {
+    const size_t Summary = Word / BITS;
+    const uint64_t Bit = 1ULL << (Word % BITS);
+
+    if (Pages[Word] == ~0ULL) {
+      FullWords[Summary] |= Bit;
+    }
+    else {
+      FullWords[Summary] &= ~Bit;
+    }
+
+    if (Pages[Word] != 0) {
+      AnyMappedWords[Summary] |= Bit;
+    }
+    else {
+      AnyMappedWords[Summary] &= ~Bit;
+    }
+  }
+
+  std::array<uint64_t, NUM_WORDS> Pages{};
+  std::array<uint64_t, NUM_SUMMARY_WORDS> FullWords{};
+  std::array<uint64_t, NUM_SUMMARY_WORDS> AnyMappedWords{};
+};
+
 class MemAllocator32Bit final : public FEX::HLE::MemAllocator {
 private:
   static constexpr uint64_t BASE_KEY = 16;
@@ -27,11 +175,9 @@ private:
 public:
   MemAllocator32Bit() {
     // First 16 pages are taken by the Linux kernel
-    for (size_t i = 0; i < 16; ++i) {
-      MappedPages.set(i);
-    }
+    MappedPages.SetRange(0, 16, true);
     // Take the top page as well
-    MappedPages.set(TOP_KEY);
+    MappedPages.SetRange(TOP_KEY, 1, true);
     if (SearchDown) {
       LastScanLocation = TOP_KEY;
       LastKeyLocation = TOP_KEY;
@@ -55,24 +201,20 @@ public:
   // PagesLength is the number of pages
   void SetUsedPages(uint64_t PageAddr, size_t PagesLength) {
     // Set the range as mapped
-    for (size_t i = 0; i < PagesLength; ++i) {
-      MappedPages.set(PageAddr + i);
-    }
+    MappedPages.SetRange(PageAddr, PagesLength, true);
   }
 
   // PageAddr is a page already shifted to page index
   // PagesLength is the number of pages
   void SetFreePages(uint64_t PageAddr, size_t PagesLength) {
     // Set the range as unused
-    for (size_t i = 0; i < PagesLength; ++i) {
-      MappedPages.reset(PageAddr + i);
-    }
+    MappedPages.SetRange(PageAddr, PagesLength, false);
   }
 
 private:
   // Set that contains 4k mapped pages
   // This is the full 32bit memory range
-  std::bitset<0x10'0000> MappedPages;
+  PageRangeBitmap<0x10'0000> MappedPages;
   std::map<uint32_t, int> PageToShm{};
   uint64_t LastScanLocation{};
   uint64_t LastKeyLocation{};
@@ -85,47 +227,44 @@ private:
 };
 
 uint64_t MemAllocator32Bit::FindPageRange(uint64_t Start, size_t Pages) const {
-  // Linear range scan
+  // Word at a time range scan
   while (Start != TOP_KEY) {
-    bool Free = true;
-    if ((Start + Pages) > TOP_KEY) {
+    uint64_t FreePage = MappedPages.FindNext(false, Start, TOP_KEY);
+    if ((FreePage + Pages) > TOP_KEY) {
       return 0;
     }
-    uint64_t Offset = 0;
-    for (; Offset < Pages; ++Offset) {
-      if (MappedPages.test(Start + Offset)) {
-        Free = false;
-        break;
-      }
-    }
 
-    if (Free) {
-      return Start;
+    uint64_t UsedPage = MappedPages.FindNext(true, FreePage, FreePage + Pages);
+    if (UsedPage == (FreePage + Pages)) {
+      return FreePage;
     }
-    Start += Offset + 1;
+
+    // Continue past the page that broke the range
+    Start = UsedPage + 1;
   }
 
   return 0;
 }
 
 uint64_t MemAllocator32Bit::FindPageRange_TopDown(uint64_t Start, size_t Pages) const {
-  // Linear range scan
+  // Word at a time range scan
+  // Returns the lowest page of the highest free range that ends at or below Start
   while (Start >= BASE_KEY &&
          Start <= TOP_KEY) {
-    bool Free = true;
-
-    uint64_t Offset = 0;
-    for (; Offset < Pages; ++Offset) {
-      if (MappedPages.test(Start - Offset)) {
-        Free = false;
-        break;
-      }
+    uint64_t FreePage = MappedPages.FindPrev(false, Start, BASE_KEY);
+    if (FreePage == MappedPages.NOT_FOUND ||
+        (FreePage + 1) < (BASE_KEY + Pages)) {
+      return 0;
     }
 
-    if (Free) {
-      return Start - Offset;
+    uint64_t LowerPage = FreePage + 1 - Pages;
+    uint64_t UsedPage = MappedPages.FindPrev(true, FreePage, LowerPage);
+    if (UsedPage == MappedPages.NOT_FOUND) {
+      return LowerPage;
     }
-    Start -= Offset + 1;
+
+    // Continue below the page that broke the range
+    Start = UsedPage - 1;
   }
 
   return 0;
@@ -289,8 +428,6 @@ int MemAllocator32Bit::Munmap(void *addr, size_t length) {
   uintptr_t Addr = reinterpret_cast<uintptr_t>(addr);
   uintptr_t PageAddr = Addr >> FHU::FEX_PAGE_SHIFT;
 
-  uintptr_t PageEnd = PageAddr + PagesLength;
-
   // Both Addr and length must be page aligned
   if (Addr & ~FHU::FEX_PAGE_MASK) {
     return -EINVAL;
@@ -310,20 +447,15 @@ int MemAllocator32Bit::Munmap(void *addr, size_t length) {
     return 0;
   }
 
-  while (PageAddr != PageEnd) {
-    // Always pass to munmap, it may be something allocated we aren't tracking
-    int Result = ::munmap(reinterpret_cast<void*>(PageAddr << FHU::FEX_PAGE_SHIFT), FHU::FEX_PAGE_SIZE);
-    if (Result != 0) {
-      return -errno;
-    }
-
-    if (MappedPages.test(PageAddr)) {
-      MappedPages.reset(PageAddr);
-    }
-
-    ++PageAddr;
+  // Always pass to munmap, it may be something allocated we aren't tracking
+  // munmap of a range with holes in it is valid, so the full range goes through one syscall
+  int Result = ::munmap(reinterpret_cast<void*>(PageAddr << FHU::FEX_PAGE_SHIFT), PagesLength << FHU::FEX_PAGE_SHIFT);
+  if (Result != 0) {
+    return -errno;
   }
 
+  SetFreePages(PageAddr, PagesLength);
+
   return 0;
 }
 
@@ -371,14 +503,9 @@ void *MemAllocator32Bit::Mremap(void *old_address, size_t old_size, size_t new_s
       }
       else {
         // Scan the region forward from our first region's endd to see if it can be extended
-        bool CanExtend{true};
-
-        for (size_t i = OldPagesLength; i < NewPagesLength; ++i) {
-          if (MappedPages[OldPageAddr + i]) {
-            CanExtend = false;
-            break;
-          }
-        }
+        uint64_t ExtendEnd = OldPageAddr + NewPagesLength;
+        bool CanExtend = ExtendEnd <= TOP_KEY &&
+          MappedPages.FindNext(true, OldPageAddr + OldPagesLength, ExtendEnd) == ExtendEnd;
 
         if (CanExtend) {
           void *MappedPtr = ::mremap(old_address, old_size, new_size, flags & ~MREMAP_MAYMOVE);
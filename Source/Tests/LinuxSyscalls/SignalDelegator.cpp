@@ -7,6 +7,7 @@ $end_info$
 
 #include <FEXCore/Core/Context.h>
 #include <FEXCore/Debug/InternalThreadState.h>
+#include "Tests/LinuxSyscalls/AsyncLogger.h"
 #include "Tests/LinuxSyscalls/SignalDelegator.h"
 
 #include <FEXCore/Core/CoreState.h>
@@ -319,9 +320,13 @@ namespace FEX::HLE {
 
     // Get the current host signal mask
     ::syscall(SYS_rt_sigprocmask, 0, nullptr, &ThreadData.CurrentSignalMask.Val, 8);
+
+    AsyncLogger::RegisterThread();
   }
 
   void SignalDelegator::UninstallFrontendTLSState(FEXCore::Core::InternalThreadState *Thread) {
+    AsyncLogger::UnregisterThread();
+
     FEXCore::Allocator::munmap(ThreadData.AltStackPtr, SIGSTKSZ * 16);
 
     ThreadData.AltStackPtr = nullptr;
@@ -8,6 +8,7 @@ $end_info$
 
 #include "Linux/Utils/ELFContainer.h"
 #include "Linux/Utils/ELFParser.h"
+#include "Tests/LinuxSyscalls/AsyncLogger.h"
 
 #include "Tests/LinuxSyscalls/LinuxAllocator.h"
 #include "Tests/LinuxSyscalls/Syscalls.h"
@@ -269,6 +270,9 @@ uint64_t ExecveHandler(const char *pathname, char* const* argv, char* const* env
   // Kernel does its own checks for file format support for this
   // We can only call execve directly if we both have an interpreter installed AND were ran with the interpreter
   // If the user ran FEX through FEXLoader then we must go down the emulated path
+  // Queued log messages don't survive the execve
+  AsyncLogger::Flush();
+
   ELFLoader::ELFContainer::ELFType Type = ELFLoader::ELFContainer::GetELFType(Filename);
   uint64_t Result{};
   if (FEX::HLE::_SyscallHandler->IsInterpreterInstalled() &&
@@ -794,6 +798,7 @@ uint64_t UnimplementedSyscallSafe(FEXCore::Core::CpuStateFrame *Frame, uint64_t
 
 void SyscallHandler::LockBeforeFork() {
   FM.GetFDLock()->lock();
+  AsyncLogger::LockBeforeFork();
 
   // XXX shared_mutex has issues with locking and forks
   // VMATracking.Mutex.lock();
@@ -801,11 +806,18 @@ void SyscallHandler::LockBeforeFork() {
   // Add other mutexes here
 }
 
-void SyscallHandler::UnlockAfterFork() {
+void SyscallHandler::UnlockAfterFork(bool Child) {
   // Add other mutexes here
 
   // XXX shared_mutex has issues with locking and forks
   // VMATracking.Mutex.unlock();
+
+  if (Child) {
+    // Snapshot readers from the other parent threads never finish in the child
+    VMATracking.ResetSnapshotReadersAfterFork();
+  }
+
+  AsyncLogger::UnlockAfterFork(Child);
   
   FM.GetFDLock()->unlock(); 
 }
@@ -16,8 +16,10 @@ $end_info$
 #include <FEXCore/IR/IR.h>
 #include <FEXCore/Utils/CompilerDefs.h>
 
+#include <atomic>
 #include <mutex>
 #include <shared_mutex>
+#include <span>
 
 #include <errno.h>
 #include <stdint.h>
@@ -210,7 +212,7 @@ public:
 
   ///// FORK tracking /////
   void LockBeforeFork();
-  void UnlockAfterFork();
+  void UnlockAfterFork(bool Child);
 
   SourcecodeResolver *GetSourcecodeResolver() override { return this; }
   
@@ -314,9 +316,37 @@ private:
     VMAProt Prot;
   };
 
+  // Copy of a VMAEntry in a published snapshot
+  struct VMASnapshotEntry {
+    uint64_t Base;
+    uint64_t Top;
+    uint64_t Offset;
+    // Identifies the mappings of the same MappedResource, never dereferenced
+    uintptr_t Resource;
+
+    VMAFlags Flags;
+    VMAProt Prot;
+  };
+
+  // Immutable sorted arrays of the tracked VMAs, searched without taking VMATracking::Mutex
+  struct VMASnapshot {
+    // Sorted by Base, non overlapping
+    std::vector<VMASnapshotEntry> VMAs;
+    // Every VMA that has a Resource, sorted by Resource
+    std::vector<VMASnapshotEntry> ResourceVMAs;
+
+    // Returns the VMA containing GuestAddr or nullptr
+    VMASnapshotEntry const *Lookup(uint64_t GuestAddr) const;
+    // Returns the VMAs that overlap [Base, Top)
+    std::span<VMASnapshotEntry const> Overlapping(uint64_t Base, uint64_t Top) const;
+    // Returns all VMAs of the Resource sorted by Base, empty for a null Resource
+    std::span<VMASnapshotEntry const> Mirrors(uintptr_t Resource) const;
+  };
+
   struct VMATracking {
     using VMAEntry = SyscallHandler::VMAEntry;
     // Held while reading/writing this struct
+    // The SMC paths read Snapshot instead
     std::shared_mutex Mutex;
     
     // Memory ranges indexed by page aligned starting address
@@ -341,7 +371,92 @@ private:
     // Mutex must be unique_locked before calling
     // Returns the Size fo the Shm or 0 if not found
     uintptr_t ClearShmUnsafe(FEXCore::Context::Context *Ctx, uintptr_t Base);
+
+    // Mutex must be unique_locked before calling
+    // Publishes a new snapshot of VMAs for SnapshotReader, call once after each change
+    // Only the range changed since the last publish is rebuilt, the rest is copied from the current snapshot
+    // The replaced snapshot is only retired, ReclaimSnapshots frees it
+    void PublishSnapshotUnsafe();
+
+    // Mutex must NOT be held
+    // Frees the retired snapshots no active reader can still be using, never waits on readers
+    void ReclaimSnapshots();
+
+    // Only for the fork child, where readers that were running in other threads no longer exist
+    void ResetSnapshotReadersAfterFork();
+
+    // A thread's announcement for SnapshotReader, slots are reused by later threads but never freed
+    struct SnapshotReaderSlot {
+      // Snapshot epoch the thread's outermost reader started in, zero while it has none
+      std::atomic<uint64_t> Epoch{};
+      // Set once the owning thread exited
+      std::atomic<bool> Free{};
+      SnapshotReaderSlot *Next{};
+    };
+
+    /**
+     * @brief Lock-free access to the latest published VMASnapshot
+     *
+     * A reader announces the current snapshot epoch in its thread's slot before loading the snapshot.
+     * Readers nested in a signal handler are covered by the outer reader's announcement.
+     * A retired snapshot is freed once every announced epoch is at or past the one it was retired in.
+     * The snapshot must be copied from, a reader must not be alive while waiting on any lock.
+     */
+    class SnapshotReader final {
+    public:
+      explicit SnapshotReader(VMATracking &Tracking);
+      ~SnapshotReader();
+
+      SnapshotReader(SnapshotReader const&) = delete;
+      SnapshotReader &operator=(SnapshotReader const&) = delete;
+
+      VMASnapshot const *operator->() const { return Snapshot; }
+
+    private:
+      SnapshotReaderSlot *Slot;
+      VMASnapshot const *Snapshot;
+      bool Outermost;
+    };
+
+    ~VMATracking();
+
   private:
+    std::atomic<VMASnapshot*> Snapshot{new VMASnapshot{}};
+    // Bumped by every publish, starts at 1 so an announced epoch is never zero
+    std::atomic<uint64_t> SnapshotEpoch{1};
+
+    // Every thread that ever read a snapshot
+    std::atomic<SnapshotReaderSlot*> SnapshotReaderSlots{};
+    SnapshotReaderSlot *GetSnapshotReaderSlot();
+
+    // Releases the calling thread's slot when it exits, there is only one VMATracking per process
+    struct SnapshotReaderSlotHolder {
+      SnapshotReaderSlot *Slot{};
+
+      ~SnapshotReaderSlotHolder() {
+        if (Slot) {
+          Slot->Epoch.store(0);
+          Slot->Free.store(true);
+        }
+      }
+    };
+    static thread_local SnapshotReaderSlotHolder LocalSnapshotReaderSlot;
+
+    struct RetiredSnapshot {
+      VMASnapshot const *Snapshot;
+      // Readers that announced this epoch or a later one loaded a newer snapshot
+      uint64_t Epoch;
+    };
+
+    // Snapshots replaced by PublishSnapshotUnsafe that readers might still be using
+    std::mutex RetiredSnapshotsMutex;
+    std::vector<RetiredSnapshot> RetiredSnapshots;
+
+    // Range of VMAs changed since the last publish, empty while DirtyBase >= DirtyTop
+    uint64_t DirtyBase{UINT64_MAX};
+    uint64_t DirtyTop{};
+    void MarkDirtyUnsafe(uint64_t Base, uint64_t Top);
+
     bool ListRemove(VMAEntry *Mapping);
     void ListReplace(VMAEntry *Mapping, VMAEntry *NewMapping);
     void ListInsertAfter(VMAEntry *Mapping, VMAEntry *NewMapping);
@@ -5,6 +5,7 @@ $end_info$
 */
 
 #include "FEXCore/IR/IR.h"
+#include "Tests/LinuxSyscalls/AsyncLogger.h"
 #include "Tests/LinuxSyscalls/Syscalls.h"
 #include "Tests/LinuxSyscalls/Syscalls/Thread.h"
 #include "Tests/LinuxSyscalls/x64/Syscalls.h"
@@ -198,7 +199,7 @@ namespace FEX::HLE {
     }
 
     // Unlock the mutexes on both sides of the fork
-    FEX::HLE::_SyscallHandler->UnlockAfterFork();
+    FEX::HLE::_SyscallHandler->UnlockAfterFork(Result == 0);
 
     if (Result == 0) {
       // Child
@@ -210,6 +211,7 @@ namespace FEX::HLE {
 
       // Clear all the other threads that are being tracked
       FEXCore::Context::CleanupAfterFork(Thread->CTX, Frame->Thread);
+      FEX::HLE::AsyncLogger::RestartAfterFork();
 
       // only a  single thread running so no need to remove anything from the thread array
 
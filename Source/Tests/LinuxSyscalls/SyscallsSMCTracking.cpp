@@ -8,6 +8,7 @@ $end_info$
 
 #include "Common/FDUtils.h"
 
+#include <array>
 #include <filesystem>
 #include <sys/shm.h>
 #include <sys/mman.h>
@@ -49,54 +50,89 @@ bool SyscallHandler::HandleSegfault(FEXCore::Core::InternalThreadState *Thread,
   auto CTX = Thread->CTX;
 
   const auto FaultAddress = (uintptr_t)((siginfo_t *)info)->si_addr;
+  const auto FaultBase = FEXCore::AlignDown(FaultAddress, FHU::FEX_PAGE_SIZE);
 
-  {
-    FHU::ScopedSignalMaskWithSharedLock lk(_SyscallHandler->VMATracking.Mutex);
+  auto WritableCallback = [](uintptr_t Start, uintptr_t Length) {
+    auto rv = mprotect((void *)Start, Length, PROT_READ | PROT_WRITE);
+    LogMan::Throw::AAFmt(rv == 0, "mprotect({}, {}) failed", Start, Length);
+  };
 
-    auto VMATracking = &_SyscallHandler->VMATracking;
+  // Invalidation waits on CodeInvalidationMutex, which compiles hold while taking VMATracking.Mutex.
+  // Everything needed is copied out of the snapshot, no reader may be alive while invalidating.
+  uintptr_t Resource{};
+  uint64_t Offset{};
+
+  {
+    VMATracking::SnapshotReader Snapshot(_SyscallHandler->VMATracking);
 
     // If the write spans two pages, they will be flushed one at a time (generating two faults)
-    auto Entry = VMATracking->LookupVMAUnsafe(FaultAddress);
+    auto Entry = Snapshot->Lookup(FaultAddress);
 
     // If an untracked address, or the mapping wasn't writable, it can't be handled here
-    if (Entry == VMATracking->VMAs.end() || !Entry->second.Prot.Writable) {
+    if (!Entry || !Entry->Prot.Writable) {
       return false;
     }
 
-    auto FaultBase = FEXCore::AlignDown(FaultAddress, FHU::FEX_PAGE_SIZE);
+    if (Entry->Flags.Shared) {
+      LOGMAN_THROW_A_FMT(Entry->Resource, "VMA tracking error");
 
-    if (Entry->second.Flags.Shared) {
-      LOGMAN_THROW_A_FMT(Entry->second.Resource, "VMA tracking error");
+      Resource = Entry->Resource;
+      Offset = FaultBase - Entry->Base + Entry->Offset;
+    }
+  }
 
-      auto Offset = FaultBase - Entry->first + Entry->second.Offset;
+  if (!Resource) {
+    FEXCore::Context::InvalidateGuestCodeRange(CTX, FaultBase, FHU::FEX_PAGE_SIZE, WritableCallback);
+    return true;
+  }
 
-      auto VMA = Entry->second.Resource->FirstVMA;
-      LOGMAN_THROW_AA_FMT(VMA, "VMA tracking error");
+  // Flush all mirrors, remap the page writable as needed
+  // Mirrors are copied out in batches, resuming by Base since they are sorted by it
+  struct MirroredPage {
+    uint64_t Base;
+    bool Writable;
+  };
 
-      // Flush all mirrors, remap the page writable as needed
-      do {
-        if (VMA->Offset <= Offset && (VMA->Offset + VMA->Length) > Offset) {
-          auto FaultBaseMirrored = Offset - VMA->Offset + VMA->Base;
+  std::array<MirroredPage, 16> Pages;
+  uint64_t NextMirrorBase{};
+  bool MoreMirrors = true;
 
-          if (VMA->Prot.Writable) {
-            FEXCore::Context::InvalidateGuestCodeRange(CTX, FaultBaseMirrored, FHU::FEX_PAGE_SIZE, [](uintptr_t Start, uintptr_t Length) {
-              auto rv = mprotect((void *)Start, Length, PROT_READ | PROT_WRITE);
-              LogMan::Throw::AAFmt(rv == 0, "mprotect({}, {}) failed", Start, Length);
-            });
-          } else {
-            FEXCore::Context::InvalidateGuestCodeRange(CTX, FaultBaseMirrored, FHU::FEX_PAGE_SIZE);
-          }
+  while (MoreMirrors) {
+    size_t NumPages{};
+    MoreMirrors = false;
+
+    {
+      VMATracking::SnapshotReader Snapshot(_SyscallHandler->VMATracking);
+
+      for (auto &VMA : Snapshot->Mirrors(Resource)) {
+        if (VMA.Base < NextMirrorBase ||
+            !(VMA.Offset <= Offset && (VMA.Offset + VMA.Top - VMA.Base) > Offset)) {
+          continue;
         }
-      } while ((VMA = VMA->ResourceNextVMA));
-    } else {
-      FEXCore::Context::InvalidateGuestCodeRange(CTX, FaultBase, FHU::FEX_PAGE_SIZE, [](uintptr_t Start, uintptr_t Length) {
-        auto rv = mprotect((void *)Start, Length, PROT_READ | PROT_WRITE);
-        LogMan::Throw::AAFmt(rv == 0, "mprotect({}, {}) failed", Start, Length);
-      });
+
+        if (NumPages == Pages.size()) {
+          MoreMirrors = true;
+          break;
+        }
+
+        Pages[NumPages++] = {
+          .Base = Offset - VMA.Offset + VMA.Base,
+          .Writable = VMA.Prot.Writable,
+        };
+        NextMirrorBase = VMA.Base + 1;
+      }
     }
 
-    return true;
+    for (size_t i = 0; i < NumPages; ++i) {
+      if (Pages[i].Writable) {
+        FEXCore::Context::InvalidateGuestCodeRange(CTX, Pages[i].Base, FHU::FEX_PAGE_SIZE, WritableCallback);
+      } else {
+        FEXCore::Context::InvalidateGuestCodeRange(CTX, Pages[i].Base, FHU::FEX_PAGE_SIZE);
+      }
+    }
   }
+
+  return true;
 }
 
 void SyscallHandler::MarkGuestExecutableRange(uint64_t Start, uint64_t Length) {
@@ -108,54 +144,37 @@ void SyscallHandler::MarkGuestExecutableRange(uint64_t Start, uint64_t Length) {
       return;
     }
 
-    FHU::ScopedSignalMaskWithSharedLock lk(VMATracking.Mutex);
-
-    // Find the first mapping at or after the range ends, or ::end().
-    // Top points to the address after the end of the range
-    auto Mapping = VMATracking.VMAs.lower_bound(Top);
-
-    while (Mapping != VMATracking.VMAs.begin()) {
-      Mapping--;
+    VMATracking::SnapshotReader Snapshot(VMATracking);
 
-      const auto MapBase = Mapping->first;
-      const auto MapTop = MapBase + Mapping->second.Length;
+    for (auto &Mapping : Snapshot->Overlapping(Base, Top)) {
+      const auto ProtectBase = std::max(Mapping.Base, Base);
+      const auto ProtectSize = std::min(Mapping.Top, Top) - ProtectBase;
 
-      if (MapTop <= Base) {
-        // Mapping ends before the Range start, exit
-        break;
-      } else {
-        const auto ProtectBase = std::max(MapBase, Base);
-        const auto ProtectSize = std::min(MapTop, Top) - ProtectBase;
-
-        if (Mapping->second.Flags.Shared) {
-          LOGMAN_THROW_A_FMT(Mapping->second.Resource, "VMA tracking error");
-
-          const auto OffsetBase = ProtectBase - Mapping->first + Mapping->second.Offset;
-          const auto OffsetTop = OffsetBase + ProtectSize;
+      if (Mapping.Flags.Shared) {
+        LOGMAN_THROW_A_FMT(Mapping.Resource, "VMA tracking error");
 
-          auto VMA = Mapping->second.Resource->FirstVMA;
-          LOGMAN_THROW_AA_FMT(VMA, "VMA tracking error");
+        const auto OffsetBase = ProtectBase - Mapping.Base + Mapping.Offset;
+        const auto OffsetTop = OffsetBase + ProtectSize;
 
-          do {
-            auto VMAOffsetBase = VMA->Offset;
-            auto VMAOffsetTop = VMA->Offset + VMA->Length;
-            auto VMABase = VMA->Base;
+        for (auto &VMA : Snapshot->Mirrors(Mapping.Resource)) {
+          auto VMAOffsetBase = VMA.Offset;
+          auto VMAOffsetTop = VMA.Offset + VMA.Top - VMA.Base;
+          auto VMABase = VMA.Base;
 
-            if (VMA->Prot.Writable && VMAOffsetBase < OffsetTop && VMAOffsetTop > OffsetBase) {
+          if (VMA.Prot.Writable && VMAOffsetBase < OffsetTop && VMAOffsetTop > OffsetBase) {
 
-              const auto MirroredBase = std::max(VMAOffsetBase, OffsetBase);
-              const auto MirroredSize = std::min(OffsetTop, VMAOffsetTop) - MirroredBase;
+            const auto MirroredBase = std::max(VMAOffsetBase, OffsetBase);
+            const auto MirroredSize = std::min(OffsetTop, VMAOffsetTop) - MirroredBase;
 
-              auto rv = mprotect((void *)(MirroredBase - VMAOffsetBase + VMABase), MirroredSize, PROT_READ);
-              LogMan::Throw::AAFmt(rv == 0, "mprotect({}, {}) failed", MirroredBase, MirroredSize);
-            }
-          } while ((VMA = VMA->ResourceNextVMA));
+            auto rv = mprotect((void *)(MirroredBase - VMAOffsetBase + VMABase), MirroredSize, PROT_READ);
+            LogMan::Throw::AAFmt(rv == 0, "mprotect({}, {}) failed", MirroredBase, MirroredSize);
+          }
+        }
 
-        } else if (Mapping->second.Prot.Writable) {
-          int rv = mprotect((void *)ProtectBase, ProtectSize, PROT_READ);
+      } else if (Mapping.Prot.Writable) {
+        int rv = mprotect((void *)ProtectBase, ProtectSize, PROT_READ);
 
-          LogMan::Throw::AAFmt(rv == 0, "mprotect({}, {}) failed", ProtectBase, ProtectSize);
-        }
+        LogMan::Throw::AAFmt(rv == 0, "mprotect({}, {}) failed", ProtectBase, ProtectSize);
       }
     }
   }
@@ -222,8 +241,11 @@ void SyscallHandler::TrackMmap(uintptr_t Base, uintptr_t Size, int Prot, int Fla
     }
 
     VMATracking.SetUnsafe(CTX, Resource, Base, Offset, Size, VMAFlags::fromFlags(Flags), VMAProt::fromProt(Prot));
+    VMATracking.PublishSnapshotUnsafe();
   }
 
+  VMATracking.ReclaimSnapshots();
+
   if (SMCChecks != FEXCore::Config::CONFIG_SMC_NONE) {
     FEXCore::Context::InvalidateGuestCodeRange(CTX, (uintptr_t)Base, Size);
   }
@@ -236,8 +258,11 @@ void SyscallHandler::TrackMunmap(uintptr_t Base, uintptr_t Size) {
     FHU::ScopedSignalMaskWithUniqueLock lk(_SyscallHandler->VMATracking.Mutex);
 
     VMATracking.ClearUnsafe(CTX, Base, Size);
+    VMATracking.PublishSnapshotUnsafe();
   }
 
+  VMATracking.ReclaimSnapshots();
+
   if (SMCChecks != FEXCore::Config::CONFIG_SMC_NONE) {
     FEXCore::Context::InvalidateGuestCodeRange(CTX, (uintptr_t)Base, Size);
   }
@@ -250,8 +275,11 @@ void SyscallHandler::TrackMprotect(uintptr_t Base, uintptr_t Size, int Prot) {
     FHU::ScopedSignalMaskWithUniqueLock lk(_SyscallHandler->VMATracking.Mutex);
 
     VMATracking.ChangeUnsafe(Base, Size, VMAProt::fromProt(Prot));
+    VMATracking.PublishSnapshotUnsafe();
   }
 
+  VMATracking.ReclaimSnapshots();
+
   if (SMCChecks != FEXCore::Config::CONFIG_SMC_NONE) {
     FEXCore::Context::InvalidateGuestCodeRange(CTX, Base, Size);
   }
@@ -293,8 +321,12 @@ void SyscallHandler::TrackMremap(uintptr_t OldAddress, size_t OldSize, size_t Ne
       // Make anonymous mapping
       VMATracking.SetUnsafe(CTX, OldResource, NewAddress, OldOffset, NewSize, OldFlags, OldProt);
     }
+
+    VMATracking.PublishSnapshotUnsafe();
   }
 
+  VMATracking.ReclaimSnapshots();
+
   if (SMCChecks != FEXCore::Config::CONFIG_SMC_NONE) {
     if (OldAddress != NewAddress) {
       if (OldSize != 0) {
@@ -334,7 +366,11 @@ void SyscallHandler::TrackShmat(int shmid, uintptr_t Base, int shmflg) {
     VMATracking.SetUnsafe(CTX, Resource, Base, 0, Length, VMAFlags::fromFlags(MAP_SHARED),
       VMAProt::fromProt((shmflg & SHM_RDONLY) ? PROT_READ : (PROT_READ | PROT_WRITE))
     );
+    VMATracking.PublishSnapshotUnsafe();
   }
+
+  VMATracking.ReclaimSnapshots();
+
   if (SMCChecks != FEXCore::Config::CONFIG_SMC_NONE) {
     FEXCore::Context::InvalidateGuestCodeRange(CTX, Base, Length);
   }
@@ -346,8 +382,11 @@ void SyscallHandler::TrackShmdt(uintptr_t Base) {
     FHU::ScopedSignalMaskWithUniqueLock lk(_SyscallHandler->VMATracking.Mutex);
 
     Length = VMATracking.ClearShmUnsafe(CTX, Base);
+    VMATracking.PublishSnapshotUnsafe();
   }
 
+  VMATracking.ReclaimSnapshots();
+
   if (SMCChecks != FEXCore::Config::CONFIG_SMC_NONE) {
     // This might over flush if the shm has holes in it
     FEXCore::Context::InvalidateGuestCodeRange(CTX, Base, Length);
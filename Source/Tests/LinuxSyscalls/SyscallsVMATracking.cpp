@@ -8,6 +8,9 @@ $end_info$
 
 #include "Tests/LinuxSyscalls/Syscalls.h"
 
+#include <algorithm>
+#include <new>
+
 namespace FEX::HLE {
 /// List Operations ///
 
@@ -161,6 +164,7 @@ void SyscallHandler::VMATracking::SetUnsafe(FEXCore::Context::Context *CTX, Mapp
 void SyscallHandler::VMATracking::ClearUnsafe(FEXCore::Context::Context *CTX, uintptr_t Base, uintptr_t Length,
                                               MappedResource *PreservedMappedResource) {
   const auto Top = Base + Length;
+  MarkDirtyUnsafe(Base, Top);
 
   // find the first Mapping at or after the Range ends, or ::end()
   // Top is the address after the end
@@ -245,6 +249,7 @@ void SyscallHandler::VMATracking::ClearUnsafe(FEXCore::Context::Context *CTX, ui
 // Change flags of mappings in a range and split the mappings if needed
 void SyscallHandler::VMATracking::ChangeUnsafe(uintptr_t Base, uintptr_t Length, VMAProt NewProt) {
   const auto Top = Base + Length;
+  MarkDirtyUnsafe(Base, Top);
 
   // find the first Mapping at or after the Range ends, or ::end()
   // Top is the address after the end
@@ -349,6 +354,7 @@ uintptr_t SyscallHandler::VMATracking::ClearShmUnsafe(FEXCore::Context::Context
 
   do {
     if (Entry->second.Resource == Resource) {
+      MarkDirtyUnsafe(Entry->second.Base, Entry->second.Base + Entry->second.Length);
       if (ListRemove(&Entry->second)) {
         if (Entry->second.Resource->AOTIRCacheEntry) {
           FEXCore::Context::UnloadAOTIRCacheEntry(CTX, Entry->second.Resource->AOTIRCacheEntry);
@@ -363,4 +369,236 @@ uintptr_t SyscallHandler::VMATracking::ClearShmUnsafe(FEXCore::Context::Context
 
   return ShmLength;
 }
-}
\ No newline at end of file
+
+/// Snapshot Operations ///
+
+thread_local SyscallHandler::VMATracking::SnapshotReaderSlotHolder SyscallHandler::VMATracking::LocalSnapshotReaderSlot{};
+
+auto SyscallHandler::VMASnapshot::Lookup(uint64_t GuestAddr) const -> VMASnapshotEntry const * {
+  auto Entry = std::upper_bound(VMAs.begin(), VMAs.end(), GuestAddr, [](uint64_t Addr, VMASnapshotEntry const &VMA) {
+    return Addr < VMA.Base;
+  });
+
+  if (Entry == VMAs.begin()) {
+    return nullptr;
+  }
+
+  --Entry;
+  return Entry->Top > GuestAddr ? &*Entry : nullptr;
+}
+
+auto SyscallHandler::VMASnapshot::Overlapping(uint64_t Base, uint64_t Top) const -> std::span<VMASnapshotEntry const> {
+  // First VMA that ends after Base
+  auto Begin = std::upper_bound(VMAs.begin(), VMAs.end(), Base, [](uint64_t Addr, VMASnapshotEntry const &VMA) {
+    return Addr < VMA.Top;
+  });
+
+  // First VMA that starts at or after Top
+  auto End = std::lower_bound(Begin, VMAs.end(), Top, [](VMASnapshotEntry const &VMA, uint64_t Addr) {
+    return VMA.Base < Addr;
+  });
+
+  return {Begin, End};
+}
+
+auto SyscallHandler::VMASnapshot::Mirrors(uintptr_t Resource) const -> std::span<VMASnapshotEntry const> {
+  struct Compare {
+    bool operator()(VMASnapshotEntry const &VMA, uintptr_t Resource) const { return VMA.Resource < Resource; }
+    bool operator()(uintptr_t Resource, VMASnapshotEntry const &VMA) const { return Resource < VMA.Resource; }
+  };
+
+  if (!Resource) {
+    return {};
+  }
+
+  auto [Begin, End] = std::equal_range(ResourceVMAs.begin(), ResourceVMAs.end(), Resource, Compare{});
+  return {Begin, End};
+}
+
+void SyscallHandler::VMATracking::MarkDirtyUnsafe(uint64_t Base, uint64_t Top) {
+  DirtyBase = std::min<uint64_t>(DirtyBase, Base);
+  DirtyTop = std::max<uint64_t>(DirtyTop, Top);
+}
+
+void SyscallHandler::VMATracking::PublishSnapshotUnsafe() {
+  if (DirtyBase >= DirtyTop) {
+    // Nothing changed since the last publish
+    return;
+  }
+
+  // Only writers replace the snapshot and they hold Mutex, so this one can't be retired from under us
+  VMASnapshot const *OldSnapshot = Snapshot.load(std::memory_order_relaxed);
+
+  // VMAs that were trimmed or split can reach past the dirty range, rebuild everything they covered
+  auto Replaced = OldSnapshot->Overlapping(DirtyBase, DirtyTop);
+  uint64_t RebuildBase = DirtyBase;
+  uint64_t RebuildTop = DirtyTop;
+  if (!Replaced.empty()) {
+    RebuildBase = std::min(RebuildBase, Replaced.front().Base);
+    RebuildTop = std::max(RebuildTop, Replaced.back().Top);
+  }
+
+  DirtyBase = UINT64_MAX;
+  DirtyTop = 0;
+
+  auto NewSnapshot = new VMASnapshot{};
+  auto &NewVMAs = NewSnapshot->VMAs;
+  NewVMAs.reserve(VMAs.size());
+
+  // VMAs before and after the rebuilt range are the same as in the old snapshot
+  const auto ReplacedBegin = Replaced.data();
+  const auto ReplacedEnd = ReplacedBegin + Replaced.size();
+  NewVMAs.insert(NewVMAs.end(), OldSnapshot->VMAs.data(), ReplacedBegin);
+
+  // Every VMA inside the rebuilt range starts at or after RebuildBase
+  std::vector<VMASnapshotEntry> RebuiltResourceVMAs;
+  for (auto it = VMAs.lower_bound(RebuildBase); it != VMAs.end() && it->first < RebuildTop; ++it) {
+    auto &VMA = it->second;
+
+    VMASnapshotEntry Entry {
+      .Base = VMA.Base,
+      .Top = VMA.Base + VMA.Length,
+      .Offset = VMA.Offset,
+      .Resource = reinterpret_cast<uintptr_t>(VMA.Resource),
+      .Flags = VMA.Flags,
+      .Prot = VMA.Prot,
+    };
+
+    NewVMAs.push_back(Entry);
+
+    if (Entry.Resource) {
+      RebuiltResourceVMAs.push_back(Entry);
+    }
+  }
+
+  NewVMAs.insert(NewVMAs.end(), ReplacedEnd, OldSnapshot->VMAs.data() + OldSnapshot->VMAs.size());
+
+  // Mirrors of a Resource are sorted by Base
+  const auto ByResource = [](VMASnapshotEntry const &Lhs, VMASnapshotEntry const &Rhs) {
+    return Lhs.Resource < Rhs.Resource || (Lhs.Resource == Rhs.Resource && Lhs.Base < Rhs.Base);
+  };
+
+  // Only the rebuilt entries need sorting, they are merged into the ones kept from the old snapshot
+  std::sort(RebuiltResourceVMAs.begin(), RebuiltResourceVMAs.end(), ByResource);
+
+  auto &NewResourceVMAs = NewSnapshot->ResourceVMAs;
+  NewResourceVMAs.reserve(OldSnapshot->ResourceVMAs.size() + RebuiltResourceVMAs.size());
+
+  auto Rebuilt = RebuiltResourceVMAs.begin();
+  for (auto &VMA : OldSnapshot->ResourceVMAs) {
+    if (VMA.Base >= RebuildBase && VMA.Base < RebuildTop) {
+      // Replaced by a rebuilt entry
+      continue;
+    }
+
+    while (Rebuilt != RebuiltResourceVMAs.end() && ByResource(*Rebuilt, VMA)) {
+      NewResourceVMAs.push_back(*Rebuilt++);
+    }
+
+    NewResourceVMAs.push_back(VMA);
+  }
+  NewResourceVMAs.insert(NewResourceVMAs.end(), Rebuilt, RebuiltResourceVMAs.end());
+
+  Snapshot.store(NewSnapshot);
+
+  // Readers that announce the new epoch or a later one loaded the new snapshot
+  const auto RetiredEpoch = SnapshotEpoch.fetch_add(1) + 1;
+
+  FHU::ScopedSignalMaskWithMutex lk(RetiredSnapshotsMutex);
+  RetiredSnapshots.push_back({OldSnapshot, RetiredEpoch});
+}
+
+void SyscallHandler::VMATracking::ReclaimSnapshots() {
+  FHU::ScopedSignalMaskWithMutex lk(RetiredSnapshotsMutex);
+
+  if (RetiredSnapshots.empty()) {
+    return;
+  }
+
+  // Oldest epoch an active reader announced
+  uint64_t OldestReaderEpoch = UINT64_MAX;
+  for (auto Slot = SnapshotReaderSlots.load(); Slot; Slot = Slot->Next) {
+    const auto Epoch = Slot->Epoch.load();
+    if (Epoch) {
+      OldestReaderEpoch = std::min(OldestReaderEpoch, Epoch);
+    }
+  }
+
+  // A reader from before a snapshot's retirement might still be using it, it is left for a later reclaim
+  std::erase_if(RetiredSnapshots, [OldestReaderEpoch](RetiredSnapshot const &Retired) {
+    if (Retired.Epoch > OldestReaderEpoch) {
+      return false;
+    }
+
+    delete Retired.Snapshot;
+    return true;
+  });
+}
+
+void SyscallHandler::VMATracking::ResetSnapshotReadersAfterFork() {
+  // Only the forking thread exists in the child, every other slot is free again
+  for (auto Slot = SnapshotReaderSlots.load(); Slot; Slot = Slot->Next) {
+    if (Slot != LocalSnapshotReaderSlot.Slot) {
+      Slot->Epoch.store(0);
+      Slot->Free.store(true);
+    }
+  }
+
+  // Another parent thread might have been holding it during the fork
+  new (&RetiredSnapshotsMutex) std::mutex{};
+}
+
+SyscallHandler::VMATracking::~VMATracking() {
+  delete Snapshot.load();
+
+  for (auto &Retired : RetiredSnapshots) {
+    delete Retired.Snapshot;
+  }
+
+
+  // Reader slots are left allocated, threads that exit after this still release theirs
+}
+
+auto SyscallHandler::VMATracking::GetSnapshotReaderSlot() -> SnapshotReaderSlot * {
+  auto &Holder = LocalSnapshotReaderSlot;
+  if (Holder.Slot) {
+    return Holder.Slot;
+  }
+
+  // Reuse the slot of a thread that exited
+  for (auto Slot = SnapshotReaderSlots.load(); Slot; Slot = Slot->Next) {
+    bool Expected = true;
+    if (Slot->Free.load() && Slot->Free.compare_exchange_strong(Expected, false)) {
+      Holder.Slot = Slot;
+      return Slot;
+    }
+  }
+
+  // Slots are only ever prepended, a concurrent walk sees either the old or the new head
+  auto Slot = new SnapshotReaderSlot{};
+  Slot->Next = SnapshotReaderSlots.load();
+  while (!SnapshotReaderSlots.compare_exchange_weak(Slot->Next, Slot));
+
+  Holder.Slot = Slot;
+  return Slot;
+}
+
+SyscallHandler::VMATracking::SnapshotReader::SnapshotReader(VMATracking &Tracking)
+  : Slot {Tracking.GetSnapshotReaderSlot()} {
+  // A reader in a signal handler that interrupted another reader on this thread is covered by the outer one's epoch
+  Outermost = Slot->Epoch.load(std::memory_order_relaxed) == 0;
+
+  if (Outermost) {
+    // Must be announced before loading the pointer, ReclaimSnapshots relies on it
+    Slot->Epoch.store(Tracking.SnapshotEpoch.load());
+  }
+
+  Snapshot = Tracking.Snapshot.load();
+}
+
+SyscallHandler::VMATracking::SnapshotReader::~SnapshotReader() {
+  if (Outermost) {
+    Slot->Epoch.store(0);
+  }
+}
+}
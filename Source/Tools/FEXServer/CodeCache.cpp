@@ -0,0 +1,44 @@
+#include "CodeCache.h"
+
+#include <FEXCore/Config/Config.h>
+
+#include <fcntl.h>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace CodeCache {
+  static bool IsValidFileId(std::string_view FileId) {
+    // FileIds come from clients, don't let them escape the aotir folder
+    return !FileId.empty() &&
+      FileId.find('/') == FileId.npos &&
+      FileId != "." && FileId != "..";
+  }
+
+  static std::filesystem::path GetFilepath(std::string_view FileId) {
+    return std::filesystem::path(FEXCore::Config::GetDataDirectory()) / "aotir" / (std::string{FileId} + ".aotir");
+  }
+
+  int GetAOTIRFD(std::string_view FileId) {
+    if (!IsValidFileId(FileId)) {
+      return -1;
+    }
+
+    // Captures rename a new file in to place, so opening on every request always hands out the latest one
+    auto Filepath = GetFilepath(FileId);
+    int FD = open(Filepath.c_str(), O_RDONLY | O_CLOEXEC | O_NOFOLLOW);
+    if (FD == -1) {
+      return -1;
+    }
+
+    struct stat buf{};
+    if (fstat(FD, &buf) == -1 || !S_ISREG(buf.st_mode) || buf.st_size == 0) {
+      close(FD);
+      return -1;
+    }
+
+    return FD;
+  }
+}
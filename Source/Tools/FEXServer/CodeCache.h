@@ -0,0 +1,15 @@
+#pragma once
+#include <string_view>
+
+namespace CodeCache {
+  /**
+   * @brief Returns a read-only FD to the AOTIR cache file for FileId
+   *
+   * Clients map the file MAP_SHARED, so every process shares the same page cache pages.
+   * Only an open happens here, the poll loop never reads file contents.
+   * Every call returns a new FD with its own file offset which the caller must close.
+   *
+   * @return FD or -1 if no cache file exists
+   */
+  int GetAOTIRFD(std::string_view FileId);
+}
@@ -1,4 +1,5 @@
 #include "FEXHeaderUtils/Syscalls.h"
+#include "CodeCache.h"
 #include "Logger.h"
 #include "SquashFS.h"
 
@@ -426,6 +427,33 @@ namespace ProcessPipe {
 
           CurrentOffset += sizeof(FEXServerClient::FEXServerRequestPacket::Header);
           break;
+        }
+        case FEXServerClient::PacketType::TYPE_GET_AOTIR_FD: {
+          constexpr size_t HeaderSize = sizeof(FEXServerClient::FEXServerRequestPacket::AOTIRRequest);
+          if (CurrentRead - CurrentOffset < HeaderSize ||
+              CurrentRead - CurrentOffset - HeaderSize < Req->AOTIRRequest.Length) {
+            // Truncated request, drop the rest of the data
+            LogMan::Msg::EFmt("[FEXServer] Truncated AOTIR request received 0x{:x} bytes", CurrentRead - CurrentOffset);
+            SendEmptyErrorPacket(Socket);
+            CurrentOffset = CurrentRead;
+            break;
+          }
+
+          std::string_view FileId(Req->AOTIRRequest.FileId, Req->AOTIRRequest.Length);
+          int FD = CodeCache::GetAOTIRFD(FileId);
+
+          if (FD == -1) {
+            SendEmptyErrorPacket(Socket);
+          }
+          else {
+            SendFDSuccessPacket(Socket, FD);
+
+            // Close the FD now since we've sent it
+            close(FD);
+          }
+
+          CurrentOffset += HeaderSize + Req->AOTIRRequest.Length;
+          break;
         }
           // Invalid
         case FEXServerClient::PacketType::TYPE_ERROR:
@@ -0,0 +1,295 @@
+#include <catch2/catch.hpp>
+#include "Common/SoftFloat.h"
+
+#include <array>
+#include <cstring>
+#include <random>
+#include <stdint.h>
+
+// Compares X80SoftFloat against plain SoftFloat-3e results.
+// The integer fast paths in X80SoftFloat must be bit identical to SoftFloat, and on x86-64 hosts the JIT
+// lowers F80 arithmetic to the host x87 so that also needs to match for every encoding the x87 can produce.
+
+namespace {
+constexpr size_t Iterations = 50000;
+
+enum class Op {
+  ADD,
+  SUB,
+  MUL,
+  DIV,
+};
+
+struct RoundingConfig {
+  uint8_t SoftFloatMode;
+  uint8_t SoftFloatPrecision;
+  // Matching host FCW with all exceptions masked, as the JIT loads it
+  uint16_t FCW;
+};
+
+constexpr std::array<RoundingConfig, 12> RoundingConfigs = {{
+  {softfloat_round_near_even, 80, 0x037F},
+  {softfloat_round_min,       80, 0x077F},
+  {softfloat_round_max,       80, 0x0B7F},
+  {softfloat_round_minMag,    80, 0x0F7F},
+  {softfloat_round_near_even, 64, 0x027F},
+  {softfloat_round_min,       64, 0x067F},
+  {softfloat_round_max,       64, 0x0A7F},
+  {softfloat_round_minMag,    64, 0x0E7F},
+  {softfloat_round_near_even, 32, 0x007F},
+  {softfloat_round_min,       32, 0x047F},
+  {softfloat_round_max,       32, 0x087F},
+  {softfloat_round_minMag,    32, 0x0C7F},
+}};
+
+void SetSoftFloatRounding(RoundingConfig const &Config) {
+  softfloat_roundingMode = Config.SoftFloatMode;
+  extF80_roundingPrecision = Config.SoftFloatPrecision;
+}
+
+bool Identical(X80SoftFloat const &lhs, X80SoftFloat const &rhs) {
+  return memcmp(&lhs, &rhs, sizeof(X80SoftFloat)) == 0;
+}
+
+bool IsNaN(X80SoftFloat const &Value) {
+  return Value.Exponent == 0x7FFF && (Value.Significand & ((1ULL << 63) - 1));
+}
+
+// Generates operands weighted towards the cases that are hard to get right.
+// Close exponents for cancellation, exponents near the limits for overflow and denormal results,
+// significands with long runs of ones for carries, and every special class.
+class OperandGenerator {
+public:
+  explicit OperandGenerator(uint64_t Seed)
+    : Random {Seed} {}
+
+  X80SoftFloat Next(X80SoftFloat const *Other = nullptr) {
+    const unsigned Sign = Random() & 1;
+    switch (Random() % 16) {
+      case 0: return X80SoftFloat(Sign, 0, 0);
+      case 1: return X80SoftFloat(Sign, 0x7FFF, IntegerBit);
+      case 2: return X80SoftFloat(Sign, 0x7FFF, IntegerBit | (1ULL << 62) | (Random() & Bottom62Significand));
+      case 3: return X80SoftFloat(Sign, 0x7FFF, IntegerBit | 1 | (Random() & Bottom62Significand));
+      case 4: return X80SoftFloat(Sign, 0, Random() & ~IntegerBit);
+      case 5: return X80SoftFloat(Sign, 1 + Random() % 64, NextSignificand());
+      case 6: return X80SoftFloat(Sign, 0x7FFE - Random() % 64, NextSignificand());
+      case 7:
+      case 8:
+      case 9:
+        if (Other && Other->Exponent != 0 && Other->Exponent != 0x7FFF) {
+          // Exponent within a couple of significand widths of the other operand
+          const int32_t Exponent = static_cast<int32_t>(Other->Exponent) + static_cast<int32_t>(Random() % 131) - 65;
+          if (Exponent > 0 && Exponent < 0x7FFF) {
+            return X80SoftFloat(Sign, Exponent, NextSignificand());
+          }
+        }
+        [[fallthrough]];
+      default: return X80SoftFloat(Sign, 1 + Random() % 0x7FFE, NextSignificand());
+    }
+  }
+
+private:
+  static constexpr uint64_t IntegerBit = 1ULL << 63;
+  static constexpr uint64_t Bottom62Significand = (1ULL << 62) - 1;
+
+  uint64_t NextSignificand() {
+    switch (Random() % 6) {
+      case 0: return IntegerBit;
+      case 1: return ~0ULL;
+      case 2: return IntegerBit | 1;
+      case 3: return ~0ULL << (Random() % 63);
+      default: return IntegerBit | Random();
+    }
+  }
+
+  std::mt19937_64 Random;
+};
+
+X80SoftFloat SoftFloatOp(Op Operation, X80SoftFloat const &lhs, X80SoftFloat const &rhs) {
+  switch (Operation) {
+    case Op::ADD: return extF80_add(lhs, rhs);
+    case Op::SUB: return extF80_sub(lhs, rhs);
+    case Op::MUL: return extF80_mul(lhs, rhs);
+    case Op::DIV: return extF80_div(lhs, rhs);
+  }
+  return {};
+}
+
+X80SoftFloat X80Op(Op Operation, X80SoftFloat const &lhs, X80SoftFloat const &rhs) {
+  switch (Operation) {
+    case Op::ADD: return X80SoftFloat::FADD(lhs, rhs);
+    case Op::SUB: return X80SoftFloat::FSUB(lhs, rhs);
+    case Op::MUL: return X80SoftFloat::FMUL(lhs, rhs);
+    case Op::DIV: return X80SoftFloat::FDIV(lhs, rhs);
+  }
+  return {};
+}
+
+#ifdef _M_X86_64
+// Same sequence the x86-64 JIT emits for F80Add/Sub/Mul/Div, with st1 = lhs and st0 = rhs.
+// ModRM selects the DE /r pop op, whose Intel form computes st1 = st1 op st0.
+template<uint8_t ModRM>
+X80SoftFloat HostOp(X80SoftFloat const &lhs, X80SoftFloat const &rhs, uint16_t FCW) {
+  uint16_t OriginalFCW;
+  X80SoftFloat Result;
+  asm volatile(R"(
+    fnstcw %[Original];
+    fldcw %[FCW];
+    fldt %[lhs];
+    fldt %[rhs];
+    .byte 0xDE, %c[ModRM];
+    fstpt %[Result];
+    fldcw %[Original];
+  )"
+  : [Result] "=m" (Result), [Original] "=m" (OriginalFCW)
+  : [lhs] "m" (lhs), [rhs] "m" (rhs), [FCW] "m" (FCW), [ModRM] "i" (ModRM)
+  : "st", "st(1)");
+
+  return Result;
+}
+
+X80SoftFloat HostOp(Op Operation, X80SoftFloat const &lhs, X80SoftFloat const &rhs, uint16_t FCW) {
+  switch (Operation) {
+    case Op::ADD: return HostOp<0xC1>(lhs, rhs, FCW); // faddp st1, st0
+    case Op::SUB: return HostOp<0xE9>(lhs, rhs, FCW); // fsubp st1, st0
+    case Op::MUL: return HostOp<0xC9>(lhs, rhs, FCW); // fmulp st1, st0
+    case Op::DIV: return HostOp<0xF9>(lhs, rhs, FCW); // fdivp st1, st0
+  }
+  return {};
+}
+
+// Same flag mapping the x86-64 JIT emits for F80Cmp
+void HostCompare(X80SoftFloat const &lhs, X80SoftFloat const &rhs, bool *eq, bool *lt, bool *nan) {
+  uint8_t CF, ZF, PF;
+  asm volatile(R"(
+    fldt %[rhs];
+    fldt %[lhs];
+    fucomip %%st(1), %%st;
+    fstp %%st(0);
+    setb %[CF];
+    setz %[ZF];
+    setp %[PF];
+  )"
+  : [CF] "=m" (CF), [ZF] "=m" (ZF), [PF] "=m" (PF)
+  : [lhs] "m" (lhs), [rhs] "m" (rhs)
+  : "st", "st(1)", "cc");
+
+  *lt = CF ^ PF;
+  *eq = ZF ^ PF;
+  *nan = PF;
+}
+#endif
+
+void CheckFastPathMatchesSoftFloat(Op Operation, uint64_t Seed) {
+  OperandGenerator Generator{Seed};
+
+  for (auto const &Config : RoundingConfigs) {
+    SetSoftFloatRounding(Config);
+    for (size_t i = 0; i < Iterations; ++i) {
+      const auto lhs = Generator.Next();
+      const auto rhs = Generator.Next(&lhs);
+
+      const auto Expected = SoftFloatOp(Operation, lhs, rhs);
+      const auto Result = X80Op(Operation, lhs, rhs);
+      INFO("FCW " << std::hex << Config.FCW << " lhs " << lhs.str() << " rhs " << rhs.str());
+      REQUIRE(Identical(Result, Expected));
+    }
+  }
+  SetSoftFloatRounding(RoundingConfigs[0]);
+}
+
+#ifdef _M_X86_64
+void CheckHostMatchesSoftFloat(Op Operation, uint64_t Seed) {
+  OperandGenerator Generator{Seed};
+
+  for (auto const &Config : RoundingConfigs) {
+    SetSoftFloatRounding(Config);
+    for (size_t i = 0; i < Iterations; ++i) {
+      const auto lhs = Generator.Next();
+      const auto rhs = Generator.Next(&lhs);
+
+      const auto Expected = SoftFloatOp(Operation, lhs, rhs);
+      const auto Result = HostOp(Operation, lhs, rhs, Config.FCW);
+      INFO("FCW " << std::hex << Config.FCW << " lhs " << lhs.str() << " rhs " << rhs.str());
+      if (IsNaN(Expected)) {
+        // NaN payload propagation isn't part of what the JIT guarantees
+        REQUIRE(IsNaN(Result));
+      }
+      else {
+        REQUIRE(Identical(Result, Expected));
+      }
+    }
+  }
+  SetSoftFloatRounding(RoundingConfigs[0]);
+}
+#endif
+}
+
+TEST_CASE("F80 Add matches SoftFloat") {
+  CheckFastPathMatchesSoftFloat(Op::ADD, 1);
+}
+
+TEST_CASE("F80 Sub matches SoftFloat") {
+  CheckFastPathMatchesSoftFloat(Op::SUB, 2);
+}
+
+TEST_CASE("F80 Mul matches SoftFloat") {
+  CheckFastPathMatchesSoftFloat(Op::MUL, 3);
+}
+
+TEST_CASE("F80 Div matches SoftFloat") {
+  CheckFastPathMatchesSoftFloat(Op::DIV, 4);
+}
+
+TEST_CASE("F80 Cmp matches SoftFloat") {
+  OperandGenerator Generator{5};
+
+  for (size_t i = 0; i < Iterations; ++i) {
+    const auto lhs = Generator.Next();
+    // Compare against itself some of the time so equality gets coverage
+    const auto rhs = (i % 8) == 0 ? lhs : Generator.Next(&lhs);
+
+    bool eq, lt, nan;
+    X80SoftFloat::FCMP(lhs, rhs, &eq, &lt, &nan);
+    INFO("lhs " << lhs.str() << " rhs " << rhs.str());
+    REQUIRE(eq == extF80_eq(lhs, rhs));
+    REQUIRE(lt == extF80_lt(lhs, rhs));
+    REQUIRE(nan == (IsNaN(lhs) || IsNaN(rhs)));
+  }
+}
+
+#ifdef _M_X86_64
+TEST_CASE("Host x87 Add matches SoftFloat") {
+  CheckHostMatchesSoftFloat(Op::ADD, 6);
+}
+
+TEST_CASE("Host x87 Sub matches SoftFloat") {
+  CheckHostMatchesSoftFloat(Op::SUB, 7);
+}
+
+TEST_CASE("Host x87 Mul matches SoftFloat") {
+  CheckHostMatchesSoftFloat(Op::MUL, 8);
+}
+
+TEST_CASE("Host x87 Div matches SoftFloat") {
+  CheckHostMatchesSoftFloat(Op::DIV, 9);
+}
+
+TEST_CASE("Host x87 Cmp matches SoftFloat") {
+  OperandGenerator Generator{10};
+
+  for (size_t i = 0; i < Iterations; ++i) {
+    const auto lhs = Generator.Next();
+    const auto rhs = (i % 8) == 0 ? lhs : Generator.Next(&lhs);
+
+    bool eq, lt, nan;
+    bool HostEq, HostLt, HostNaN;
+    X80SoftFloat::FCMP(lhs, rhs, &eq, &lt, &nan);
+    HostCompare(lhs, rhs, &HostEq, &HostLt, &HostNaN);
+    INFO("lhs " << lhs.str() << " rhs " << rhs.str());
+    REQUIRE(HostEq == eq);
+    REQUIRE(HostLt == lt);
+    REQUIRE(HostNaN == nan);
+  }
+}
+#endif
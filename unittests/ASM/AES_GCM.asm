@@ -0,0 +1,169 @@
+%ifdef CONFIG
+{
+  "RegData": {
+    "XMM0": ["0x92A3B660CEDA8803", "0x78FEB271B9C228F3"],
+    "XMM1": ["0xBD13EC2CD4476EAB", "0xDFBD5712B2673AF5"]
+  },
+  "MemoryRegions": {
+    "0x100000000": "4096"
+  },
+  "Env": { "FEX_SOFTWARECRYPTO": "1" }
+}
+%endif
+
+; AES-128-GCM encryption of one block, test case 2 from the GCM specification.
+; Key, IV and plaintext are all zero.
+; XMM0 is the ciphertext and XMM1 is the tag.
+; Hosts without AES or PMULL run this through the software crypto fallbacks.
+
+; Expands the next round key in to xmm1 and stores it
+%macro expandkey 2
+  aeskeygenassist xmm2, xmm1, %1
+  pshufd xmm2, xmm2, 0xFF
+  movaps xmm3, xmm1
+  pslldq xmm3, 4
+  pxor xmm1, xmm3
+  pslldq xmm3, 4
+  pxor xmm1, xmm3
+  pslldq xmm3, 4
+  pxor xmm1, xmm3
+  pxor xmm1, xmm2
+  movaps [rdi + 16 * %2], xmm1
+%endmacro
+
+; Encrypts %1 in place with the round keys at rdi
+%macro encrypt 1
+  pxor %1, [rdi + 16 * 0]
+  aesenc %1, [rdi + 16 * 1]
+  aesenc %1, [rdi + 16 * 2]
+  aesenc %1, [rdi + 16 * 3]
+  aesenc %1, [rdi + 16 * 4]
+  aesenc %1, [rdi + 16 * 5]
+  aesenc %1, [rdi + 16 * 6]
+  aesenc %1, [rdi + 16 * 7]
+  aesenc %1, [rdi + 16 * 8]
+  aesenc %1, [rdi + 16 * 9]
+  aesenclast %1, [rdi + 16 * 10]
+%endmacro
+
+; xmm4 = xmm4 * xmm5 in GF(2^128), both byte reflected
+; Carryless multiply then shift and reduce, clobbers xmm6-xmm12
+%macro gfmul 0
+  movaps xmm6, xmm4
+  pclmulqdq xmm6, xmm5, 0x00
+  movaps xmm7, xmm4
+  pclmulqdq xmm7, xmm5, 0x10
+  movaps xmm8, xmm4
+  pclmulqdq xmm8, xmm5, 0x01
+  movaps xmm9, xmm4
+  pclmulqdq xmm9, xmm5, 0x11
+
+  pxor xmm7, xmm8
+  movaps xmm8, xmm7
+  pslldq xmm8, 8
+  psrldq xmm7, 8
+  pxor xmm6, xmm8
+  pxor xmm9, xmm7
+
+  ; Shift the 256-bit product xmm9:xmm6 left by one
+  movaps xmm10, xmm6
+  psrld xmm10, 31
+  movaps xmm11, xmm9
+  psrld xmm11, 31
+  pslld xmm6, 1
+  pslld xmm9, 1
+  movaps xmm12, xmm10
+  psrldq xmm12, 12
+  pslldq xmm11, 4
+  pslldq xmm10, 4
+  por xmm6, xmm10
+  por xmm9, xmm11
+  por xmm9, xmm12
+
+  ; Reduce modulo x^128 + x^7 + x^2 + x + 1
+  movaps xmm10, xmm6
+  pslld xmm10, 31
+  movaps xmm11, xmm6
+  pslld xmm11, 30
+  movaps xmm12, xmm6
+  pslld xmm12, 25
+  pxor xmm10, xmm11
+  pxor xmm10, xmm12
+  movaps xmm11, xmm10
+  psrldq xmm11, 4
+  pslldq xmm10, 12
+  pxor xmm6, xmm10
+
+  movaps xmm7, xmm6
+  psrld xmm7, 1
+  movaps xmm8, xmm6
+  psrld xmm8, 2
+  movaps xmm10, xmm6
+  psrld xmm10, 7
+  pxor xmm7, xmm8
+  pxor xmm7, xmm10
+  pxor xmm7, xmm11
+  pxor xmm6, xmm7
+  pxor xmm9, xmm6
+  movaps xmm4, xmm9
+%endmacro
+
+mov rdi, 0x100000000
+lea rdx, [rel .data]
+
+movaps xmm1, [rdx + 16 * 0]
+movaps [rdi + 16 * 0], xmm1
+expandkey 0x01, 1
+expandkey 0x02, 2
+expandkey 0x04, 3
+expandkey 0x08, 4
+expandkey 0x10, 5
+expandkey 0x20, 6
+expandkey 0x40, 7
+expandkey 0x80, 8
+expandkey 0x1B, 9
+expandkey 0x36, 10
+
+movaps xmm15, [rdx + 16 * 4]
+
+; Hash key H = E(K, 0), byte reflected
+pxor xmm5, xmm5
+encrypt xmm5
+pshufb xmm5, xmm15
+
+; Ciphertext = P ^ E(K, IV || 2)
+movaps xmm0, [rdx + 16 * 2]
+encrypt xmm0
+pxor xmm0, [rdx + 16 * 1]
+
+; GHASH over the ciphertext block then the length block
+movaps xmm4, xmm0
+pshufb xmm4, xmm15
+gfmul
+movaps xmm13, [rdx + 16 * 5]
+pshufb xmm13, xmm15
+pxor xmm4, xmm13
+gfmul
+pshufb xmm4, xmm15
+
+; Tag = E(K, IV || 1) ^ GHASH
+movaps xmm1, [rdx + 16 * 3]
+encrypt xmm1
+pxor xmm1, xmm4
+
+hlt
+
+align 16
+.data:
+; Key
+dq 0, 0
+; Plaintext
+dq 0, 0
+; IV || 2
+dq 0, 0x0200000000000000
+; IV || 1
+dq 0, 0x0100000000000000
+; Byte reverse shuffle
+dq 0x08090A0B0C0D0E0F, 0x0001020304050607
+; Length block, no AAD and 128 bits of ciphertext
+dq 0, 0x8000000000000000
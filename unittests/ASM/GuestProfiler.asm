@@ -0,0 +1,61 @@
+%ifdef CONFIG
+{
+  "RegData": {
+    "RBX": "0x30000",
+    "RSI": "0x100",
+    "R8":  "0x0"
+  },
+  "MemoryRegions": {
+    "0x100000000": "4096"
+  },
+  "Env": { "FEX_GUESTPROFILER" : "1" }
+}
+%endif
+
+; Runs with the guest profiler sampling and counting exits.
+; Exercises each counted exit path: dispatcher lookups, fallback handlers and syscalls.
+; Results must not be affected by samples landing anywhere in the JIT code.
+
+mov rsp, 0xe0000010
+lea rdx, [rel data]
+
+; Hot loop through an indirect jump
+mov rbx, 0
+mov rcx, 0x30000
+lea rdi, [rel loop_target]
+loop_top:
+jmp rdi
+loop_target:
+inc rbx
+dec rcx
+jnz loop_top
+
+; x87 transcendental ops go through the fallback handlers
+mov rsi, 0
+mov rcx, 0x100
+fallback_loop:
+fld tword [rdx]
+fsin
+fstp st0
+inc rsi
+dec rcx
+jnz fallback_loop
+
+; Syscalls through the handler
+mov r8, 0
+mov r9, 16
+syscall_loop:
+mov rax, 39 ; getpid
+syscall
+cmp rax, 0
+setle r10b
+or r8b, r10b
+dec r9
+jnz syscall_loop
+
+hlt
+
+align 8
+data:
+  dt 1.0
+  dq 0
@@ -0,0 +1,71 @@
+%ifdef CONFIG
+{
+  "RegData": {
+    "RAX": "0x00000A0A0B0B0B0B",
+    "RCX": "4",
+    "RSI": "0"
+  }
+}
+%endif
+
+; A single indirect jump site cycling through more targets than its inline cache holds.
+; Each target adds a distinct value so a jump to the wrong target shows up in the result.
+
+mov rax, 0
+mov rsi, 64
+mov rcx, 0
+lea rbx, [rel table]
+
+loop_top:
+movsxd rdx, dword [rbx + rcx * 4]
+add rdx, rbx
+jmp rdx
+
+next:
+inc rcx
+cmp rcx, 6
+jne nowrap
+mov rcx, 0
+nowrap:
+dec rsi
+jnz loop_top
+
+hlt
+
+target0:
+mov r8, 0x1
+add rax, r8
+jmp next
+
+target1:
+mov r8, 0x100
+add rax, r8
+jmp next
+
+target2:
+mov r8, 0x10000
+add rax, r8
+jmp next
+
+target3:
+mov r8, 0x1000000
+add rax, r8
+jmp next
+
+target4:
+mov r8, 0x100000000
+add rax, r8
+jmp next
+
+target5:
+mov r8, 0x10000000000
+add rax, r8
+jmp next
+
+table:
+dd target0 - table
+dd target1 - table
+dd target2 - table
+dd target3 - table
+dd target4 - table
+dd target5 - table
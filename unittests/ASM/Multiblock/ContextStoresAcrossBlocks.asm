@@ -0,0 +1,46 @@
+%ifdef CONFIG
+{
+  "Match": "All",
+  "RegData": {
+    "RAX": "0x414",
+    "RDX": "0x14",
+    "R9":  "0x4"
+  }
+}
+%endif
+
+; A GPR, an XMM register and the flags are written in one block,
+; overwritten on one path and read after the paths join.
+; Dead store elimination across blocks must keep the stores read through the other path.
+
+mov rax, 0
+mov rdx, 0
+mov r9, 0
+mov rcx, 8
+
+loop_top:
+mov rbx, rcx
+movq xmm0, rcx
+test rcx, 1
+jz even
+
+; Odd iterations overwrite everything before the join
+mov rbx, 0x100
+pxor xmm0, xmm0
+cmp rcx, 0
+jmp join
+
+even:
+nop
+
+join:
+setz r8b
+movzx r8d, r8b
+add r9, r8
+add rax, rbx
+movq rdi, xmm0
+add rdx, rdi
+dec rcx
+jnz loop_top
+
+hlt
@@ -0,0 +1,95 @@
+%ifdef CONFIG
+{
+  "RegData": {
+    "R8":  "0x95",
+    "R9":  "0x814",
+    "R10": "0x55",
+    "R11": "0x894",
+    "R12": "0x55",
+    "R13": "0x810",
+    "R14": "0x841",
+    "R15": "0xF"
+  },
+  "MemoryRegions": {
+    "0x100000000": "4096"
+  }
+}
+%endif
+
+; CF, ZF, SF and OF are packed in to one NZCV word.
+; Check each operand size and the paths that only update some of them.
+
+mov rsp, 0xe0000010
+
+; 8-bit compare with garbage in the upper bits, 0x01 - 0x02 borrows: CF SF AF PF
+mov eax, 0x1201
+mov ecx, 0x3402
+cmp al, cl
+pushfq
+pop r8
+and r8, 0x8D5
+
+; 16-bit signed overflow, 0x8000 - 1: OF AF PF
+mov eax, 0x8000
+cmp ax, 1
+pushfq
+pop r9
+and r9, 0x8D5
+
+; 32-bit carry out to zero: CF ZF AF PF
+mov eax, 0xFFFFFFFF
+add eax, 1
+pushfq
+pop r10
+and r10, 0x8D5
+
+; 64-bit signed overflow: OF SF AF PF
+mov rax, 0x7FFFFFFFFFFFFFFF
+add rax, 1
+pushfq
+pop r11
+and r11, 0x8D5
+
+; INC and DEC leave CF alone
+stc
+mov eax, 0xFF
+inc al
+pushfq
+pop r12
+and r12, 0x8D5
+
+clc
+mov eax, 0x80
+dec al
+pushfq
+pop r13
+and r13, 0x8D5
+
+; SAHF only writes the low byte, OF survives
+push 0x800
+popfq
+mov ah, 0x41
+sahf
+pushfq
+pop r14
+and r14, 0x8D5
+
+; Conditions after popf read the packed flags
+; lea so the flags survive between the jumps
+push 0x8C1
+popfq
+mov r15, 0
+jnc .nc
+lea r15, [r15 + 1]
+.nc:
+jnz .nz
+lea r15, [r15 + 2]
+.nz:
+jns .ns
+lea r15, [r15 + 4]
+.ns:
+jno .no
+lea r15, [r15 + 8]
+.no:
+
+hlt
@@ -0,0 +1,51 @@
+%ifdef CONFIG
+{
+  "RegData": {
+    "RBX": "0x12",
+    "RDX": "0x1",
+    "RSI": "0x216",
+    "RDI": "0x1",
+    "R8":  "0x1"
+  },
+  "MemoryRegions": {
+    "0x100000000": "4096"
+  }
+}
+%endif
+
+; PF and AF are stored as raw result bytes and decoded when read.
+; Make sure every way of observing them still sees the architectural value.
+
+mov rsp, 0xe0000010
+
+; 0x0F + 1 = 0x10: AF set, odd parity so PF clear
+mov rax, 0x0F
+add al, 1
+lahf
+movzx rbx, ah
+
+; Only the low byte of the result contributes to PF
+mov rdx, 0
+mov rcx, 0x100000003
+add rcx, 0
+setp dl
+
+; PF and AF round trip through popf and pushf
+push 0x216
+popfq
+pushfq
+pop rsi
+
+mov rdi, 0
+jnp .skip
+mov rdi, 1
+.skip:
+
+; A zero count shift leaves PF untouched
+mov r8, 0
+xor eax, eax
+mov cl, 0
+shl r9, cl
+setp r8b
+
+hlt
@@ -0,0 +1,33 @@
+%ifdef CONFIG
+{
+  "RegData": {
+    "RAX": "0x3",
+    "RBX": "0x6",
+    "RCX": "0x0"
+  },
+  "Env": { "FEX_SMCCHECKS" : "full" }
+}
+%endif
+
+; Rewrites the immediate of an instruction in a block that has already been compiled.
+; Every call must see the new code through the block entry validation.
+
+mov rsp, 0xe0000010
+mov rbx, 0
+mov rcx, 3
+
+.loop:
+call patched
+add rbx, rax
+
+; mov eax, imm32 is B8 followed by the immediate
+inc dword [rel patched + 1]
+
+dec rcx
+jnz .loop
+
+hlt
+
+patched:
+mov eax, 1
+ret
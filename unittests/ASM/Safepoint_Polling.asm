@@ -0,0 +1,38 @@
+%ifdef CONFIG
+{
+  "RegData": {
+    "RAX": "0x10000",
+    "RBX": "0x20000",
+    "RDX": "0x0"
+  },
+  "Env": { "FEX_SAFEPOINTPOLLING" : "1", "FEX_MULTIBLOCK" : "1" }
+}
+%endif
+
+; Runs with a safepoint poll at every guest block entry.
+; Covers a backward branch inside a multiblock region and exits linked between blocks.
+; The polls must not disturb any guest state when no request is pending.
+
+mov rsp, 0xe0000010
+mov rax, 0
+mov rbx, 0
+mov rcx, 0x10000
+
+; Backward branch within the block
+loop_top:
+inc rax
+add rbx, 2
+dec rcx
+jnz loop_top
+
+; Linked calls between blocks
+mov rdx, 0x100
+call_loop:
+call func
+dec rdx
+jnz call_loop
+
+hlt
+
+func:
+ret
@@ -0,0 +1,69 @@
+%ifdef CONFIG
+{
+  "RegData": {
+    "RAX": "0x7A324",
+    "RBX": "0x1F4",
+    "RCX": "0x10",
+    "R8":  "0x9C4"
+  },
+  "Env": { "FEX_TIERUPTHRESHOLD" : "16" }
+}
+%endif
+
+; Runs the loop well past the tier-up threshold so it is recompiled as a hot region mid-loop.
+; The region pulls in the call, the return's predicted target and both sides of the conditional branch.
+; The computed jump changes target every iteration so it stays an exit to the dispatcher.
+; The call after the loop runs the function again from code outside of the region.
+
+mov rsp, 0xe0000010
+mov rax, 0
+mov rbx, 0
+mov r8, 0
+mov rcx, 1000
+
+loop_top:
+call add_counter
+
+; Count the odd iterations
+test rcx, 1
+jz even
+inc rbx
+even:
+
+; Add (rcx & 3) + 1 through a computed jump
+mov rdx, rcx
+and rdx, 3
+shl rdx, 4
+lea rsi, [rel cases]
+add rsi, rdx
+jmp rsi
+
+cases_done:
+dec rcx
+jnz loop_top
+
+mov rcx, 0x10
+call add_counter
+
+hlt
+
+add_counter:
+add rax, rcx
+ret
+
+align 16
+cases:
+add r8, 1
+jmp cases_done
+
+align 16
+add r8, 2
+jmp cases_done
+
+align 16
+add r8, 3
+jmp cases_done
+
+align 16
+add r8, 4
+jmp cases_done
@@ -0,0 +1,32 @@
+%ifdef CONFIG
+{
+  "RegData": {
+    "RAX": "0x210",
+    "RBX": "0x5dfe780ceede51",
+    "RDX": "0x20"
+  },
+  "Env": { "FEX_TIERUPTHRESHOLD" : "8" }
+}
+%endif
+
+; The loop starts out compiled in the cold tier with the linear scan allocator.
+; After eight entries it gets recompiled as a hot region with the graph coloring allocator.
+; Both need to agree on every value carried between iterations.
+
+mov rax, 0
+mov rbx, 1
+mov rcx, 32
+pxor xmm0, xmm0
+mov rdx, 1
+movq xmm1, rdx
+
+loop_top:
+add rax, rcx
+imul rbx, rbx, 3
+xor rbx, rax
+paddq xmm0, xmm1
+dec rcx
+jnz loop_top
+
+movq rdx, xmm0
+hlt
@@ -0,0 +1,92 @@
+%ifdef CONFIG
+{
+  "RegData": {
+    "RAX": "0x40000001",
+    "RBX": "0x49584546",
+    "RCX": "0x49584546",
+    "RDX": "0x00554D45",
+    "R15": "0"
+  },
+  "MemoryRegions": {
+    "0x100000000": "4096"
+  }
+}
+%endif
+
+; CPUID with a constant function and leaf gets folded at compile time.
+; Compare those results against the same functions executed with values the JIT can't see through.
+
+mov rsp, 0xe0000010
+mov r15, 0
+
+; Function, Leaf
+%macro check 2
+  ; Runtime lookup, going through memory hides the values from the JIT
+  mov r12d, %1
+  push r12
+  pop rax
+  mov r12d, %2
+  push r12
+  pop rcx
+  cpuid
+  mov r8d, eax
+  mov r9d, ebx
+  mov r10d, ecx
+  mov r11d, edx
+
+  ; Constant function with an unknown leaf
+  mov r12d, %2
+  push r12
+  pop rcx
+  mov eax, %1
+  cpuid
+  xor eax, r8d
+  xor ebx, r9d
+  xor ecx, r10d
+  xor edx, r11d
+  or r15d, eax
+  or r15d, ebx
+  or r15d, ecx
+  or r15d, edx
+
+  ; Constant function and leaf
+  mov eax, %1
+  mov ecx, %2
+  cpuid
+  xor eax, r8d
+  xor ebx, r9d
+  xor ecx, r10d
+  xor edx, r11d
+  or r15d, eax
+  or r15d, ebx
+  or r15d, ecx
+  or r15d, edx
+%endmacro
+
+check 0x0, 0
+check 0x1, 0
+check 0x4, 1
+check 0x4, 7
+check 0x7, 0
+check 0x7, 1
+check 0xD, 0
+check 0xD, 1
+check 0xD, 2
+check 0x15, 0
+check 0x20, 0
+check 0x4000_0001, 0
+check 0x8000_0000, 0
+check 0x8000_0001, 0
+check 0x8000_0002, 0
+check 0x8000_0006, 0
+check 0x8000_0008, 0
+check 0x8000_001D, 3
+check 0x8000_0100, 0
+check 0xC000_0000, 0
+
+; Hypervisor information leaf has known contents
+mov eax, 0x4000_0000
+mov ecx, 0
+cpuid
+
+hlt
@@ -0,0 +1,122 @@
+%ifdef CONFIG
+{
+  "RegData": {
+    "RAX": "0x0000000000010100",
+    "RBX": "0x0000000000000000",
+    "MM0": ["0xFFFFFFFFFFFFFFFE", "0xBFFE"],
+    "MM1": ["0xFFFFFFFFFFFFFFFE", "0x4000"],
+    "MM2": ["0xAAAAAAAAAAAAAAAB", "0x3FFD"],
+    "MM3": ["0x8000000000000002", "0x3FFF"],
+    "MM4": ["0x8000000000000000", "0x3FC0"],
+    "MM5": ["0x8000000000000000", "0x4000"],
+    "MM6": ["0x8000000000000002", "0x3FFF"],
+    "MM7": ["0x8000000000000000", "0x3FFF"]
+  }
+}
+%endif
+
+; Rounding edge cases at full 64-bit precision with round to nearest.
+; Expected values match SoftFloat's extF80 results.
+
+lea rdx, [rel data]
+mov rax, 0
+
+; Compares, setb in the low byte and sete in the second
+; 1.0 < 1.0 + ulp
+fld tword [rdx + 16 * 1]
+fld tword [rdx + 16 * 0]
+fcomi st0, st1
+setb al
+sete ah
+fstp st0
+fstp st0
+shl rax, 16
+
+; -0.0 == +0.0
+fldz
+fldz
+fchs
+fcomi st0, st1
+setb al
+sete ah
+fstp st0
+fstp st0
+
+; 1.0 + ulp > 1.0
+mov rbx, 0
+fld tword [rdx + 16 * 0]
+fld tword [rdx + 16 * 1]
+fcomi st0, st1
+setb bl
+sete bh
+fstp st0
+fstp st0
+
+; 1.0 + 2^-64, tie rounds down to even
+fld tword [rdx + 16 * 0]
+fld tword [rdx + 16 * 2]
+faddp
+
+; (1.0 + ulp) + 2^-64, tie rounds up to even
+fld tword [rdx + 16 * 1]
+fld tword [rdx + 16 * 2]
+faddp
+
+; Largest significand below 2.0 + 2^-64, carries in to the exponent
+fld tword [rdx + 16 * 3]
+fld tword [rdx + 16 * 2]
+faddp
+
+; (1.0 + ulp) - 1.0, cancels down to the last bit
+fld tword [rdx + 16 * 1]
+fld tword [rdx + 16 * 0]
+fsubp
+
+; (1.0 + ulp) * (1.0 + ulp), drops the 2^-126 term
+fld tword [rdx + 16 * 1]
+fld tword [rdx + 16 * 1]
+fmulp
+
+; 1.0 / 3.0 rounds up
+fld tword [rdx + 16 * 0]
+fld tword [rdx + 16 * 4]
+fdivp
+
+; Largest significand squared
+fld tword [rdx + 16 * 3]
+fld tword [rdx + 16 * 3]
+fmulp
+
+; 1.0 - largest significand below 2.0
+fld tword [rdx + 16 * 0]
+fld tword [rdx + 16 * 3]
+fsubp
+
+hlt
+
+align 16
+data:
+; 1.0
+dq 0x8000000000000000
+dw 0x3FFF
+times 6 db 0
+
+; 1.0 + 2^-63
+dq 0x8000000000000001
+dw 0x3FFF
+times 6 db 0
+
+; 2^-64
+dq 0x8000000000000000
+dw 0x3FBF
+times 6 db 0
+
+; 2.0 - 2^-63
+dq 0xFFFFFFFFFFFFFFFF
+dw 0x3FFF
+times 6 db 0
+
+; 3.0
+dq 0xC000000000000000
+dw 0x4000
+times 6 db 0
@@ -0,0 +1,90 @@
+%ifdef CONFIG
+{
+  "RegData": {
+    "MM0": ["0xAAAAAB0000000000", "0x3FFD"],
+    "MM1": ["0xAAAAAAAAAAAAA800", "0x3FFD"],
+    "MM2": ["0xAAAAAAAAAAAAAAAA", "0x3FFD"],
+    "MM3": ["0xAAAAAAAAAAAAAAAA", "0xBFFD"],
+    "MM4": ["0xAAAAAAAAAAAAAAAB", "0x3FFD"],
+    "MM5": ["0xAAAAAAAAAAAAAAAB", "0xBFFD"],
+    "MM6": ["0xAAAAAAAAAAAAAAAA", "0x3FFD"],
+    "MM7": ["0xAAAAAAAAAAAAAAAB", "0x3FFD"]
+  }
+}
+%endif
+
+; +-1.0 / 3.0 under every rounding control, then at 53 and 24-bit precision.
+; Expected values match the x87's results.
+
+lea rdx, [rel data]
+
+; Round to nearest
+fldcw [rdx + 16 * 3]
+fld tword [rdx + 16 * 0]
+fld tword [rdx + 16 * 2]
+fdivp
+
+; Round down
+fldcw [rdx + 16 * 3 + 2]
+fld tword [rdx + 16 * 0]
+fld tword [rdx + 16 * 2]
+fdivp
+fld tword [rdx + 16 * 1]
+fld tword [rdx + 16 * 2]
+fdivp
+
+; Round up
+fldcw [rdx + 16 * 3 + 4]
+fld tword [rdx + 16 * 0]
+fld tword [rdx + 16 * 2]
+fdivp
+fld tword [rdx + 16 * 1]
+fld tword [rdx + 16 * 2]
+fdivp
+
+; Round toward zero
+fldcw [rdx + 16 * 3 + 6]
+fld tword [rdx + 16 * 0]
+fld tword [rdx + 16 * 2]
+fdivp
+
+; 53-bit precision
+fldcw [rdx + 16 * 3 + 8]
+fld tword [rdx + 16 * 0]
+fld tword [rdx + 16 * 2]
+fdivp
+
+; 24-bit precision
+fldcw [rdx + 16 * 3 + 10]
+fld tword [rdx + 16 * 0]
+fld tword [rdx + 16 * 2]
+fdivp
+
+fldcw [rdx + 16 * 3]
+
+hlt
+
+align 16
+data:
+; 1.0
+dq 0x8000000000000000
+dw 0x3FFF
+times 6 db 0
+
+; -1.0
+dq 0x8000000000000000
+dw 0xBFFF
+times 6 db 0
+
+; 3.0
+dq 0xC000000000000000
+dw 0x4000
+times 6 db 0
+
+; FCW values
+dw 0x037F
+dw 0x077F
+dw 0x0B7F
+dw 0x0F7F
+dw 0x027F
+dw 0x007F
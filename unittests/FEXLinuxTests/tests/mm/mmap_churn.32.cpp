@@ -0,0 +1,109 @@
+/*
+  mmap/munmap churn over a fragmented 32-bit address space.
+  Exercises the 32-bit guest page allocator's range search and range marking.
+*/
+
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include <sys/mman.h>
+
+namespace {
+  constexpr size_t PAGE_SIZE = 4096;
+
+  struct Region {
+    char *Ptr;
+    size_t Size;
+    uint32_t Tag;
+  };
+
+  // Small deterministic LCG so the run is reproducible between host and guest
+  uint32_t NextRandom(uint32_t &State) {
+    State = State * 1664525U + 1013904223U;
+    return State >> 8;
+  }
+
+  char *MapRegion(size_t Size, uint32_t Tag) {
+    void *Ptr = mmap(nullptr, Size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (Ptr == MAP_FAILED) {
+      return nullptr;
+    }
+
+    // Tag the first and last word so overlapping allocations are caught on unmap
+    auto Bytes = static_cast<char*>(Ptr);
+    memcpy(Bytes, &Tag, sizeof(Tag));
+    memcpy(Bytes + Size - sizeof(Tag), &Tag, sizeof(Tag));
+    return Bytes;
+  }
+
+  bool HasTag(Region const &Slot) {
+    uint32_t First, Last;
+    memcpy(&First, Slot.Ptr, sizeof(First));
+    memcpy(&Last, Slot.Ptr + Slot.Size - sizeof(Last), sizeof(Last));
+    return First == Slot.Tag && Last == Slot.Tag;
+  }
+}
+
+TEST_CASE("mmap: fragmented churn") {
+  constexpr size_t FRAGMENT_COUNT = 8192;
+  constexpr size_t CHURN_ITERATIONS = 100000;
+  constexpr size_t LIVE_SLOTS = 1024;
+
+  uint32_t Seed = 0x1234'5678;
+
+  // Fragment the address space by mapping a run of single pages and freeing every other one
+  std::vector<Region> Fragments;
+  Fragments.reserve(FRAGMENT_COUNT);
+  for (size_t i = 0; i < FRAGMENT_COUNT; ++i) {
+    char *Ptr = MapRegion(PAGE_SIZE, 0);
+    REQUIRE(Ptr != nullptr);
+    Fragments.push_back({Ptr, PAGE_SIZE, 0});
+  }
+
+  for (size_t i = 0; i < Fragments.size(); i += 2) {
+    REQUIRE(munmap(Fragments[i].Ptr, Fragments[i].Size) == 0);
+    Fragments[i].Ptr = nullptr;
+  }
+
+  std::vector<Region> Live(LIVE_SLOTS, Region{nullptr, 0, 0});
+  bool Corrupt = false;
+  // Every mapping gets its own tag, so a region handed out twice is always caught
+  uint32_t Generation = 0;
+
+  for (size_t i = 0; i < CHURN_ITERATIONS; ++i) {
+    auto &Slot = Live[NextRandom(Seed) % LIVE_SLOTS];
+
+    if (Slot.Ptr) {
+      if (!HasTag(Slot)) {
+        Corrupt = true;
+      }
+      REQUIRE(munmap(Slot.Ptr, Slot.Size) == 0);
+      Slot.Ptr = nullptr;
+    }
+    else {
+      // Mostly small allocations with the occasional larger one
+      size_t Pages = (NextRandom(Seed) % 16) == 0 ? 1 + NextRandom(Seed) % 256 : 1 + NextRandom(Seed) % 4;
+      Slot.Size = Pages * PAGE_SIZE;
+      Slot.Tag = ++Generation;
+      Slot.Ptr = MapRegion(Slot.Size, Slot.Tag);
+      REQUIRE(Slot.Ptr != nullptr);
+      CHECK(reinterpret_cast<uintptr_t>(Slot.Ptr) + Slot.Size <= 0xFFFF'F000ULL);
+    }
+  }
+
+  CHECK(Corrupt == false);
+
+  for (auto &Slot : Live) {
+    if (Slot.Ptr) {
+      CHECK(munmap(Slot.Ptr, Slot.Size) == 0);
+    }
+  }
+
+  for (auto &Fragment : Fragments) {
+    if (Fragment.Ptr) {
+      CHECK(munmap(Fragment.Ptr, Fragment.Size) == 0);
+    }
+  }
+}